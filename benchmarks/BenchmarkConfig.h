@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_BENCHMARKS_BENCHMARKCONFIG_H
+#define PHASAR_BENCHMARKS_BENCHMARKCONFIG_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/FileSystem.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+namespace psr::benchmark {
+
+static constexpr llvm::StringLiteral PathToLLTestFiles =
+    PHASAR_BUILD_DIR "/test/llvm_test_code/";
+
+/// The path of an IR file from the IR test code, e.g.
+/// getLLFile("linear_constant/call_10_cpp.ll")
+inline std::string getLLFile(llvm::StringRef SubPath) {
+  return (PathToLLTestFiles + SubPath).str();
+}
+
+/// Skips the benchmark, if the IR file at Path has not been generated
+inline bool checkLLFileExists(::benchmark::State &State,
+                              const std::string &Path) {
+  if (llvm::sys::fs::exists(Path)) {
+    return true;
+  }
+  State.SkipWithError(("Missing IR file " + Path).c_str());
+  return false;
+}
+
+} // namespace psr::benchmark
+
+#endif // PHASAR_BENCHMARKS_BENCHMARKCONFIG_H
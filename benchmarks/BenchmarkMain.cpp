@@ -0,0 +1,35 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Config/Version.h"
+
+#include "benchmark/benchmark.h"
+
+#define PSR_BENCHMARK_STR_IMPL(X) #X
+#define PSR_BENCHMARK_STR(X) PSR_BENCHMARK_STR_IMPL(X)
+
+int main(int Argc, char **Argv) {
+  // Record the PhASAR version in the JSON output, s.t. results from
+  // different revisions can be told apart
+  ::benchmark::AddCustomContext("phasar_version",
+                                PSR_BENCHMARK_STR(PHASAR_VERSION));
+#ifdef NDEBUG
+  ::benchmark::AddCustomContext("phasar_assertions", "off");
+#else
+  ::benchmark::AddCustomContext("phasar_assertions", "on");
+#endif
+
+  ::benchmark::Initialize(&Argc, Argv);
+  if (::benchmark::ReportUnrecognizedArguments(Argc, Argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/ControlFlow/CallGraphAnalysisType.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/Utils/Soundness.h"
+
+#include "BenchmarkConfig.h"
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+using namespace psr;
+using namespace psr::benchmark;
+
+namespace {
+
+void BM_LLVMProjectIRDBLoad(::benchmark::State &State, llvm::StringRef File) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  size_t NumInsts = 0;
+  for (auto _ : State) { // NOLINT
+    LLVMProjectIRDB IRDB(Path);
+    NumInsts = IRDB.getNumInstructions();
+    ::benchmark::DoNotOptimize(NumInsts);
+  }
+  State.counters["Instructions"] = double(NumInsts);
+}
+
+void BM_LLVMAliasSet(::benchmark::State &State, llvm::StringRef File) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  LLVMProjectIRDB IRDB(Path);
+  for (auto _ : State) { // NOLINT
+    // Compute all alias sets eagerly, s.t. the whole module is analyzed
+    LLVMAliasSet PT(&IRDB, /*UseLazyEvaluation=*/false);
+    ::benchmark::ClobberMemory();
+  }
+  State.counters["Instructions"] = double(IRDB.getNumInstructions());
+}
+
+void BM_CallGraph(::benchmark::State &State, llvm::StringRef File,
+                  CallGraphAnalysisType CGType) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  LLVMProjectIRDB IRDB(Path);
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMAliasSet PT(&IRDB, /*UseLazyEvaluation=*/false);
+
+  size_t NumFuns = 0;
+  for (auto _ : State) { // NOLINT
+    // Do not model the global ctors/dtors, as this would add artificial
+    // functions to the IRDB in each iteration
+    LLVMBasedICFG ICF(&IRDB, CGType, {"main"}, &TH, &PT, Soundness::Soundy,
+                      /*IncludeGlobals=*/false);
+    NumFuns = ICF.getNumVertexFunctions();
+    ::benchmark::DoNotOptimize(NumFuns);
+  }
+  State.counters["VertexFunctions"] = double(NumFuns);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_LLVMProjectIRDBLoad, virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LLVMProjectIRDBLoad, globals_lca_5,
+                  "globals/globals_lca_5_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_LLVMAliasSet, inter_dynamic_02,
+                  "pointers/inter_dynamic_02_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_LLVMAliasSet, virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_CallGraph, CHA_virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll",
+                  CallGraphAnalysisType::CHA)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CallGraph, RTA_virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll",
+                  CallGraphAnalysisType::RTA)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CallGraph, OTF_virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll",
+                  CallGraphAnalysisType::OTF)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CallGraph, OTF_function_pointer_3,
+                  "call_graphs/function_pointer_3_cpp.ll",
+                  CallGraphAnalysisType::OTF)
+    ->Unit(::benchmark::kMicrosecond);
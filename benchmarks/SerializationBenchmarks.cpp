@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/ControlFlow/CallGraphAnalysisType.h"
+#include "phasar/ControlFlow/CallGraphData.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/DIBasedTypeHierarchy.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/DIBasedTypeHierarchyData.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+
+#include "llvm/Support/raw_ostream.h"
+
+#include "BenchmarkConfig.h"
+#include "benchmark/benchmark.h"
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace psr;
+using namespace psr::benchmark;
+
+// Each benchmark serializes an already computed helper analysis to JSON and
+// constructs a new one from it. The throughput refers to the size of the
+// serialized JSON.
+
+namespace {
+
+void BM_CallGraphRoundTrip(::benchmark::State &State, llvm::StringRef File) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  LLVMProjectIRDB IRDB(Path);
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::OTF, {"main"});
+
+  int64_t Bytes = 0;
+  for (auto _ : State) { // NOLINT
+    std::string Ser;
+    llvm::raw_string_ostream OS(Ser);
+    ICF.printAsJson(OS);
+    OS.flush();
+
+    LLVMBasedICFG Deser(&IRDB, CallGraphData::loadJsonString(Ser));
+    ::benchmark::ClobberMemory();
+    Bytes += int64_t(Ser.size());
+  }
+  State.SetBytesProcessed(Bytes);
+}
+
+void BM_AliasSetRoundTrip(::benchmark::State &State, llvm::StringRef File) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  LLVMProjectIRDB IRDB(Path);
+  LLVMAliasSet PT(&IRDB, /*UseLazyEvaluation=*/false);
+
+  int64_t Bytes = 0;
+  for (auto _ : State) { // NOLINT
+    std::string Ser;
+    llvm::raw_string_ostream OS(Ser);
+    PT.printAsJson(OS);
+    OS.flush();
+
+    LLVMAliasSet Deser(&IRDB, nlohmann::json::parse(Ser));
+    ::benchmark::ClobberMemory();
+    Bytes += int64_t(Ser.size());
+  }
+  State.SetBytesProcessed(Bytes);
+}
+
+void BM_TypeHierarchyRoundTrip(::benchmark::State &State,
+                               llvm::StringRef File) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  LLVMProjectIRDB IRDB(Path);
+  DIBasedTypeHierarchy TH(IRDB);
+
+  int64_t Bytes = 0;
+  for (auto _ : State) { // NOLINT
+    std::string Ser;
+    llvm::raw_string_ostream OS(Ser);
+    TH.printAsJson(OS);
+    OS.flush();
+
+    DIBasedTypeHierarchy Deser(&IRDB,
+                               DIBasedTypeHierarchyData::loadJsonString(Ser));
+    ::benchmark::ClobberMemory();
+    Bytes += int64_t(Ser.size());
+  }
+  State.SetBytesProcessed(Bytes);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_CallGraphRoundTrip, virtual_call_9,
+                  "call_graphs/virtual_call_9_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_AliasSetRoundTrip, inter_dynamic_02,
+                  "pointers/inter_dynamic_02_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_TypeHierarchyRoundTrip, type_hierarchy_21,
+                  "type_hierarchies/type_hierarchy_21_cpp_dbg.ll")
+    ->Unit(::benchmark::kMicrosecond);
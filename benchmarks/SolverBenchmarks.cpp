@@ -0,0 +1,324 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolver.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/DataFlow/Mono/MonoWorklist.h"
+#include "phasar/DataFlow/Mono/Solver/InterMonoSolver.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/IDEGeneralizedLCA.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEInstInteractionAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDETypeStateAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/TypeStateDescriptions/CSTDFILEIOTypeStateDescription.h"
+#include "phasar/PhasarLLVM/DataFlow/Mono/Problems/InterMonoTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/Mono/Problems/IntraMonoFullConstantPropagation.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/SimpleAnalysisConstructor.h"
+#include "phasar/PhasarLLVM/TaintConfig/LLVMTaintConfig.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstrTypes.h"
+#include "llvm/IR/Instruction.h"
+
+#include "BenchmarkConfig.h"
+#include "benchmark/benchmark.h"
+
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace psr;
+using namespace psr::benchmark;
+
+namespace {
+
+const std::vector<std::string> EntryPoints = {"main"};
+
+/// Runs the solver on a fresh problem per iteration. The helper analyses are
+/// computed once before, so only the data-flow analysis itself is measured.
+template <typename SolverFactoryT>
+void runSolverBenchmark(::benchmark::State &State, llvm::StringRef File,
+                        SolverFactoryT SolverFactory) {
+  auto Path = getLLFile(File);
+  if (!checkLLFileExists(State, Path)) {
+    return;
+  }
+
+  HelperAnalyses HA(Path, EntryPoints);
+  // Construct the lazy helper analyses outside of the measured region
+  HA.getICFG();
+  HA.getAliasInfo();
+
+  for (auto _ : State) { // NOLINT
+    SolverFactory(HA);
+  }
+
+  State.counters["Instructions"] =
+      double(HA.getProjectIRDB().getNumInstructions());
+}
+
+/// The return values of calls to SourceFn are tainted and all arguments of
+/// calls to SinkFn are leaking
+LLVMTaintConfig getTaintConfig(llvm::StringRef SourceFn = "_Z6sourcev",
+                               llvm::StringRef SinkFn = "_Z4sinki") {
+  auto SourceCB = [SourceFn](const llvm::Instruction *Inst) {
+    std::set<const llvm::Value *> Ret;
+    if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+        Call && Call->getCalledFunction() &&
+        Call->getCalledFunction()->getName() == SourceFn) {
+      Ret.insert(Call);
+    }
+    return Ret;
+  };
+  auto SinkCB = [SinkFn](const llvm::Instruction *Inst) {
+    std::set<const llvm::Value *> Ret;
+    if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+        Call && Call->getCalledFunction() &&
+        Call->getCalledFunction()->getName() == SinkFn) {
+      for (const auto &Arg : Call->args()) {
+        Ret.insert(Arg.get());
+      }
+    }
+    return Ret;
+  };
+  return LLVMTaintConfig(std::move(SourceCB), std::move(SinkCB));
+}
+
+/// Reports how many edge functions the solver has allocated from its
+/// EdgeFunctionPool, if pooling is enabled
+template <typename SolverT>
+void reportPoolStatistics(::benchmark::State &State, const SolverT &Solver) {
+  if (auto Stats = Solver.getEdgeFunctionPoolStatistics()) {
+    State.counters["PooledAllocations"] = double(Stats->NumAllocations);
+    State.counters["ReusedBlocks"] = double(Stats->NumReused);
+  }
+}
+
+void BM_IDELinearConstantAnalysis(::benchmark::State &State,
+                                  llvm::StringRef File, bool Pooled) {
+  runSolverBenchmark(State, File, [&State, Pooled](HelperAnalyses &HA) {
+    auto Problem =
+        createAnalysisProblem<IDELinearConstantAnalysis>(HA, EntryPoints);
+    Problem.getIFDSIDESolverConfig().setPoolEdgeFunctions(Pooled);
+    IDESolver Solver(Problem, &HA.getICFG());
+    auto Results = Solver.solve();
+    ::benchmark::DoNotOptimize(Results);
+    reportPoolStatistics(State, Solver);
+  });
+}
+
+void BM_IDEGeneralizedLCA(::benchmark::State &State, llvm::StringRef File,
+                          bool Pooled) {
+  runSolverBenchmark(State, File, [&State, Pooled](HelperAnalyses &HA) {
+    auto Problem = createAnalysisProblem<IDEGeneralizedLCA>(
+        HA, EntryPoints, /*MaxSetSize=*/2);
+    Problem.getIFDSIDESolverConfig().setPoolEdgeFunctions(Pooled);
+    IDESolver Solver(Problem, &HA.getICFG());
+    auto Results = Solver.solve();
+    ::benchmark::DoNotOptimize(Results);
+    reportPoolStatistics(State, Solver);
+  });
+}
+
+/// Reports the number of processed path edges, which shows how many
+/// statements the sparse mode skips
+void reportPathEdges(::benchmark::State &State, size_t NumPathEdges) {
+  State.counters["PathEdges"] = double(NumPathEdges);
+}
+
+void BM_IFDSTaintAnalysis(::benchmark::State &State, llvm::StringRef File,
+                          bool Sparse) {
+  auto Config = getTaintConfig();
+  size_t NumPathEdges = 0;
+  runSolverBenchmark(
+      State, File, [&Config, Sparse, &NumPathEdges](HelperAnalyses &HA) {
+        auto Problem =
+            createAnalysisProblem<IFDSTaintAnalysis>(HA, &Config, EntryPoints);
+        Problem.getIFDSIDESolverConfig().setSparse(Sparse);
+        IFDSSolver Solver(Problem, &HA.getICFG());
+        auto Results = Solver.solve();
+        ::benchmark::DoNotOptimize(Results);
+        NumPathEdges = Solver.getNumPathEdges();
+      });
+  reportPathEdges(State, NumPathEdges);
+}
+
+void BM_IFDSUninitializedVariables(::benchmark::State &State,
+                                   llvm::StringRef File, bool Sparse) {
+  size_t NumPathEdges = 0;
+  runSolverBenchmark(State, File, [Sparse, &NumPathEdges](HelperAnalyses &HA) {
+    auto Problem =
+        createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+    Problem.getIFDSIDESolverConfig().setSparse(Sparse);
+    IFDSSolver Solver(Problem, &HA.getICFG());
+    auto Results = Solver.solve();
+    ::benchmark::DoNotOptimize(Results);
+    NumPathEdges = Solver.getNumPathEdges();
+  });
+  reportPathEdges(State, NumPathEdges);
+}
+
+void BM_IDETypeStateAnalysis(::benchmark::State &State,
+                             llvm::StringRef File) {
+  CSTDFILEIOTypeStateDescription Desc{};
+  runSolverBenchmark(State, File, [&Desc](HelperAnalyses &HA) {
+    auto Problem = createAnalysisProblem<
+        IDETypeStateAnalysis<CSTDFILEIOTypeStateDescription>>(HA, &Desc,
+                                                              EntryPoints);
+    IDESolver Solver(Problem, &HA.getICFG());
+    auto Results = Solver.solve();
+    ::benchmark::DoNotOptimize(Results);
+  });
+}
+
+void BM_IDEInstInteractionAnalysis(::benchmark::State &State,
+                                   llvm::StringRef File) {
+  runSolverBenchmark(State, File, [](HelperAnalyses &HA) {
+    auto Problem =
+        createAnalysisProblem<IDEInstInteractionAnalysisT<std::string>>(
+            HA, EntryPoints);
+    // Label each instruction and global with its PhASAR id, as in the
+    // unittests, so the analysis has some edge facts to propagate
+    Problem.registerEdgeFactGenerator(
+        [](std::variant<const llvm::Instruction *, const llvm::GlobalVariable *>
+               InstOrGlob) {
+          return std::visit(
+              [](const auto *Val) -> std::set<std::string> {
+                return {getMetaDataID(Val)};
+              },
+              InstOrGlob);
+        });
+    IDESolver Solver(Problem, &HA.getICFG());
+    auto Results = Solver.solve();
+    ::benchmark::DoNotOptimize(Results);
+  });
+}
+
+/// Reports how often the Mono solver has visited the nodes of the CFG in
+/// the last iteration
+void reportMonoSolverStatistics(::benchmark::State &State,
+                                const MonoSolverStatistics &Stats) {
+  State.counters["Visits"] = double(Stats.NumVisits);
+  State.counters["MaxVisitsPerNode"] = double(Stats.MaxVisitsPerNode);
+  State.counters["DuplicatePushes"] = double(Stats.NumDuplicatePushes);
+}
+
+void BM_IntraMonoFullConstantPropagation(::benchmark::State &State,
+                                         llvm::StringRef File,
+                                         MonoWorklistStrategy Strategy) {
+  MonoSolverStatistics Stats;
+  runSolverBenchmark(State, File, [Strategy, &Stats](HelperAnalyses &HA) {
+    auto Problem = createAnalysisProblem<IntraMonoFullConstantPropagation>(
+        HA, EntryPoints);
+    IntraMonoSolver Solver(Problem, Strategy);
+    Solver.solve();
+    Stats = Solver.getStatistics();
+  });
+  reportMonoSolverStatistics(State, Stats);
+}
+
+void BM_InterMonoTaintAnalysis(::benchmark::State &State,
+                               llvm::StringRef File, llvm::StringRef SourceFn,
+                               llvm::StringRef SinkFn,
+                               MonoWorklistStrategy Strategy) {
+  auto Config = getTaintConfig(SourceFn, SinkFn);
+  MonoSolverStatistics Stats;
+  runSolverBenchmark(
+      State, File, [&Config, Strategy, &Stats](HelperAnalyses &HA) {
+        auto Problem = createAnalysisProblem<InterMonoTaintAnalysis>(
+            HA, Config, EntryPoints);
+        InterMonoSolver_P<InterMonoTaintAnalysis, 3> Solver(Problem,
+                                                             Strategy);
+        Solver.solve();
+        ::benchmark::DoNotOptimize(Problem.getAllLeaks());
+        Stats = Solver.getStatistics();
+      });
+  reportMonoSolverStatistics(State, Stats);
+}
+
+} // namespace
+
+// Compare allocating the edge functions from the global heap and from the
+// solver's EdgeFunctionPool
+#define POOLED_IDE_BENCHMARKS(BM, NAME, FILE)                                  \
+  BENCHMARK_CAPTURE(BM, NAME, FILE, false)->Unit(::benchmark::kMicrosecond);   \
+  BENCHMARK_CAPTURE(BM, NAME##_pooled, FILE, true)                             \
+      ->Unit(::benchmark::kMicrosecond)
+
+POOLED_IDE_BENCHMARKS(BM_IDELinearConstantAnalysis, call_04,
+                      "linear_constant/call_04_cpp_dbg.ll");
+POOLED_IDE_BENCHMARKS(BM_IDELinearConstantAnalysis, global_09,
+                      "linear_constant/global_09_cpp_dbg.ll");
+
+POOLED_IDE_BENCHMARKS(BM_IDEGeneralizedLCA, BranchTest,
+                      "general_linear_constant/BranchTest_c.ll");
+POOLED_IDE_BENCHMARKS(BM_IDEGeneralizedLCA, StringBranchTest,
+                      "general_linear_constant/StringBranchTest_c.ll");
+
+// Compare the dense and the sparse mode of the IFDS solver; the "PathEdges"
+// counter shows the number of processed path edges
+#define SPARSE_IFDS_BENCHMARKS(BM, NAME, FILE)                                 \
+  BENCHMARK_CAPTURE(BM, NAME, FILE, false)->Unit(::benchmark::kMicrosecond);   \
+  BENCHMARK_CAPTURE(BM, NAME##_sparse, FILE, true)                             \
+      ->Unit(::benchmark::kMicrosecond)
+
+SPARSE_IFDS_BENCHMARKS(
+    BM_IFDSTaintAnalysis, taint_exception_10,
+    "taint_analysis/dummy_source_sink/taint_exception_10_cpp_dbg.ll");
+SPARSE_IFDS_BENCHMARKS(
+    BM_IFDSTaintAnalysis, taint_lib_sum_01,
+    "taint_analysis/dummy_source_sink/taint_lib_sum_01_cpp_dbg.ll");
+
+SPARSE_IFDS_BENCHMARKS(BM_IFDSUninitializedVariables, growing_example,
+                       "uninitialized_variables/growing_example_cpp_dbg.ll");
+SPARSE_IFDS_BENCHMARKS(BM_IFDSUninitializedVariables, multiple_calls,
+                       "uninitialized_variables/multiple_calls_cpp_dbg.ll");
+
+BENCHMARK_CAPTURE(BM_IDETypeStateAnalysis, typestate_10,
+                  "typestate_analysis_fileio/typestate_10_c.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_IDETypeStateAnalysis, typestate_18,
+                  "typestate_analysis_fileio/typestate_18_c.ll")
+    ->Unit(::benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_IDEInstInteractionAnalysis, call_04,
+                  "inst_interaction/call_04_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_IDEInstInteractionAnalysis, global_03,
+                  "inst_interaction/global_03_cpp.ll")
+    ->Unit(::benchmark::kMicrosecond);
+
+// Compare the worklist strategies of the Mono solvers on CFGs with loops; the
+// "Visits" counter shows the number of processed worklist entries
+#define MONO_WORKLIST_BENCHMARKS(BM, NAME, ...)                                \
+  BENCHMARK_CAPTURE(BM, NAME##_FIFO, __VA_ARGS__, MonoWorklistStrategy::FIFO)  \
+      ->Unit(::benchmark::kMicrosecond);                                       \
+  BENCHMARK_CAPTURE(BM, NAME##_RPO, __VA_ARGS__,                               \
+                    MonoWorklistStrategy::ReversePostOrder)                    \
+      ->Unit(::benchmark::kMicrosecond);                                       \
+  BENCHMARK_CAPTURE(BM, NAME##_SCC, __VA_ARGS__, MonoWorklistStrategy::SCC)    \
+      ->Unit(::benchmark::kMicrosecond)
+
+MONO_WORKLIST_BENCHMARKS(BM_IntraMonoFullConstantPropagation, for_01,
+                         "linear_constant/for_01_cpp.ll");
+MONO_WORKLIST_BENCHMARKS(BM_IntraMonoFullConstantPropagation, while_05,
+                         "linear_constant/while_05_cpp.ll");
+MONO_WORKLIST_BENCHMARKS(BM_InterMonoTaintAnalysis, taint_13,
+                         "taint_analysis/taint_13_c.ll", "foo", "printf");
+MONO_WORKLIST_BENCHMARKS(BM_InterMonoTaintAnalysis, taint_exception_10,
+                         "taint_analysis/dummy_source_sink/"
+                         "taint_exception_10_cpp_dbg.ll",
+                         "_Z6sourcev", "_Z4sinki");
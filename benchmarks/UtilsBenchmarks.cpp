@@ -0,0 +1,291 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Config/phasar-config.h"
+#include "phasar/Utils/AdjacencyList.h"
+#include "phasar/Utils/CompressedTransitiveClosure.h"
+#include "phasar/Utils/DFAMinimizer.h"
+
+#ifdef PHASAR_HAS_SQLITE
+#include "phasar/DB/Hexastore.h"
+#endif
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+using GraphTy = AdjacencyList<int>;
+
+/// Random DAG with few distinct values and many common suffixes; the same
+/// shape of graph as in the DFAMinimizer unittests.
+GraphTy createRandomDag(unsigned NumVertices, unsigned Seed) {
+  using traits_t = GraphTraits<GraphTy>;
+
+  std::mt19937 Gen(Seed);
+  std::uniform_int_distribution<int> ValDist(0, 2);
+  std::uniform_int_distribution<unsigned> DegDist(0, 3);
+
+  GraphTy G;
+  for (unsigned I = 0; I != NumVertices; ++I) {
+    traits_t::addNode(G, ValDist(Gen));
+  }
+  traits_t::addRoot(G, 0);
+  for (unsigned I = 0; I + 1 < NumVertices; ++I) {
+    auto Degree = DegDist(Gen);
+    std::uniform_int_distribution<unsigned> TargetDist(
+        std::max(I + 1, NumVertices - 8), NumVertices - 1);
+    for (unsigned E = 0; E != Degree; ++E) {
+      traits_t::addEdge(G, I, TargetDist(Gen));
+    }
+  }
+  return G;
+}
+
+void BM_MinimizeGraph(::benchmark::State &State) {
+  auto G = createRandomDag(unsigned(State.range(0)), 42);
+  for (auto _ : State) { // NOLINT
+    auto Eq = minimizeGraph(G);
+    ::benchmark::DoNotOptimize(Eq);
+  }
+  State.SetComplexityN(State.range(0));
+}
+
+void BM_MinimizeGraphIteratively(::benchmark::State &State) {
+  auto G = createRandomDag(unsigned(State.range(0)), 42);
+  for (auto _ : State) { // NOLINT
+    auto Eq = detail::minimizeGraphIteratively(G);
+    ::benchmark::DoNotOptimize(Eq);
+  }
+  State.SetComplexityN(State.range(0));
+}
+
+using EdgeList = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/// A synthetic type hierarchy with base -> derived edges: Each type derives
+/// from one of the 64 types created before it, s.t. the hierarchy is both deep
+/// and wide, and every 16th type additionally has a second, arbitrary base.
+EdgeList createTypeHierarchy(uint32_t NumTypes, unsigned Seed) {
+  std::mt19937 Gen(Seed);
+  EdgeList Edges;
+  for (uint32_t I = 1; I < NumTypes; ++I) {
+    std::uniform_int_distribution<uint32_t> BaseDist(I < 64 ? 0 : I - 64,
+                                                     I - 1);
+    Edges.emplace_back(BaseDist(Gen), I);
+    if (I % 16 == 0) {
+      std::uniform_int_distribution<uint32_t> OtherBaseDist(0, I - 1);
+      Edges.emplace_back(OtherBaseDist(Gen), I);
+    }
+  }
+  return Edges;
+}
+
+/// The closure as a std::set per type, as the LLVMTypeHierarchy used to store
+/// it. Base types always have smaller ids than their derived types.
+std::vector<std::set<uint32_t>> createSetClosure(uint32_t NumTypes,
+                                                 const EdgeList &Edges) {
+  std::vector<std::vector<uint32_t>> Derived(NumTypes);
+  for (auto [Base, Der] : Edges) {
+    Derived[Base].push_back(Der);
+  }
+  std::vector<std::set<uint32_t>> Ret(NumTypes);
+  for (uint32_t I = NumTypes; I--;) {
+    Ret[I].insert(I);
+    for (auto Der : Derived[I]) {
+      Ret[I].insert(Ret[Der].begin(), Ret[Der].end());
+    }
+  }
+  return Ret;
+}
+
+std::vector<std::pair<uint32_t, uint32_t>> createQueries(uint32_t NumTypes) {
+  std::mt19937 Gen(42);
+  std::uniform_int_distribution<uint32_t> TypeDist(0, NumTypes - 1);
+  std::vector<std::pair<uint32_t, uint32_t>> Ret(1024);
+  for (auto &Query : Ret) {
+    Query = {TypeDist(Gen), TypeDist(Gen)};
+  }
+  return Ret;
+}
+
+void BM_CompressedClosureBuild(::benchmark::State &State) {
+  auto NumTypes = uint32_t(State.range(0));
+  auto Edges = createTypeHierarchy(NumTypes, 42);
+  size_t NumIntervals = 0;
+  for (auto _ : State) { // NOLINT
+    CompressedTransitiveClosure TC(NumTypes, Edges);
+    NumIntervals = TC.getNumIntervals();
+    ::benchmark::DoNotOptimize(NumIntervals);
+  }
+  State.counters["Intervals"] = double(NumIntervals);
+  State.SetComplexityN(State.range(0));
+}
+
+void BM_SetClosureBuild(::benchmark::State &State) {
+  auto NumTypes = uint32_t(State.range(0));
+  auto Edges = createTypeHierarchy(NumTypes, 42);
+  for (auto _ : State) { // NOLINT
+    auto Closure = createSetClosure(NumTypes, Edges);
+    ::benchmark::DoNotOptimize(Closure);
+  }
+  State.SetComplexityN(State.range(0));
+}
+
+void BM_CompressedClosureIsSubType(::benchmark::State &State) {
+  auto NumTypes = uint32_t(State.range(0));
+  CompressedTransitiveClosure TC(NumTypes, createTypeHierarchy(NumTypes, 42));
+  auto Queries = createQueries(NumTypes);
+  for (auto _ : State) { // NOLINT
+    for (auto [Type, SubType] : Queries) {
+      bool IsSubType = TC.reaches(Type, SubType);
+      ::benchmark::DoNotOptimize(IsSubType);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations() * Queries.size()));
+}
+
+void BM_SetClosureIsSubType(::benchmark::State &State) {
+  auto NumTypes = uint32_t(State.range(0));
+  auto Closure = createSetClosure(NumTypes, createTypeHierarchy(NumTypes, 42));
+  auto Queries = createQueries(NumTypes);
+  for (auto _ : State) { // NOLINT
+    for (auto [Type, SubType] : Queries) {
+      // getSubTypes() used to return a copy of the set
+      auto SubTypes = Closure[Type];
+      bool IsSubType = SubTypes.count(SubType);
+      ::benchmark::DoNotOptimize(IsSubType);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations() * Queries.size()));
+}
+
+void BM_CompressedClosureSubTypes(::benchmark::State &State) {
+  auto NumTypes = uint32_t(State.range(0));
+  CompressedTransitiveClosure TC(NumTypes, createTypeHierarchy(NumTypes, 42));
+  auto Queries = createQueries(NumTypes);
+  for (auto _ : State) { // NOLINT
+    for (auto [Type, Unused] : Queries) {
+      uint32_t Sum = 0;
+      for (auto SubType : TC.reachableFrom(Type)) {
+        Sum += SubType;
+      }
+      ::benchmark::DoNotOptimize(Sum);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations() * Queries.size()));
+}
+
+#ifdef PHASAR_HAS_SQLITE
+
+std::vector<std::array<std::string, 3>> createTriples(size_t NumTriples) {
+  std::vector<std::array<std::string, 3>> Ret;
+  Ret.reserve(NumTriples);
+  for (size_t I = 0; I != NumTriples; ++I) {
+    Ret.push_back({"fun_" + std::to_string(I % 97),
+                   "edge_" + std::to_string(I % 7),
+                   "fun_" + std::to_string(I)});
+  }
+  return Ret;
+}
+
+/// Creates a fresh file-based Hexastore for each iteration, as this is where
+/// the transaction handling matters
+template <typename InsertFn>
+void runHexastoreBenchmark(::benchmark::State &State, InsertFn Insert) {
+  auto Triples = createTriples(size_t(State.range(0)));
+
+  llvm::SmallString<128> DBPath;
+  if (auto EC = llvm::sys::fs::createTemporaryFile("phasar-hexastore",
+                                                   "sqlite", DBPath)) {
+    State.SkipWithError(("Cannot create temporary file: " + EC.message())
+                            .c_str());
+    return;
+  }
+
+  for (auto _ : State) { // NOLINT
+    State.PauseTiming();
+    llvm::sys::fs::remove(DBPath);
+    State.ResumeTiming();
+
+    Hexastore HS(DBPath.str().str());
+    Insert(HS, Triples);
+  }
+
+  llvm::sys::fs::remove(DBPath);
+  State.SetItemsProcessed(int64_t(State.iterations()) * State.range(0));
+}
+
+void BM_HexastorePut(::benchmark::State &State) {
+  runHexastoreBenchmark(State, [](Hexastore &HS, const auto &Triples) {
+    for (const auto &Triple : Triples) {
+      HS.put(Triple);
+    }
+  });
+}
+
+void BM_HexastorePutAll(::benchmark::State &State) {
+  runHexastoreBenchmark(State, [](Hexastore &HS, const auto &Triples) {
+    HS.putAll(Triples);
+  });
+}
+
+#endif
+
+} // namespace
+
+BENCHMARK(BM_MinimizeGraph)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Complexity();
+BENCHMARK(BM_MinimizeGraphIteratively)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Complexity();
+
+BENCHMARK(BM_CompressedClosureBuild)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 18)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Complexity();
+BENCHMARK(BM_SetClosureBuild)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 12)
+    ->Unit(::benchmark::kMicrosecond)
+    ->Complexity();
+BENCHMARK(BM_CompressedClosureIsSubType)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 15)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_SetClosureIsSubType)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 12)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK(BM_CompressedClosureSubTypes)
+    ->RangeMultiplier(8)
+    ->Range(1 << 9, 1 << 15)
+    ->Unit(::benchmark::kMicrosecond);
+
+#ifdef PHASAR_HAS_SQLITE
+BENCHMARK(BM_HexastorePut)->Arg(1000)->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_HexastorePutAll)->Arg(1000)->Unit(::benchmark::kMillisecond);
+#endif
@@ -16,13 +16,17 @@
     "Hexastore requires SQLite3. Please install libsqlite3-dev and reconfigure PhASAR."
 #endif
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <array>
+#include <cstddef>
 #include <string>
 #include <vector>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace psr {
 /**
@@ -55,6 +59,48 @@ struct HSResult {
   }
 };
 
+class Hexastore;
+
+/**
+ * A forward-only cursor over the results of a query to the Hexastore. The
+ * rows are read lazily from the database, so the results do not need to be
+ * materialized at once. A cursor must not outlive the Hexastore it has been
+ * obtained from.
+ *
+ * @brief Streams the results of a Hexastore query.
+ */
+class HSCursor {
+public:
+  HSCursor(const HSCursor &) = delete;
+  HSCursor &operator=(const HSCursor &) = delete;
+  HSCursor(HSCursor &&Other) noexcept;
+  HSCursor &operator=(HSCursor &&Other) noexcept;
+  ~HSCursor();
+
+  /**
+   * @brief Advances to the next result.
+   * @return False, iff there are no more results.
+   */
+  [[nodiscard]] bool next();
+
+  /// The current result. Only valid after next() returned true.
+  [[nodiscard]] const HSResult &get() const noexcept { return Current; }
+
+private:
+  friend class Hexastore;
+
+  /// If InUse is nullptr, the cursor owns the Stmt. Otherwise, Stmt is a
+  /// cached statement of the Hexastore that is marked as InUse.
+  HSCursor(sqlite3_stmt *Stmt, bool *InUse) noexcept
+      : Stmt(Stmt), InUse(InUse) {}
+
+  void release() noexcept;
+
+  sqlite3_stmt *Stmt{};
+  bool *InUse{};
+  HSResult Current;
+};
+
 /**
  * A Hexastore is an efficient approach to store large graphs.
  * This approach is based on the paper "Database-Backed Program Analysis
@@ -76,9 +122,24 @@ struct HSResult {
 class Hexastore {
 private:
   sqlite3 *HSInternalDB{};
-  static int callback(void * /*NotUsed*/, int Argc, char **Argv,
-                      char **AzColName);
-  void doPut(const std::string &Query, std::array<std::string, 3> Edge);
+  /// The prepared statements of the six inserts, each consisting of three
+  /// SQL statements
+  std::array<llvm::SmallVector<sqlite3_stmt *, 3>, 6> InsertStmts{};
+  /// The prepared statements of the eight query kinds
+  std::array<sqlite3_stmt *, 8> SearchStmts{};
+  /// Whether the respective search statement is bound to an active cursor
+  std::array<bool, 8> SearchStmtInUse{};
+  sqlite3_stmt *BeginStmt{};
+  sqlite3_stmt *CommitStmt{};
+  size_t BulkBatchSize = 0;
+  size_t NumPendingInBatch = 0;
+
+  void exec(const char *Query);
+  void doPut(llvm::ArrayRef<sqlite3_stmt *> Stmts,
+             const std::array<std::string, 3> &Edge);
+  [[nodiscard]] sqlite3_stmt *prepare(const char *Query,
+                                      const char **Tail = nullptr);
+  void step(sqlite3_stmt *Stmt);
 
 public:
   /**
@@ -88,8 +149,10 @@ public:
    *
    * @brief Constructs a Hexastore under the given filename.
    * @param filename Filename of the Hexastore.
+   * @param EnableWAL Whether to use SQLite's write-ahead log. Allows
+   *        concurrent readers and faster commits for file-based Hexastores.
    */
-  Hexastore(const std::string &FileName);
+  Hexastore(const std::string &FileName, bool EnableWAL = true);
   Hexastore(const Hexastore &) = delete;
   Hexastore &operator=(const Hexastore &) = delete;
 
@@ -111,6 +174,37 @@ public:
    */
   void put(const std::array<std::string, 3> &Edge);
 
+  /**
+   * Adds all given tuples in bulk. The tuples are inserted within batched
+   * transactions instead of one implicit transaction per statement.
+   *
+   * @brief Creates new entries in the Hexastore.
+   * @param Edges New entries in the form of 3-tuples.
+   */
+  void putAll(llvm::ArrayRef<std::array<std::string, 3>> Edges);
+
+  /**
+   * While the bulk-load mode is active, all put() calls are grouped into
+   * transactions of BatchSize tuples each. Entries become visible to other
+   * connections only when their batch is committed. Calls to get() and
+   * query() within the bulk-load mode see all entries.
+   *
+   * @brief Starts the bulk-load mode.
+   * @param BatchSize Number of tuples per transaction.
+   */
+  void beginBulkLoad(size_t BatchSize = DefaultBulkBatchSize);
+
+  /**
+   * @brief Ends the bulk-load mode and commits the pending entries.
+   */
+  void endBulkLoad();
+
+  [[nodiscard]] bool isInBulkLoad() const noexcept {
+    return BulkBatchSize != 0;
+  }
+
+  static constexpr size_t DefaultBulkBatchSize = 4096;
+
   /**
    * A query is always in the form of a 3-tuple (source, edge, destination)
    * where
@@ -128,6 +222,16 @@ public:
    */
   std::vector<HSResult> get(std::array<std::string, 3> EdgeQuery,
                             size_t ResultSizeHint = 0);
+
+  /**
+   * Same as get(), but streams the results instead of collecting them into
+   * a vector.
+   *
+   * @brief Query information from the Hexastore.
+   * @param EdgeQuery Query in the form of a 3-tuple.
+   * @return A cursor over the queried information.
+   */
+  [[nodiscard]] HSCursor query(const std::array<std::string, 3> &EdgeQuery);
 };
 
 } // namespace psr
@@ -10,6 +10,7 @@
 #ifndef PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTION_H
 #define PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTION_H
 
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionPool.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunctionSingletonCache.h"
 #include "phasar/Utils/ByRef.h"
 #include "phasar/Utils/TypeTraits.h"
@@ -72,6 +73,8 @@ enum class EdgeFunctionAllocationPolicy {
   SmallObjectOptimized,
   DefaultHeapAllocated,
   CustomHeapAllocated,
+  /// Allocated within an EdgeFunctionPool
+  PoolAllocated,
 };
 
 class EdgeFunctionBase {
@@ -94,6 +97,10 @@ protected:
     EdgeFunctionSingletonCache<T> *Cache{};
   };
 
+  template <typename T> struct PooledRefCounted : RefCounted<T> {
+    EdgeFunctionPool *Pool{};
+  };
+
   template <typename ConcreteEF>
   constexpr static inline const ConcreteEF *
   getPtr(const void *const &EF) noexcept {
@@ -107,14 +114,21 @@ protected:
   constexpr static inline const ConcreteEF *
   getPtr(const void *const &&EF) = delete; // NOLINT
 
-  template <typename ConcreteEF>
-  static constexpr AllocationPolicy DefaultAllocPolicy =
-      IsSOOCandidate<ConcreteEF> ? AllocationPolicy::SmallObjectOptimized
-                                 : AllocationPolicy::DefaultHeapAllocated;
   template <typename ConcreteEF>
   static constexpr AllocationPolicy CustomAllocPolicy =
       IsSOOCandidate<ConcreteEF> ? AllocationPolicy::SmallObjectOptimized
                                  : AllocationPolicy::CustomHeapAllocated;
+
+  template <typename ConcreteEF>
+  static constexpr AllocationPolicy
+  getAllocPolicy(const EdgeFunctionPool *Pool) noexcept {
+    if constexpr (IsSOOCandidate<ConcreteEF>) {
+      return AllocationPolicy::SmallObjectOptimized;
+    } else {
+      return Pool ? AllocationPolicy::PoolAllocated
+                  : AllocationPolicy::DefaultHeapAllocated;
+    }
+  }
 };
 
 /// Non-null reference to an edge function that is guarenteed to be managed by
@@ -138,7 +152,7 @@ public:
     if constexpr (IsSOOCandidate<EF>) {
       return false;
     } else {
-      return IsCached;
+      return Policy == AllocationPolicy::CustomHeapAllocated;
     }
   }
 
@@ -152,15 +166,16 @@ public:
   }
 
 private:
-  explicit EdgeFunctionRef(const void *Instance, bool IsCached) noexcept
+  explicit EdgeFunctionRef(const void *Instance,
+                           AllocationPolicy Policy) noexcept
       : Instance(Instance) {
     if constexpr (!IsSOOCandidate<EF>) {
-      this->IsCached = IsCached;
+      this->Policy = Policy;
     }
   }
   const void *Instance{};
-  [[no_unique_address]] std::conditional_t<IsSOOCandidate<EF>, EmptyType, bool>
-      IsCached{};
+  [[no_unique_address]] std::conditional_t<IsSOOCandidate<EF>, EmptyType,
+                                           AllocationPolicy> Policy{};
 };
 
 /// Ref-counted and type-erased edge function with small-object optimization.
@@ -237,9 +252,7 @@ public:
                           (void)CEF;
                           return AllocationPolicy::SmallObjectOptimized;
                         } else {
-                          return CEF.IsCached
-                                     ? AllocationPolicy::CustomHeapAllocated
-                                     : AllocationPolicy::DefaultHeapAllocated;
+                          return CEF.Policy;
                         }
                       }()}) {}
 
@@ -257,7 +270,9 @@ public:
 
   /// Emplacement-constructor for any edge function. Constructs a new object of
   /// type ConcreteEF with the given constructor arguments and allocates space
-  /// for it on the heap if small-object-optimization cannot be applied.
+  /// for it on the heap if small-object-optimization cannot be applied. If an
+  /// EdgeFunctionPool is active for the current thread, allocates from that
+  /// pool instead.
   /// No extra copy- or move construction/assignment is performed. Use this ctor
   /// if even moving is expensive.
   template <typename ConcreteEF, typename... ArgTys>
@@ -267,17 +282,25 @@ public:
                                      std::is_nothrow_constructible_v<ConcreteEF,
                                                                      ArgTys...>)
       : EdgeFunction(
-            [](auto &&...Args) {
+            [](EdgeFunctionPool *Pool, auto &&...Args) -> const void * {
               if constexpr (IsSOOCandidate<std::decay_t<ConcreteEF>>) {
+                (void)Pool;
                 void *Ret = nullptr;
                 new (&Ret) ConcreteEF(std::forward<ArgTys>(Args)...);
                 return Ret;
               } else {
+                if (Pool) {
+                  using BlockTy = PooledRefCounted<ConcreteEF>;
+                  void *Mem = Pool->allocate(sizeof(BlockTy), alignof(BlockTy));
+                  return new (Mem)
+                      BlockTy{{{}, {std::forward<ArgTys>(Args)...}}, Pool};
+                }
                 return new RefCounted<ConcreteEF>{
                     {}, {std::forward<ArgTys>(Args)...}};
               }
-            }(std::forward<ArgTys>(Args)...),
-            {&VTableFor<ConcreteEF>, DefaultAllocPolicy<ConcreteEF>}) {
+            }(EdgeFunctionPool::current(), std::forward<ArgTys>(Args)...),
+            {&VTableFor<ConcreteEF>,
+             getAllocPolicy<ConcreteEF>(EdgeFunctionPool::current())}) {
     static_assert(std::is_same_v<l_t, typename ConcreteEF::l_t>,
                   "Cannot construct EdgeFunction with incompatible "
                   "lattice domain");
@@ -642,7 +665,7 @@ public:
   getCacheOrNull() const noexcept {
     assert(isa<ConcreteEF>());
     if (IsSOOCandidate<ConcreteEF> ||
-        VTAndHeapAlloc.getInt() == AllocationPolicy::DefaultHeapAllocated) {
+        VTAndHeapAlloc.getInt() != AllocationPolicy::CustomHeapAllocated) {
       return nullptr;
     }
     return static_cast<const CachedRefCounted<ConcreteEF> *>(EF)->Cache;
@@ -657,6 +680,12 @@ public:
         EF, VTAndHeapAlloc.getPointer());
   }
 
+  /// Gets a hash-code that is consistent with referenceEquals(). In contrast
+  /// to getHashCode(), this never inspects the concrete edge function.
+  [[nodiscard]] size_t getReferenceHashCode() const noexcept {
+    return llvm::hash_combine(EF, VTAndHeapAlloc.getPointer());
+  }
+
   [[nodiscard]] auto depth() const noexcept {
     assert(isValid() && "depth() called on nullptr!");
     return VTAndHeapAlloc.getPointer()->depth(EF);
@@ -701,16 +730,12 @@ private:
       },
       [](const void *EF, const EdgeFunction &SecondEF,
          AllocationPolicy Policy) {
-        return ConcreteEF::compose(
-            EdgeFunctionRef<ConcreteEF>(
-                EF, Policy == AllocationPolicy::CustomHeapAllocated),
-            SecondEF);
+        return ConcreteEF::compose(EdgeFunctionRef<ConcreteEF>(EF, Policy),
+                                   SecondEF);
       },
       [](const void *EF, const EdgeFunction &OtherEF, AllocationPolicy Policy) {
-        return ConcreteEF::join(
-            EdgeFunctionRef<ConcreteEF>(
-                EF, Policy == AllocationPolicy::CustomHeapAllocated),
-            OtherEF);
+        return ConcreteEF::join(EdgeFunctionRef<ConcreteEF>(EF, Policy),
+                                OtherEF);
       },
       [](const void *EF1, const void *EF2) noexcept {
         static_assert(IsEqualityComparable<ConcreteEF> ||
@@ -744,13 +769,19 @@ private:
       },
       [](const void *EF, AllocationPolicy Policy) noexcept {
         if constexpr (!IsSOOCandidate<ConcreteEF>) {
-          if (Policy != AllocationPolicy::CustomHeapAllocated) {
-            assert(Policy == AllocationPolicy::DefaultHeapAllocated);
-            delete static_cast<const RefCounted<ConcreteEF> *>(EF);
-          } else {
+          if (Policy == AllocationPolicy::CustomHeapAllocated) {
             auto CEF = static_cast<const CachedRefCounted<ConcreteEF> *>(EF);
             CEF->Cache->erase(CEF->Value);
             delete CEF;
+          } else if (Policy == AllocationPolicy::PoolAllocated) {
+            using BlockTy = PooledRefCounted<ConcreteEF>;
+            auto *PEF = static_cast<BlockTy *>(const_cast<void *>(EF));
+            auto *Pool = PEF->Pool;
+            std::destroy_at(PEF);
+            Pool->deallocate(PEF, sizeof(BlockTy), alignof(BlockTy));
+          } else {
+            assert(Policy == AllocationPolicy::DefaultHeapAllocated);
+            delete static_cast<const RefCounted<ConcreteEF> *>(EF);
           }
         }
       },
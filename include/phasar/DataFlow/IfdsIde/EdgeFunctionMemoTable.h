@@ -0,0 +1,171 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONMEMOTABLE_H
+#define PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONMEMOTABLE_H
+
+#include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace psr {
+
+/// Hit/miss counters of an EdgeFunctionMemoTable
+struct EdgeFunctionMemoStats {
+  size_t ComposeHits{};
+  size_t ComposeMisses{};
+  size_t JoinHits{};
+  size_t JoinMisses{};
+  /// How often the table was flushed, because it exceeded its size limit
+  size_t NumFlushes{};
+};
+
+/// A memo table for the results of composing and joining edge functions.
+///
+/// The keys are compared by edge-function identity (see
+/// EdgeFunction::referenceEquals()), so lookups never call operator== of the
+/// concrete edge functions. Edge functions that are allocated within an
+/// EdgeFunctionSingletonCache are unique by construction, so for them identity
+/// coincides with equality.
+///
+/// The table holds references to its keys and values to prevent the addresses
+/// of dead edge functions from being reused for new ones. To bound the memory
+/// consumption, the table is flushed as soon as it holds more than MaxSize
+/// entries (per operation). Hence, make sure that all
+/// EdgeFunctionSingletonCaches used by the memoized edge functions outlive this
+/// table.
+///
+/// This table is thread-safe.
+template <typename L> class EdgeFunctionMemoTable {
+public:
+  static constexpr size_t DefaultMaxSize = size_t(1) << 20;
+
+  explicit EdgeFunctionMemoTable(size_t MaxSize = DefaultMaxSize) noexcept
+      : MaxSize(MaxSize) {}
+
+  EdgeFunctionMemoTable(const EdgeFunctionMemoTable &) = delete;
+  EdgeFunctionMemoTable &operator=(const EdgeFunctionMemoTable &) = delete;
+  EdgeFunctionMemoTable(EdgeFunctionMemoTable &&) = delete;
+  EdgeFunctionMemoTable &operator=(EdgeFunctionMemoTable &&) = delete;
+  ~EdgeFunctionMemoTable() = default;
+
+  /// Returns the memoized result of Compose(F, G), or computes it and memoizes
+  /// the result if not found. Compose must be deterministic.
+  template <typename ComposeFn>
+  [[nodiscard]] EdgeFunction<L> compose(const EdgeFunction<L> &F,
+                                        const EdgeFunction<L> &G,
+                                        ComposeFn &&Compose) {
+    return getOrCompute(ComposeTable, ComposeHits, ComposeMisses, F, G,
+                        std::forward<ComposeFn>(Compose));
+  }
+
+  /// Returns the memoized result of Join(F, G), or computes it and memoizes
+  /// the result if not found. Join must be deterministic.
+  template <typename JoinFn>
+  [[nodiscard]] EdgeFunction<L> join(const EdgeFunction<L> &F,
+                                     const EdgeFunction<L> &G, JoinFn &&Join) {
+    return getOrCompute(JoinTable, JoinHits, JoinMisses, F, G,
+                        std::forward<JoinFn>(Join));
+  }
+
+  [[nodiscard]] EdgeFunctionMemoStats getStats() const noexcept {
+    return {
+        ComposeHits.load(std::memory_order_relaxed),
+        ComposeMisses.load(std::memory_order_relaxed),
+        JoinHits.load(std::memory_order_relaxed),
+        JoinMisses.load(std::memory_order_relaxed),
+        NumFlushes.load(std::memory_order_relaxed),
+    };
+  }
+
+  [[nodiscard]] size_t getMaxSize() const noexcept { return MaxSize; }
+
+  [[nodiscard]] size_t size() const {
+    std::shared_lock Lck(Mtx);
+    return ComposeTable.size() + JoinTable.size();
+  }
+
+  void clear() {
+    std::lock_guard Lck(Mtx);
+    ComposeTable.clear();
+    JoinTable.clear();
+  }
+
+private:
+  using KeyT = std::pair<EdgeFunction<L>, EdgeFunction<L>>;
+
+  struct KeyInfo {
+    static KeyT getEmptyKey() noexcept {
+      return {EdgeFunction<L>::getEmptyKey(), nullptr};
+    }
+    static KeyT getTombstoneKey() noexcept {
+      return {EdgeFunction<L>::getTombstoneKey(), nullptr};
+    }
+    static unsigned getHashValue(const KeyT &Key) noexcept {
+      return llvm::hash_combine(Key.first.getReferenceHashCode(),
+                                Key.second.getReferenceHashCode());
+    }
+    static bool isEqual(const KeyT &LHS, const KeyT &RHS) noexcept {
+      return LHS.first.referenceEquals(RHS.first) &&
+             LHS.second.referenceEquals(RHS.second);
+    }
+  };
+
+  using TableT = llvm::DenseMap<KeyT, EdgeFunction<L>, KeyInfo>;
+
+  template <typename Fn>
+  EdgeFunction<L> getOrCompute(TableT &Table, std::atomic_size_t &Hits,
+                               std::atomic_size_t &Misses,
+                               const EdgeFunction<L> &F,
+                               const EdgeFunction<L> &G, Fn &&Compute) {
+    KeyT Key{F, G};
+    {
+      std::shared_lock Lck(Mtx);
+      if (auto It = Table.find(Key); It != Table.end()) {
+        Hits.fetch_add(1, std::memory_order_relaxed);
+        return It->second;
+      }
+    }
+
+    // Compute outside of the lock; Compute may be expensive and recursive
+    auto Ret = std::invoke(std::forward<Fn>(Compute), F, G);
+
+    Misses.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard Lck(Mtx);
+    if (Table.size() >= MaxSize) {
+      Table.clear();
+      NumFlushes.fetch_add(1, std::memory_order_relaxed);
+    }
+    Table.try_emplace(std::move(Key), Ret);
+    return Ret;
+  }
+
+  TableT ComposeTable;
+  TableT JoinTable;
+  std::atomic_size_t ComposeHits{};
+  std::atomic_size_t ComposeMisses{};
+  std::atomic_size_t JoinHits{};
+  std::atomic_size_t JoinMisses{};
+  std::atomic_size_t NumFlushes{};
+  size_t MaxSize{};
+  mutable std::shared_mutex Mtx;
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONMEMOTABLE_H
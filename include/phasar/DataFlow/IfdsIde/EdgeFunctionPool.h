@@ -0,0 +1,208 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONPOOL_H
+#define PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONPOOL_H
+
+#include "llvm/Support/Allocator.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace llvm {
+class raw_ostream;
+} // namespace llvm
+
+namespace psr {
+
+struct EdgeFunctionPoolStatistics {
+  /// Number of allocations served from the pool
+  size_t NumAllocations{};
+  /// Number of allocations that reused a previously freed block
+  size_t NumReused{};
+  /// Number of allocations that were too large for the pool and went to the
+  /// global heap instead
+  size_t NumOversized{};
+  /// Number of currently live blocks
+  size_t NumLive{};
+  /// Number of blocks that have been freed by a thread other than the owner
+  size_t NumRemoteFrees{};
+  /// Bytes reserved by the pool's slabs
+  size_t NumAllocatedBytes{};
+
+  friend llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                                       const EdgeFunctionPoolStatistics &S);
+};
+
+/// A size-class pool for heap-allocated edge functions.
+///
+/// Memory is carved from slabs and freed blocks are kept in per-size-class
+/// free-lists for reuse, so allocating and destroying edge functions does not
+/// hit the global allocator in the common case. All slabs are released in
+/// bulk when the pool is destroyed.
+///
+/// The pool has a single owner, i.e., the thread that first allocates from it.
+/// Only the owner may allocate, which is asserted. Edge functions allocated
+/// within the pool may still be copied to and destroyed on any thread, e.g.,
+/// by the worker threads of a parallel post-processing: Blocks freed by other
+/// threads go to a lock-free remote free-list that the owner adopts once its
+/// own free-list runs empty. Neither path takes a lock.
+///
+/// The pool does not track its edge functions beyond that, so it must outlive
+/// all edge functions allocated within it. The IDESolver therefore destroys
+/// its pool after all of its other members.
+///
+/// While an EdgeFunctionPool::Scope is active, EdgeFunction allocates all
+/// non-small-object-optimized and non-cached edge functions from the pool
+/// with AllocationPolicy::PoolAllocated.
+class EdgeFunctionPool {
+public:
+  static constexpr size_t SizeClassGranularity = alignof(std::max_align_t);
+  static constexpr size_t MaxPooledSize = 256;
+
+  /// Makes Pool the active pool of the current thread for the lifetime of
+  /// this object. Does nothing, if Pool is nullptr.
+  class [[nodiscard]] Scope {
+  public:
+    explicit Scope(EdgeFunctionPool *Pool) noexcept : Prev(Current) {
+      if (Pool) {
+        Current = Pool;
+      }
+    }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    Scope(Scope &&) = delete;
+    Scope &operator=(Scope &&) = delete;
+
+    ~Scope() { Current = Prev; }
+
+  private:
+    EdgeFunctionPool *Prev;
+  };
+
+  EdgeFunctionPool() noexcept = default;
+
+  EdgeFunctionPool(const EdgeFunctionPool &) = delete;
+  EdgeFunctionPool &operator=(const EdgeFunctionPool &) = delete;
+  EdgeFunctionPool(EdgeFunctionPool &&) = delete;
+  EdgeFunctionPool &operator=(EdgeFunctionPool &&) = delete;
+
+  ~EdgeFunctionPool();
+
+  /// The pool that is active for the current thread, or nullptr.
+  [[nodiscard]] static EdgeFunctionPool *current() noexcept { return Current; }
+
+  /// Allocates a block of at least Size bytes aligned to Align. Must only be
+  /// called by the owner.
+  [[nodiscard]] void *allocate(size_t Size, size_t Align) {
+    if (Owner == std::thread::id()) {
+      Owner = std::this_thread::get_id();
+    }
+    assert(isOwner() && "Only the owner may allocate from an EdgeFunctionPool");
+
+    if (Size > MaxPooledSize || Align > SizeClassGranularity) {
+      ++NumOversized;
+      return ::operator new(Size, std::align_val_t(Align));
+    }
+
+    ++NumAllocations;
+    auto SizeClass = getSizeClass(Size);
+    auto &Head = FreeLists[SizeClass];
+    if (!Head) {
+      Head = RemoteFreeLists[SizeClass].exchange(nullptr,
+                                                 std::memory_order_acquire);
+    }
+    if (Head) {
+      ++NumReused;
+      return std::exchange(Head, Head->Next);
+    }
+
+    return Slabs.Allocate(SizeClass * SizeClassGranularity +
+                              SizeClassGranularity,
+                          llvm::Align(SizeClassGranularity));
+  }
+
+  /// Returns the block Ptr that has been allocated with the same Size and
+  /// Align to the pool. May be called by any thread.
+  void deallocate(void *Ptr, size_t Size, size_t Align) noexcept {
+    bool IsOwner = isOwner();
+    if (IsOwner) {
+      ++NumFrees;
+    } else {
+      NumRemoteFrees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (Size > MaxPooledSize || Align > SizeClassGranularity) {
+      ::operator delete(Ptr, std::align_val_t(Align));
+      return;
+    }
+
+    auto SizeClass = getSizeClass(Size);
+    if (IsOwner) {
+      auto &Head = FreeLists[SizeClass];
+      Head = new (Ptr) FreeNode{Head};
+      return;
+    }
+
+    auto &RemoteHead = RemoteFreeLists[SizeClass];
+    auto *Node = new (Ptr) FreeNode{RemoteHead.load(std::memory_order_relaxed)};
+    while (!RemoteHead.compare_exchange_weak(Node->Next, Node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+  }
+
+  /// Must only be called by the owner, or if no other thread currently uses
+  /// the pool.
+  [[nodiscard]] EdgeFunctionPoolStatistics getStatistics() const noexcept;
+
+private:
+  struct FreeNode {
+    FreeNode *Next;
+  };
+
+  static constexpr size_t NumSizeClasses = MaxPooledSize / SizeClassGranularity;
+
+  [[nodiscard]] static constexpr size_t getSizeClass(size_t Size) noexcept {
+    return (Size - 1) / SizeClassGranularity;
+  }
+
+  [[nodiscard]] bool isOwner() const noexcept {
+    return Owner == std::this_thread::get_id();
+  }
+
+  static inline thread_local EdgeFunctionPool *Current = nullptr;
+
+  /// Set by the first allocation. Other threads only read it in deallocate(),
+  /// after they have received an edge function allocated by the owner
+  std::thread::id Owner{};
+
+  /// Only accessed by the owner
+  llvm::BumpPtrAllocator Slabs;
+  std::array<FreeNode *, NumSizeClasses> FreeLists{};
+  size_t NumAllocations{};
+  size_t NumReused{};
+  size_t NumOversized{};
+  size_t NumFrees{};
+
+  /// Blocks freed by other threads. The owner takes each list as a whole, so
+  /// the pushes cannot suffer from ABA
+  std::array<std::atomic<FreeNode *>, NumSizeClasses> RemoteFreeLists{};
+  std::atomic_size_t NumRemoteFrees{};
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_IFDSIDE_EDGEFUNCTIONPOOL_H
@@ -24,7 +24,7 @@ enum class EdgeFunctionAllocationPolicy;
 namespace detail {
 struct EdgeFunctionStatsData {
   static constexpr size_t NumEFKinds = 5;
-  static constexpr size_t NumAllocPolicies = 3;
+  static constexpr size_t NumAllocPolicies = 4;
 
   std::array<size_t, NumEFKinds> UniqueEFCount{};
   std::array<size_t, NumEFKinds> TotalEFCount{};
@@ -41,6 +41,11 @@ struct EdgeFunctionStatsData {
   double AvgUniqueJFDepth{};
   double AvgJFObjDepth{};
   std::array<size_t, NumAllocPolicies> PerAllocJFCount{};
+
+  size_t MemoComposeHits{};
+  size_t MemoComposeMisses{};
+  size_t MemoJoinHits{};
+  size_t MemoJoinMisses{};
 };
 } // namespace detail
 
@@ -68,6 +73,19 @@ public:
     return PerAllocCount[size_t(Policy)]; // NOLINT
   }
 
+  /// The ratio of compose-operations answered by the EdgeFunctionMemoTable.
+  /// Zero, if memoization is disabled
+  [[nodiscard]] double getMemoComposeHitRate() const noexcept {
+    auto Total = MemoComposeHits + MemoComposeMisses;
+    return Total ? double(MemoComposeHits) / double(Total) : 0;
+  }
+  /// The ratio of join-operations answered by the EdgeFunctionMemoTable.
+  /// Zero, if memoization is disabled
+  [[nodiscard]] double getMemoJoinHitRate() const noexcept {
+    auto Total = MemoJoinHits + MemoJoinMisses;
+    return Total ? double(MemoJoinHits) / double(Total) : 0;
+  }
+
   friend llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
                                        const EdgeFunctionStats &S);
 
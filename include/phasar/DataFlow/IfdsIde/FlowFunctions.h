@@ -20,7 +20,10 @@
 #include "phasar/Utils/TypeTraits.h"
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
 
+#include <algorithm>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
@@ -64,6 +67,18 @@ public:
   // details.
   //
   virtual container_type computeTargets(D Source) = 0;
+
+  /// Same as computeTargets(), but appends the target facts to the
+  /// caller-provided buffer Targets instead of returning a freshly allocated
+  /// container. Each target fact is appended at most once. The IDESolver uses
+  /// this function on its hot paths.
+  ///
+  /// The default implementation delegates to computeTargets(). Override it if
+  /// the targets can be emitted without building a container first.
+  virtual void computeTargetsInto(D Source, llvm::SmallVectorImpl<D> &Targets) {
+    auto Ret = computeTargets(std::move(Source));
+    Targets.append(Ret.begin(), Ret.end());
+  }
 };
 
 /// Helper template to check at compile-time whether a type implements the
@@ -116,6 +131,18 @@ public:
     }
     return Delegate->computeTargets(std::move(Source));
   }
+  void computeTargetsInto(D Source,
+                          llvm::SmallVectorImpl<D> &Targets) override {
+    if (Source == ZeroValue) {
+      auto Offset = Targets.size();
+      Delegate->computeTargetsInto(Source, Targets);
+      if (!llvm::is_contained(llvm::drop_begin(Targets, Offset), ZeroValue)) {
+        Targets.push_back(ZeroValue);
+      }
+      return;
+    }
+    Delegate->computeTargetsInto(std::move(Source), Targets);
+  }
 
 private:
   FlowFunctionPtrType Delegate;
@@ -165,6 +192,10 @@ public:
       container_type computeTargets(d_t Source) override {
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        Targets.push_back(std::move(Source));
+      }
     };
     static auto TheIdentity = std::make_shared<IdFF>();
 
@@ -186,11 +217,35 @@ public:
   ///          v  v   v   v  v
   ///          x1 x2  x  x3 x4
   ///
+  /// Instead of returning the targets, F may also append them to a
+  /// llvm::SmallVectorImpl<d_t> that it gets as second argument, each target
+  /// at most once. Then, computeTargetsInto() does not need to build a
+  /// container_type at all.
   template <typename Fn> static auto lambdaFlow(Fn &&F) {
     struct LambdaFlow final : public FlowFunction<d_t, container_type> {
+      static constexpr bool IsSink =
+          std::is_invocable_v<std::decay_t<Fn> &, d_t,
+                              llvm::SmallVectorImpl<d_t> &>;
+
       LambdaFlow(Fn &&F) : Flow(std::forward<Fn>(F)) {}
       container_type computeTargets(d_t Source) override {
-        return std::invoke(Flow, std::move(Source));
+        if constexpr (IsSink) {
+          llvm::SmallVector<d_t> Targets;
+          std::invoke(Flow, std::move(Source), Targets);
+          return detail::makeContainer<container_type>(Targets);
+        } else {
+          return std::invoke(Flow, std::move(Source));
+        }
+      }
+
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if constexpr (IsSink) {
+          std::invoke(Flow, std::move(Source), Targets);
+        } else {
+          auto &&Facts = std::invoke(Flow, std::move(Source));
+          Targets.append(Facts.begin(), Facts.end());
+        }
       }
 
       [[no_unique_address]] std::decay_t<Fn> Flow;
@@ -235,6 +290,13 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (Source == FromValue && !(Source == GenValue)) {
+          Targets.push_back(GenValue);
+        }
+        Targets.push_back(std::move(Source));
+      }
 
       d_t GenValue;
       d_t FromValue;
@@ -267,6 +329,13 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (std::invoke(Predicate, Source) && !(Source == GenValue)) {
+          Targets.push_back(GenValue);
+        }
+        Targets.push_back(std::move(Source));
+      }
 
       d_t GenValue;
       [[no_unique_address]] std::decay_t<Fn> Predicate;
@@ -307,6 +376,16 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (Source == FromValue) {
+          Targets.append(GenValues.begin(), GenValues.end());
+          if (GenValues.count(Source)) {
+            return;
+          }
+        }
+        Targets.push_back(std::move(Source));
+      }
 
       container_type GenValues;
       d_t FromValue;
@@ -344,6 +423,12 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (!(Source == KillValue)) {
+          Targets.push_back(std::move(Source));
+        }
+      }
       d_t KillValue;
     };
 
@@ -370,6 +455,12 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (!std::invoke(Predicate, Source)) {
+          Targets.push_back(std::move(Source));
+        }
+      }
 
       [[no_unique_address]] std::decay_t<Fn> Predicate;
     };
@@ -408,6 +499,12 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (!KillValues.count(Source)) {
+          Targets.push_back(std::move(Source));
+        }
+      }
 
       container_type KillValues;
     };
@@ -424,6 +521,9 @@ public:
   static auto killAllFlows() {
     struct KillAllFF final : public FlowFunction<d_t, container_type> {
       Container computeTargets(d_t /*Source*/) override { return Container(); }
+      void
+      computeTargetsInto(d_t /*Source*/,
+                         llvm::SmallVectorImpl<d_t> & /*Targets*/) override {}
     };
     static auto TheKillAllFlow = std::make_shared<KillAllFF>();
 
@@ -466,6 +566,15 @@ public:
         }
         return {};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (Source == FromValue) {
+          if (!(Source == GenValue)) {
+            Targets.push_back(GenValue);
+          }
+          Targets.push_back(std::move(Source));
+        }
+      }
 
       d_t GenValue;
       d_t FromValue;
@@ -509,6 +618,15 @@ public:
         }
         return {};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (Source == FromValue) {
+          Targets.append(GenValues.begin(), GenValues.end());
+          if (!GenValues.count(Source)) {
+            Targets.push_back(std::move(Source));
+          }
+        }
+      }
 
       container_type GenValues;
       d_t FromValue;
@@ -560,6 +678,17 @@ public:
         }
         return {std::move(Source)};
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        if (Source == FromValue) {
+          if (!(Source == GenValue)) {
+            Targets.push_back(GenValue);
+          }
+          Targets.push_back(std::move(Source));
+        } else if (!(Source == GenValue)) {
+          Targets.push_back(std::move(Source));
+        }
+      }
 
       d_t GenValue;
       d_t FromValue;
@@ -601,6 +730,24 @@ public:
                       std::make_move_iterator(OtherRet.end()));
         return OneRet;
       }
+      void computeTargetsInto(d_t Source,
+                              llvm::SmallVectorImpl<d_t> &Targets) override {
+        auto Offset = Targets.size();
+        OneFF->computeTargetsInto(Source, Targets);
+        auto OtherOffset = Targets.size();
+        OtherFF->computeTargetsInto(std::move(Source), Targets);
+
+        // Remove the duplicates
+        auto OneRange = llvm::make_range(Targets.begin() + Offset,
+                                         Targets.begin() + OtherOffset);
+        Targets.erase(std::remove_if(Targets.begin() + OtherOffset,
+                                     Targets.end(),
+                                     [OneRange](const d_t &Fact) {
+                                       return llvm::is_contained(OneRange,
+                                                                 Fact);
+                                     }),
+                      Targets.end());
+      }
 
       FlowFunctionPtrTypeOf<F1> OneFF;
       FlowFunctionPtrTypeOf<F2> OtherFF;
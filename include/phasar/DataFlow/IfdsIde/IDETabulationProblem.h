@@ -105,6 +105,24 @@ public:
     return FlowFact == *ZeroValue;
   }
 
+  /// Checks whether the given instruction may affect the given data-flow fact.
+  /// Used by the solver in sparse mode (IFDSIDESolverConfig::sparse()) to
+  /// propagate facts directly to the next relevant instructions.
+  ///
+  /// Returning false is only valid, if for all successors of Inst the normal
+  /// flow function of Inst maps Fact to exactly {Fact} and the corresponding
+  /// normal edge function is the identity. In particular, this excludes
+  /// instructions that generate facts from Fact, e.g., from the zero value.
+  /// Call-sites, exit- and start points, seeds and unbalanced return sites are
+  /// always treated as relevant by the solver.
+  ///
+  /// The solver neither creates jump functions nor path edges for a fact at an
+  /// instruction that is irrelevant for it. Hence, its results do not contain
+  /// the fact there and IDESolver::getNumPathEdges() does not count it.
+  [[nodiscard]] virtual bool isRelevant(n_t /*Inst*/, d_t /*Fact*/) const {
+    return true;
+  }
+
   /// Returns initial seeds to be used for the analysis. This is a mapping of
   /// statements to initial analysis facts.
   [[nodiscard]] virtual InitialSeeds<n_t, d_t, l_t> initialSeeds() = 0;
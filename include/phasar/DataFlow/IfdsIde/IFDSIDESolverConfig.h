@@ -19,6 +19,7 @@
 
 #include "phasar/Utils/EnumFlags.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace llvm {
@@ -35,6 +36,9 @@ enum class SolverConfigOptions : uint32_t {
   RecordEdges = 8,
   EmitESG = 16,
   ComputePersistedSummaries = 32,
+  MemoizeEdgeFunctions = 64,
+  PoolEdgeFunctions = 128,
+  Sparse = 256,
 
   All = ~0U
 };
@@ -49,6 +53,26 @@ struct IFDSIDESolverConfig {
   [[nodiscard]] bool recordEdges() const;
   [[nodiscard]] bool emitESG() const;
   [[nodiscard]] bool computePersistedSummaries() const;
+  [[nodiscard]] bool memoizeEdgeFunctions() const;
+  /// Whether the solver allocates heap-allocated edge functions from a
+  /// solver-scoped EdgeFunctionPool instead of the global heap
+  [[nodiscard]] bool poolEdgeFunctions() const;
+  /// Whether the solver skips over statements that the problem declares
+  /// irrelevant for a fact, see IDETabulationProblem::isRelevant(). Has no
+  /// effect, if recordEdges() or emitESG() is set.
+  [[nodiscard]] bool sparse() const;
+  /// The maximum number of entries per memo table (compose/join), if
+  /// memoizeEdgeFunctions() is enabled. The tables are flushed once they
+  /// exceed this limit.
+  [[nodiscard]] size_t edgeFunctionMemoTableSize() const noexcept {
+    return EdgeFunctionMemoTableSize;
+  }
+  /// The maximum number of cached (statement, fact) entries for the next
+  /// relevant statements, if sparse() is enabled. The cache is flushed once
+  /// it exceeds this limit.
+  [[nodiscard]] size_t sparseSuccessorCacheSize() const noexcept {
+    return SparseSuccessorCacheSize;
+  }
 
   void setFollowReturnsPastSeeds(bool Set = true);
   void setAutoAddZero(bool Set = true);
@@ -56,6 +80,15 @@ struct IFDSIDESolverConfig {
   void setRecordEdges(bool Set = true);
   void setEmitESG(bool Set = true);
   void setComputePersistedSummaries(bool Set = true);
+  void setMemoizeEdgeFunctions(bool Set = true);
+  void setPoolEdgeFunctions(bool Set = true);
+  void setSparse(bool Set = true);
+  void setEdgeFunctionMemoTableSize(size_t Size) noexcept {
+    EdgeFunctionMemoTableSize = Size;
+  }
+  void setSparseSuccessorCacheSize(size_t Size) noexcept {
+    SparseSuccessorCacheSize = Size;
+  }
 
   void setConfig(SolverConfigOptions Opt);
 
@@ -65,6 +98,8 @@ struct IFDSIDESolverConfig {
 private:
   SolverConfigOptions Options =
       SolverConfigOptions::AutoAddZero | SolverConfigOptions::ComputeValues;
+  size_t EdgeFunctionMemoTableSize = size_t(1) << 20;
+  size_t SparseSuccessorCacheSize = size_t(1) << 20;
 };
 
 } // namespace psr
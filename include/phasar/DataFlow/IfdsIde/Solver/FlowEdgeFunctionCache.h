@@ -189,6 +189,39 @@ public:
   FlowEdgeFunctionCache &
   operator=(FlowEdgeFunctionCache &&FEFC) noexcept = default;
 
+  /// Calls the handlers for the keys of all cached call-, return- and
+  /// call-to-return flow functions, i.e., with (CallSite, DestFun),
+  /// (CallSite, CalleeFun, ExitInst, RetSite) and (CallSite, RetSite)
+  /// respectively. The keys of the normal flow functions are not available,
+  /// as they are compressed.
+  template <typename CallHandlerFn, typename RetHandlerFn,
+            typename CallToRetHandlerFn>
+  void foreachInterproceduralFlowFunctionKey(
+      CallHandlerFn CallHandler, RetHandlerFn RetHandler,
+      CallToRetHandlerFn CallToRetHandler) const {
+    for (const auto &[Key, FF] : CallFlowFunctionCache) {
+      std::apply(CallHandler, Key);
+    }
+    for (const auto &[Key, FF] : ReturnFlowFunctionCache) {
+      std::apply(RetHandler, Key);
+    }
+    for (const auto &[Key, FF] : CallToRetFlowFunctionCache) {
+      std::apply(CallToRetHandler, Key);
+    }
+  }
+
+  /// Drops all cached flow and edge functions. They are recomputed on demand.
+  void clear() noexcept {
+    NormalFunctionCache.clear();
+    CallFlowFunctionCache.clear();
+    ReturnFlowFunctionCache.clear();
+    CallToRetFlowFunctionCache.clear();
+    CallEdgeFunctionCache.clear();
+    ReturnEdgeFunctionCache.clear();
+    CallToRetEdgeFunctionCache.clear();
+    SummaryEdgeFunctionCache.clear();
+  }
+
   FlowFunctionPtrType getNormalFlowFunction(n_t Curr, n_t Succ) {
     assertNotNull(Curr);
     assertNotNull(Succ);
@@ -20,6 +20,8 @@
 #include "phasar/Config/Configuration.h"
 #include "phasar/DB/ProjectIRDBBase.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionMemoTable.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionPool.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunctionStats.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunctionUtils.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunctions.h"
@@ -30,30 +32,44 @@
 #include "phasar/DataFlow/IfdsIde/Solver/ESGEdgeKind.h"
 #include "phasar/DataFlow/IfdsIde/Solver/FlowEdgeFunctionCache.h"
 #include "phasar/DataFlow/IfdsIde/Solver/IDESolverAPIMixin.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolverCheckpointCodec.h"
 #include "phasar/DataFlow/IfdsIde/Solver/JumpFunctions.h"
 #include "phasar/DataFlow/IfdsIde/Solver/PathEdge.h"
 #include "phasar/DataFlow/IfdsIde/SolverResults.h"
 #include "phasar/Domain/AnalysisDomain.h"
 #include "phasar/Utils/Average.h"
+#include "phasar/Utils/Checkpoint.h"
 #include "phasar/Utils/DOTGraph.h"
+#include "phasar/Utils/ESGStreamWriter.h"
 #include "phasar/Utils/JoinLattice.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/PAMMMacros.h"
+#include "phasar/Utils/SpillFile.h"
 #include "phasar/Utils/Table.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/FunctionExtras.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -81,6 +97,10 @@ public:
   using t_t = typename AnalysisDomainTy::t_t;
   using v_t = typename AnalysisDomainTy::v_t;
 
+  static constexpr llvm::StringLiteral CheckpointMagic = "PSRCKP";
+  static constexpr uint8_t CheckpointVersion = 1;
+  static constexpr llvm::StringLiteral SpillMagic = "PSRSPL";
+
   IDESolver(IDETabulationProblem<AnalysisDomainTy, Container> &Problem,
             const i_t *ICF)
       : IDEProblem(Problem), ZeroValue(Problem.getZeroValue()), ICF(ICF),
@@ -89,6 +109,13 @@ public:
         JumpFn(std::make_shared<JumpFunctions<AnalysisDomainTy, Container>>()),
         Seeds(Problem.initialSeeds()) {
     assert(ICF != nullptr);
+    if (SolverConfig.memoizeEdgeFunctions()) {
+      EFMemo = std::make_unique<EdgeFunctionMemoTable<l_t>>(
+          SolverConfig.edgeFunctionMemoTableSize());
+    }
+    if (SolverConfig.poolEdgeFunctions()) {
+      EFPool = std::make_unique<EdgeFunctionPool>();
+    }
   }
 
   IDESolver(const IDESolver &) = delete;
@@ -164,6 +191,21 @@ public:
     return getSolverResults().resultsAt(Stmt, StripZero);
   }
 
+  /// Returns a range over the (fact, value) pairs at the given statement
+  /// without copying them. The artificial zero value can be automatically
+  /// stripped. The range is invalidated when the solver is destroyed or
+  /// continues solving.
+  [[nodiscard]] auto resultsAtView(n_t Stmt, bool StripZero = false) {
+    return getSolverResults().resultsAtView(Stmt, StripZero);
+  }
+
+  /// Calls Handler(n, d, l) for all computed results without copying them.
+  template <typename HandlerFn>
+  void foreachResult(HandlerFn &&Handler, bool StripZero = false) {
+    getSolverResults().foreachResult(std::forward<HandlerFn>(Handler),
+                                     StripZero);
+  }
+
   /// Returns the data-flow results at the given statement while respecting
   /// LLVM's SSA semantics.
   ///
@@ -259,6 +301,434 @@ public:
                                               std::move(ZeroValue));
   }
 
+  /// Encodes the state of the solver's first phase into a checkpoint, from
+  /// which restoreCheckpoint() can resume solving, possibly in another
+  /// process. The checkpoint contains the worklist, the jump functions, the
+  /// end-summary and incoming tables, the unbalanced return sites and the keys
+  /// of the cached call-, return- and call-to-return flow functions. The
+  /// information that is only recorded for emitting the ESG is not included.
+  ///
+  /// The statements, facts, functions and edge functions are encoded with
+  /// Codec; see IDESolverCheckpointCodec.h.
+  ///
+  /// May only be called while the solver is paused in phase I, i.e., after
+  /// initialize() and before finalize(). The entries of spilled functions (see
+  /// enableMemoryBudget()) are copied from the spill file as they are, without
+  /// faulting them back in. Hence, Codec must encode the entities in the same
+  /// way as the codec that has been passed to enableMemoryBudget().
+  ///
+  /// \returns The encoded checkpoint or std::nullopt, if Codec failed to
+  /// encode any part of the state.
+  template <typename CodecT>
+  [[nodiscard]] std::optional<std::string> createCheckpoint(CodecT &Codec) {
+    CheckpointEncoder Enc(CheckpointMagic, CheckpointVersion);
+    auto IsZero = [this](d_t Fact) { return IDEProblem.isZeroValue(Fact); };
+    detail::CheckpointEntityEncoder<AnalysisDomainTy, CodecT> Entities(
+        Enc, Codec, IsZero);
+
+    Entities.writeRecord('P', {PathEdgeCount});
+
+    for (const auto &[Edge, EF] : WorkList) {
+      auto [SourceVal, Target, TargetVal] = Edge.get();
+      auto D1 = Entities.fact(SourceVal);
+      auto N = Entities.node(Target);
+      auto D2 = Entities.fact(TargetVal);
+      Entities.writeRecord('W', {D1, N, D2, Entities.edgeFunction(EF)});
+    }
+
+    JumpFn->foreachJumpFunction([&](ByConstRef<d_t> SourceVal,
+                                    ByConstRef<n_t> Target,
+                                    ByConstRef<d_t> TargetVal,
+                                    const EdgeFunction<l_t> &EF) {
+      encodeJumpFunction(Entities, SourceVal, Target, TargetVal, EF);
+    });
+
+    EndsummaryTab.foreachCell(
+        [&](ByConstRef<n_t> SP, ByConstRef<d_t> D1, const auto &Summaries) {
+          encodeEndSummaries(Entities, SP, D1, Summaries);
+        });
+
+    IncomingTab.foreachCell(
+        [&](ByConstRef<n_t> SP, ByConstRef<d_t> D3, const auto &CallSites) {
+          auto SPId = Entities.node(SP);
+          auto D3Id = Entities.fact(D3);
+          for (const auto &[CallSite, Facts] : CallSites) {
+            auto CSId = Entities.node(CallSite);
+            llvm::SmallVector<uint64_t> FactIdsAtCS;
+            for (const auto &D2 : Facts) {
+              FactIdsAtCS.push_back(Entities.fact(D2));
+            }
+            Entities.writeRecord('I', {SPId, D3Id, CSId, FactIdsAtCS.size()});
+            for (auto D2Id : FactIdsAtCS) {
+              Enc.writeNumber(D2Id);
+            }
+          }
+        });
+
+    for (const auto &RetSite : UnbalancedRetSites) {
+      Entities.writeRecord('U', {Entities.node(RetSite)});
+    }
+
+    if (Spill) {
+      for (const auto &[Fun, Seg] : Spill->Spilled) {
+        auto Buffer = Spill->File.read(Seg);
+        if (!Buffer) {
+          PHASAR_LOG_LEVEL(ERROR, "[createCheckpoint]: Cannot read from the "
+                                  "spill file '"
+                                      << Spill->File.getPath() << "': "
+                                      << Buffer.getError().message());
+          return std::nullopt;
+        }
+        Entities.writeRecord('F', {Entities.function(Fun)});
+        Enc.writeBytes((*Buffer)->getBuffer());
+      }
+    }
+
+    CachedFlowEdgeFunctions.foreachInterproceduralFlowFunctionKey(
+        [&](ByConstRef<n_t> CallSite, ByConstRef<f_t> DestFun) {
+          auto CS = Entities.node(CallSite);
+          Entities.writeRecord('C', {CS, Entities.function(DestFun)});
+        },
+        [&](ByConstRef<n_t> CallSite, ByConstRef<f_t> CalleeFun,
+            ByConstRef<n_t> ExitInst, ByConstRef<n_t> RetSite) {
+          auto CS = Entities.node(CallSite);
+          auto Callee = Entities.function(CalleeFun);
+          auto Exit = Entities.node(ExitInst);
+          Entities.writeRecord('R', {CS, Callee, Exit, Entities.node(RetSite)});
+        },
+        [&](ByConstRef<n_t> CallSite, ByConstRef<n_t> RetSite) {
+          auto CS = Entities.node(CallSite);
+          Entities.writeRecord('T', {CS, Entities.node(RetSite)});
+        });
+
+    Enc.writeTag('Z');
+    if (Entities.failed()) {
+      PHASAR_LOG_LEVEL(ERROR, "[createCheckpoint]: Cannot encode the state");
+      return std::nullopt;
+    }
+    PHASAR_LOG_LEVEL(INFO, "Created a checkpoint of " << Enc.size()
+                                                      << " bytes");
+    return std::move(Enc).take();
+  }
+
+  /// Restores the solver state from a checkpoint that has been created by
+  /// createCheckpoint() for the same analysis problem on the same program.
+  /// Call this on a fresh solver instead of initialize() and resume solving
+  /// with continueSolving() or any other of the continue* functions.
+  ///
+  /// The functions that have been spilled when the checkpoint was created stay
+  /// spilled, if enableMemoryBudget() has been called before. Otherwise, their
+  /// entries are restored into memory.
+  ///
+  /// \returns True, iff the checkpoint could be decoded with Codec. If not,
+  /// the solver is left in an unspecified state.
+  template <typename CodecT>
+  [[nodiscard]] bool restoreCheckpoint(llvm::StringRef Buffer, CodecT &Codec) {
+    auto DecOrErr =
+        CheckpointDecoder::create(Buffer, CheckpointMagic, CheckpointVersion);
+    if (!DecOrErr) {
+      PHASAR_LOG_LEVEL(ERROR, "[restoreCheckpoint]: Not a valid checkpoint");
+      return false;
+    }
+    auto &Dec = *DecOrErr;
+
+    EdgeFunctionPool::Scope PoolScope(EFPool.get());
+    beginPhaseI();
+    completeInitialSeeds();
+
+    detail::CheckpointEntityDecoder<AnalysisDomainTy, CodecT> Entities(
+        Dec, Codec, ZeroValue);
+
+    char Tag = 0;
+    while (!Entities.failed() && (Tag = Dec.nextTag()) != '\0' && Tag != 'Z') {
+      // The order of evaluation of function arguments is unspecified, so read
+      // every field into a variable of its own
+      switch (Tag) {
+      case 'P':
+        PathEdgeCount = Dec.readNumber();
+        break;
+      case 'W': {
+        auto D1 = Entities.fact();
+        auto N = Entities.node();
+        auto D2 = Entities.fact();
+        auto EF = Entities.edgeFunction();
+        if (!Entities.failed()) {
+          WorkList.emplace_back(PathEdge(std::move(D1), N, std::move(D2)),
+                                std::move(EF));
+        }
+        break;
+      }
+      case 'J':
+        decodeJumpFunction(Entities);
+        break;
+      case 'E':
+        decodeEndSummary(Entities);
+        break;
+      case 'I': {
+        auto SP = Entities.node();
+        auto D3 = Entities.fact();
+        auto CallSite = Entities.node();
+        auto NumFacts = Dec.readNumber();
+        for (uint64_t I = 0; I < NumFacts && !Entities.failed(); ++I) {
+          auto D2 = Entities.fact();
+          addIncoming(SP, D3, CallSite, std::move(D2));
+        }
+        break;
+      }
+      case 'U':
+        UnbalancedRetSites.insert(Entities.node());
+        break;
+      case 'F': {
+        auto Fun = Entities.function();
+        auto Entries = Dec.readBytes();
+        if (!Entities.failed() &&
+            !restoreSpilledFunction(Codec, std::move(Fun), Entries)) {
+          PHASAR_LOG_LEVEL(ERROR, "[restoreCheckpoint]: Cannot restore the "
+                                  "entries of a spilled function");
+          return false;
+        }
+        break;
+      }
+      // Re-populate the flow-function cache, such that the restored solver
+      // does not need to query the problem again for known call sites
+      case 'C': {
+        auto CallSite = Entities.node();
+        auto DestFun = Entities.function();
+        if (!Entities.failed()) {
+          std::ignore = CachedFlowEdgeFunctions.getCallFlowFunction(CallSite,
+                                                                   DestFun);
+        }
+        break;
+      }
+      case 'R': {
+        auto CallSite = Entities.node();
+        auto CalleeFun = Entities.function();
+        auto ExitInst = Entities.node();
+        auto RetSite = Entities.node();
+        if (!Entities.failed()) {
+          std::ignore = CachedFlowEdgeFunctions.getRetFlowFunction(
+              CallSite, CalleeFun, ExitInst, RetSite);
+        }
+        break;
+      }
+      case 'T': {
+        auto CallSite = Entities.node();
+        auto RetSite = Entities.node();
+        if (!Entities.failed()) {
+          const auto &Callees = ICF->getCalleesOfCallAt(CallSite);
+          std::ignore = CachedFlowEdgeFunctions.getCallToRetFlowFunction(
+              CallSite, RetSite, Callees);
+        }
+        break;
+      }
+      default:
+        PHASAR_LOG_LEVEL(ERROR, "[restoreCheckpoint]: Unknown record '"
+                                    << Tag << '\'');
+        return false;
+      }
+    }
+
+    if (Entities.failed() || Tag != 'Z') {
+      PHASAR_LOG_LEVEL(ERROR, "[restoreCheckpoint]: Invalid checkpoint");
+      return false;
+    }
+    PHASAR_LOG_LEVEL(INFO, "Restored a checkpoint with "
+                               << WorkList.size() << " pending path edges");
+    return true;
+  }
+
+  /// Enables solving within a memory budget: enforceMemoryBudget() spills the
+  /// jump functions and end summaries of cold functions to a file, from which
+  /// they are transparently faulted back in, once the solver reaches the
+  /// respective function again. The entries are encoded with Codec (see
+  /// IDESolverCheckpointCodec.h), which must outlive the solver.
+  ///
+  /// Usually, you want to use solveWithMemoryBudget() instead.
+  ///
+  /// \returns False, iff the spill file could not be created.
+  template <typename CodecT>
+  [[nodiscard]] bool enableMemoryBudget(CodecT &Codec,
+                                        MemoryBudgetConfig Config) {
+    auto File = SpillFile::create(Config.SpillDir);
+    if (!File) {
+      PHASAR_LOG_LEVEL(ERROR, "Cannot create the spill file: "
+                                  << File.getError().message());
+      return false;
+    }
+    Spill = std::make_unique<SpillState>(SpillState{
+        std::move(*File),
+        std::move(Config),
+        [&Codec](IDESolver &Solver, ByConstRef<f_t> Fun,
+                 CheckpointEncoder &Enc) {
+          return Solver.encodeSpilledFunction(Codec, Fun, Enc);
+        },
+        [&Codec](IDESolver &Solver, llvm::StringRef Buffer) {
+          return Solver.decodeSpilledFunction(Codec, Buffer);
+        },
+    });
+    return true;
+  }
+
+  /// Whether the heap usage exceeds the limit that has been passed to
+  /// enableMemoryBudget()
+  [[nodiscard]] bool isOverMemoryBudget() const {
+    return Spill && llvm::sys::Process::GetMallocUsage() > Spill->Config.Limit;
+  }
+
+  /// Starts a new period of the tracking, which functions are in use. If the
+  /// heap usage exceeds the budget, spills the functions that have not been
+  /// used within the last period, coldest first, until the heap usage drops
+  /// below the low watermark.
+  ///
+  /// May only be called while the solver is paused in phase I and has no
+  /// effect, unless enableMemoryBudget() has been called before.
+  ///
+  /// \returns The number of functions that have been spilled
+  size_t enforceMemoryBudget() {
+    if (!Spill) {
+      return 0;
+    }
+    auto CurrentPeriod = Spill->Period++;
+    if (!isOverMemoryBudget()) {
+      return 0;
+    }
+
+    llvm::SmallVector<std::pair<size_t, f_t>> Cold;
+    for (const auto &[Fun, LastUse] : Spill->LastUse) {
+      if (LastUse < CurrentPeriod && !Spill->Spilled.count(Fun) &&
+          !Spill->Unspillable.count(Fun)) {
+        Cold.emplace_back(LastUse, Fun);
+      }
+    }
+    std::stable_sort(Cold.begin(), Cold.end(),
+                     [](const auto &Lhs, const auto &Rhs) {
+                       return Lhs.first < Rhs.first;
+                     });
+
+    auto LowWatermark =
+        size_t(double(Spill->Config.Limit) * Spill->Config.LowWatermark);
+    size_t NumSpilled = 0;
+    for (const auto &[LastUse, Fun] : Cold) {
+      if (llvm::sys::Process::GetMallocUsage() <= LowWatermark) {
+        break;
+      }
+      NumSpilled += spillFunction(Fun);
+    }
+    PHASAR_LOG_LEVEL(INFO, "Spilled " << NumSpilled
+                                      << " cold functions to disk; "
+                                      << Spill->Spilled.size()
+                                      << " functions are spilled in total");
+    return NumSpilled;
+  }
+
+  /// Faults all spilled functions back in
+  void restoreSpilledFunctions() {
+    if (!Spill) {
+      return;
+    }
+    EdgeFunctionPool::Scope PoolScope(EFPool.get());
+    while (!Spill->Spilled.empty()) {
+      faultIn(Spill->Spilled.begin());
+    }
+  }
+
+  /// The number of functions whose jump functions and end summaries are
+  /// currently spilled to disk
+  [[nodiscard]] size_t getNumSpilledFunctions() const noexcept {
+    return Spill ? Spill->Spilled.size() : 0;
+  }
+
+  /// The number of times that the jump functions and end summaries of a
+  /// spilled function have been faulted back in
+  [[nodiscard]] size_t getNumFaultedInFunctions() const noexcept {
+    return Spill ? Spill->NumFaultedIn : 0;
+  }
+
+  /// The number of path edges that have been processed in phase I. In sparse
+  /// mode, the solver does not create path edges at statements that are
+  /// irrelevant for their target fact, so these are not counted.
+  [[nodiscard]] size_t getNumPathEdges() const noexcept {
+    return PathEdgeCount;
+  }
+
+  /// Calls Handler for every data-flow fact that the solver refers to, except
+  /// for the facts within the cached flow and edge functions; call
+  /// clearFlowEdgeFunctionCaches() to drop those. Spilled functions (see
+  /// enableMemoryBudget()) only refer to encoded facts. Subclasses that store
+  /// facts of their own report them via foreachAdditionalLiveFact().
+  ///
+  /// Together, this allows an analysis to reclaim the memory of facts that
+  /// are not used anymore, while the solver is paused, e.g., between two
+  /// calls to nextN(), or after it has finished.
+  template <typename HandlerFn> void foreachLiveFact(HandlerFn Handler) const {
+    Handler(ZeroValue);
+    for (const auto &[Edge, EF] : WorkList) {
+      Handler(Edge.factAtSource());
+      Handler(Edge.factAtTarget());
+    }
+    for (const auto &[Node, Fact] : ValuePropWL) {
+      Handler(Fact);
+    }
+    for (const auto &[Node, FactsAndValues] : Seeds.getSeeds()) {
+      for (const auto &[Fact, Value] : FactsAndValues) {
+        Handler(Fact);
+      }
+    }
+    JumpFn->foreachJumpFunction(
+        [&Handler](ByConstRef<d_t> SourceVal, ByConstRef<n_t> /*Target*/,
+                   ByConstRef<d_t> TargetVal,
+                   const EdgeFunction<l_t> & /*EF*/) {
+          Handler(SourceVal);
+          Handler(TargetVal);
+        });
+    EndsummaryTab.foreachCell(
+        [&Handler](ByConstRef<n_t> /*SP*/, ByConstRef<d_t> D1,
+                   const auto &Summaries) {
+          Handler(D1);
+          Summaries.foreachCell(
+              [&Handler](ByConstRef<n_t> /*EP*/, ByConstRef<d_t> D2,
+                         const EdgeFunction<l_t> & /*EF*/) { Handler(D2); });
+        });
+    IncomingTab.foreachCell([&Handler](ByConstRef<n_t> /*SP*/,
+                                       ByConstRef<d_t> D3,
+                                       const auto &CallSites) {
+      Handler(D3);
+      for (const auto &[CallSite, Facts] : CallSites) {
+        for (const auto &D2 : Facts) {
+          Handler(D2);
+        }
+      }
+    });
+    auto HandleComputedEdges = [&Handler](ByConstRef<n_t> /*From*/,
+                                          ByConstRef<n_t> /*To*/,
+                                          const auto &Edges) {
+      for (const auto &[SourceVal, TargetVals] : Edges) {
+        Handler(SourceVal);
+        for (const auto &TargetVal : TargetVals) {
+          Handler(TargetVal);
+        }
+      }
+    };
+    ComputedIntraPathEdges.foreachCell(HandleComputedEdges);
+    ComputedInterPathEdges.foreachCell(HandleComputedEdges);
+    for (const auto &[Key, Count] : FSummaryReuse) {
+      Handler(Key.second);
+    }
+    ValTab.foreachCell(
+        [&Handler](ByConstRef<n_t> /*Node*/, ByConstRef<d_t> Fact,
+                   ByConstRef<l_t> /*Value*/) { Handler(Fact); });
+    foreachAdditionalLiveFact(
+        [&Handler](ByConstRef<d_t> Fact) { Handler(Fact); });
+  }
+
+  /// Drops the cached flow and edge functions, such that they do not refer
+  /// to any data-flow facts anymore. They are recomputed on demand.
+  void clearFlowEdgeFunctionCaches() {
+    CachedFlowEdgeFunctions.clear();
+    SparseSuccessors.clear();
+    NumSparseSuccessors = 0;
+  }
+
   [[nodiscard]] EdgeFunctionStats getEdgeFunctionStatistics() const {
     detail::EdgeFunctionStatsData Stats{};
 
@@ -327,6 +797,15 @@ public:
       Stats.AvgUniqueJFDepth = UniqueDepthSampler.getAverage();
       Stats.AvgJFObjDepth = AllocDepthSampler.getAverage();
     }
+
+    // Memoization
+    if (EFMemo) {
+      auto MemoStats = EFMemo->getStats();
+      Stats.MemoComposeHits = MemoStats.ComposeHits;
+      Stats.MemoComposeMisses = MemoStats.ComposeMisses;
+      Stats.MemoJoinHits = MemoStats.JoinHits;
+      Stats.MemoJoinMisses = MemoStats.JoinMisses;
+    }
     return Stats;
   }
 
@@ -334,6 +813,16 @@ public:
     OS << getEdgeFunctionStatistics() << '\n';
   }
 
+  /// Statistics of the solver's EdgeFunctionPool. Only available if
+  /// SolverConfig.poolEdgeFunctions() is set
+  [[nodiscard]] std::optional<EdgeFunctionPoolStatistics>
+  getEdgeFunctionPoolStatistics() const {
+    if (!EFPool) {
+      return std::nullopt;
+    }
+    return EFPool->getStatistics();
+  }
+
 protected:
   /// Lines 13-20 of the algorithm; processing a call site in the caller's
   /// context.
@@ -390,8 +879,10 @@ protected:
       if (SpecialSum) {
         HasNoCalleeInformation = false;
         PHASAR_LOG_LEVEL(DEBUG, "Found and process special summary");
+        llvm::SmallVector<d_t> Res;
         for (n_t ReturnSiteN : ReturnSiteNs) {
-          container_type Res = computeSummaryFlowFunction(SpecialSum, d1, d2);
+          Res.clear();
+          computeSummaryFlowFunction(SpecialSum, d1, d2, Res);
           INC_COUNTER("SpecialSummary-FF Application", 1, Full);
           ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
           saveEdges(n, ReturnSiteN, d2, Res, ESGEdgeKind::Summary);
@@ -406,7 +897,7 @@ protected:
             PHASAR_LOG_LEVEL(DEBUG,
                              "Compose: " << SumEdgFnE << " * " << f << '\n');
             WorkList.emplace_back(PathEdge(d1, ReturnSiteN, std::move(d3)),
-                                  IDEProblem.extend(f, SumEdgFnE));
+                                  extend(f, SumEdgFnE));
           }
         }
       } else {
@@ -414,7 +905,8 @@ protected:
         FlowFunctionPtrType Function =
             CachedFlowEdgeFunctions.getCallFlowFunction(n, SCalledProcN);
         INC_COUNTER("FF Queries", 1, Full);
-        container_type Res = computeCallFlowFunction(Function, d1, d2);
+        llvm::SmallVector<d_t> Res;
+        computeCallFlowFunction(Function, d1, d2, Res);
         ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
         // for each callee's start point(s)
         auto StartPointsOf = ICF->getStartPointsOf(SCalledProcN);
@@ -463,8 +955,9 @@ protected:
                     CachedFlowEdgeFunctions.getRetFlowFunction(n, SCalledProcN,
                                                                eP, RetSiteN);
                 INC_COUNTER("FF Queries", 1, Full);
-                const container_type ReturnedFacts = computeReturnFlowFunction(
-                    RetFunction, d3, d4, n, Container{d2});
+                llvm::SmallVector<d_t> ReturnedFacts;
+                computeReturnFlowFunction(RetFunction, d3, d4, n,
+                                          Container{d2}, ReturnedFacts);
                 ADD_TO_HISTOGRAM("Data-flow facts", ReturnedFacts.size(), 1,
                                  Full);
                 saveEdges(eP, RetSiteN, d4, ReturnedFacts, ESGEdgeKind::Ret);
@@ -498,15 +991,15 @@ protected:
                                                       << f4);
                   PHASAR_LOG_LEVEL(DEBUG,
                                    "         (return * calleeSummary * call)");
-                  EdgeFunction<l_t> fPrime = IDEProblem.extend(
-                      IDEProblem.extend(f4, fCalleeSummary), f5);
+                  EdgeFunction<l_t> fPrime =
+                      extend(extend(f4, fCalleeSummary), f5);
                   PHASAR_LOG_LEVEL(DEBUG, "       = " << fPrime);
                   d_t d5_restoredCtx = restoreContextOnReturnedFact(n, d2, d5);
                   // propagte the effects of the entire call
                   PHASAR_LOG_LEVEL(DEBUG, "Compose: " << fPrime << " * " << f);
                   WorkList.emplace_back(
                       PathEdge(d1, RetSiteN, std::move(d5_restoredCtx)),
-                      IDEProblem.extend(f, fPrime));
+                      extend(f, fPrime));
                 }
               }
             }
@@ -516,13 +1009,14 @@ protected:
     }
     // line 17-19 of Naeem/Lhotak/Rodriguez
     // process intra-procedural flows along call-to-return flow functions
+    llvm::SmallVector<d_t> ReturnFacts;
     for (n_t ReturnSiteN : ReturnSiteNs) {
       FlowFunctionPtrType CallToReturnFF =
           CachedFlowEdgeFunctions.getCallToRetFlowFunction(n, ReturnSiteN,
                                                            Callees);
       INC_COUNTER("FF Queries", 1, Full);
-      container_type ReturnFacts =
-          computeCallToReturnFlowFunction(CallToReturnFF, d1, d2);
+      ReturnFacts.clear();
+      computeCallToReturnFlowFunction(CallToReturnFF, d1, d2, ReturnFacts);
       ADD_TO_HISTOGRAM("Data-flow facts", ReturnFacts.size(), 1, Full);
       saveEdges(n, ReturnSiteN, d2, ReturnFacts,
                 HasNoCalleeInformation ? ESGEdgeKind::SkipUnknownFn
@@ -538,7 +1032,7 @@ protected:
               .push_back(EdgeFnE);
         }
         INC_COUNTER("EF Queries", 1, Full);
-        auto fPrime = IDEProblem.extend(f, EdgeFnE);
+        auto fPrime = extend(f, EdgeFnE);
         PHASAR_LOG_LEVEL(DEBUG, "Compose: " << EdgeFnE << " * " << f << " = "
                                             << fPrime);
         WorkList.emplace_back(PathEdge(d1, ReturnSiteN, std::move(d3)),
@@ -559,18 +1053,20 @@ protected:
     EdgeFunction<l_t> f = jumpFunction(Edge);
     auto [d1, n, d2] = Edge.consume();
 
+    llvm::SmallVector<d_t> Res;
     for (const auto nPrime : ICF->getSuccsOf(n)) {
       FlowFunctionPtrType FlowFunc =
           CachedFlowEdgeFunctions.getNormalFlowFunction(n, nPrime);
       INC_COUNTER("FF Queries", 1, Full);
-      const container_type Res = computeNormalFlowFunction(FlowFunc, d1, d2);
+      Res.clear();
+      computeNormalFlowFunction(FlowFunc, d1, d2, Res);
       ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
       saveEdges(n, nPrime, d2, Res, ESGEdgeKind::Normal);
       for (d_t d3 : Res) {
         EdgeFunction<l_t> g =
             CachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, nPrime, d3);
         PHASAR_LOG_LEVEL(DEBUG, "Queried Normal Edge Function: " << g);
-        EdgeFunction<l_t> fPrime = IDEProblem.extend(f, g);
+        EdgeFunction<l_t> fPrime = extend(f, g);
         if (SolverConfig.emitESG()) {
           IntermediateEdgeFunctions[std::make_tuple(n, d2, nPrime, d3)]
               .push_back(g);
@@ -608,11 +1104,14 @@ protected:
   void propagateValueAtCall(const std::pair<n_t, d_t> NAndD, n_t Stmt) {
     PAMM_GET_INSTANCE;
     d_t Fact = NAndD.second;
+    llvm::SmallVector<d_t> Targets;
     for (const f_t Callee : ICF->getCalleesOfCallAt(Stmt)) {
       FlowFunctionPtrType CallFlowFunction =
           CachedFlowEdgeFunctions.getCallFlowFunction(Stmt, Callee);
       INC_COUNTER("FF Queries", 1, Full);
-      for (const d_t dPrime : CallFlowFunction->computeTargets(Fact)) {
+      Targets.clear();
+      CallFlowFunction->computeTargetsInto(Fact, Targets);
+      for (const d_t dPrime : Targets) {
         EdgeFunction<l_t> EdgeFn = CachedFlowEdgeFunctions.getCallEdgeFunction(
             Stmt, Fact, Callee, dPrime);
         PHASAR_LOG_LEVEL(DEBUG, "Queried Call Edge Function: " << EdgeFn);
@@ -668,6 +1167,7 @@ protected:
   }
 
   EdgeFunction<l_t> jumpFunction(const PathEdge<n_t, d_t> Edge) {
+    touch(Edge.getTarget());
     IF_LOG_LEVEL_ENABLED(DEBUG, {
       PHASAR_LOG_LEVEL(DEBUG, "JumpFunctions Forward-Lookup:");
       PHASAR_LOG_LEVEL(DEBUG,
@@ -699,6 +1199,7 @@ protected:
     // note: at this point we don't need to join with a potential previous f
     // because f is a jump function, which is already properly joined
     // within propagate(..)
+    touch(SP);
     EndsummaryTab.get(SP, d1).insert(eP, d2, std::move(f));
   }
 
@@ -776,8 +1277,14 @@ protected:
     }
   }
 
+  /// Reports the data-flow facts that a subclass stores in addition to the
+  /// solver's own tables to foreachLiveFact(), such that they are not reclaimed
+  /// while still in use.
+  virtual void foreachAdditionalLiveFact(
+      llvm::function_ref<void(ByConstRef<d_t>)> /*Handler*/) const {}
+
   virtual void saveEdges(n_t SourceNode, n_t SinkStmt, d_t SourceVal,
-                         const container_type &DestVals, ESGEdgeKind Kind) {
+                         llvm::ArrayRef<d_t> DestVals, ESGEdgeKind Kind) {
     if (!SolverConfig.recordEdges()) {
       return;
     }
@@ -787,6 +1294,19 @@ protected:
                                                        DestVals.end());
   }
 
+  /// The solver only reports edges through the ArrayRef overload above. This
+  /// overload is kept for callers that pass a container_type and is final, such
+  /// that subclasses still overriding it fail to compile instead of silently
+  /// not being called anymore.
+  // NOLINTNEXTLINE(cppcoreguidelines-explicit-virtual-functions)
+  virtual void saveEdges(n_t SourceNode, n_t SinkStmt, d_t SourceVal,
+                         const container_type &DestVals,
+                         ESGEdgeKind Kind) final {
+    llvm::SmallVector<d_t> Dest(DestVals.begin(), DestVals.end());
+    saveEdges(std::move(SourceNode), std::move(SinkStmt), std::move(SourceVal),
+              llvm::ArrayRef<d_t>(Dest), Kind);
+  }
+
   void submitInitialValues() {
     std::map<n_t, std::map<d_t, l_t>> AllSeeds = Seeds.getSeeds();
     for (n_t UnbalancedRetSite : UnbalancedRetSites) {
@@ -836,18 +1356,7 @@ protected:
   /// their own. Normally, solve() should be called instead.
   void submitInitialSeeds() {
     PAMM_GET_INSTANCE;
-    // Check if the initial seeds contain the zero value at every starting
-    // point. If not, the zero value needs to be added to allow for correct
-    // solving of the problem.
-    for (const auto &[StartPoint, Facts] : Seeds.getSeeds()) {
-      if (Facts.find(ZeroValue) == Facts.end()) {
-        // Add zero value if it's not in the set of facts.
-        PHASAR_LOG_LEVEL(
-            DEBUG, "Zero-Value has been added automatically to start point: "
-                       << NToString(StartPoint));
-        Seeds.addSeed(StartPoint, ZeroValue, IDEProblem.bottomElement());
-      }
-    }
+    completeInitialSeeds();
     PHASAR_LOG_LEVEL(DEBUG,
                      "Number of initial seeds: " << Seeds.countInitialSeeds());
     PHASAR_LOG_LEVEL(DEBUG, "List of initial seeds: ");
@@ -875,6 +1384,21 @@ protected:
     }
   }
 
+  /// Check if the initial seeds contain the zero value at every starting
+  /// point. If not, the zero value needs to be added to allow for correct
+  /// solving of the problem.
+  void completeInitialSeeds() {
+    for (const auto &[StartPoint, Facts] : Seeds.getSeeds()) {
+      if (Facts.find(ZeroValue) == Facts.end()) {
+        // Add zero value if it's not in the set of facts.
+        PHASAR_LOG_LEVEL(
+            DEBUG, "Zero-Value has been added automatically to start point: "
+                       << NToString(StartPoint));
+        Seeds.addSeed(StartPoint, ZeroValue, IDEProblem.bottomElement());
+      }
+    }
+  }
+
   /// Lines 21-32 of the algorithm.
   ///
   /// Stores callee-side summaries.
@@ -919,9 +1443,11 @@ protected:
                 c, FunctionThatNeedsSummary, n, RetSiteC);
         INC_COUNTER("FF Queries", 1, Full);
         // for each incoming-call value
+        llvm::SmallVector<d_t> Targets;
         for (d_t d4 : Entry.second) {
-          const container_type Targets =
-              computeReturnFlowFunction(RetFunction, d1, d2, c, Entry.second);
+          Targets.clear();
+          computeReturnFlowFunction(RetFunction, d1, d2, c, Entry.second,
+                                    Targets);
           ADD_TO_HISTOGRAM("Data-flow facts", Targets.size(), 1, Full);
           saveEdges(n, RetSiteC, d2, Targets, ESGEdgeKind::Ret);
           // for each target value at the return site
@@ -950,11 +1476,11 @@ protected:
             PHASAR_LOG_LEVEL(DEBUG,
                              "Compose: " << f5 << " * " << f << " * " << f4);
             PHASAR_LOG_LEVEL(DEBUG, "         (return * function * call)");
-            EdgeFunction<l_t> fPrime =
-                IDEProblem.extend(IDEProblem.extend(f4, f), f5);
+            EdgeFunction<l_t> fPrime = extend(extend(f4, f), f5);
             PHASAR_LOG_LEVEL(DEBUG, "       = " << fPrime);
             // for each jump function coming into the call, propagate to
             // return site using the composed function
+            touch(c);
             auto RevLookupResult = JumpFn->reverseLookup(c, d4);
             if (RevLookupResult) {
               for (size_t I = 0; I < RevLookupResult->get().size(); ++I) {
@@ -966,7 +1492,7 @@ protected:
                   PHASAR_LOG_LEVEL(DEBUG, "Compose: " << fPrime << " * " << f3);
                   WorkList.emplace_back(PathEdge(std::move(d3), RetSiteC,
                                                  std::move(d5_restoredCtx)),
-                                        IDEProblem.extend(f3, fPrime));
+                                        extend(f3, fPrime));
                 }
               }
             }
@@ -990,8 +1516,9 @@ protected:
               CachedFlowEdgeFunctions.getRetFlowFunction(
                   Caller, FunctionThatNeedsSummary, n, RetSiteC);
           INC_COUNTER("FF Queries", 1, Full);
-          const container_type Targets = computeReturnFlowFunction(
-              RetFunction, d1, d2, Caller, Container{ZeroValue});
+          llvm::SmallVector<d_t> Targets;
+          computeReturnFlowFunction(RetFunction, d1, d2, Caller,
+                                    Container{ZeroValue}, Targets);
           ADD_TO_HISTOGRAM("Data-flow facts", Targets.size(), 1, Full);
           saveEdges(n, RetSiteC, d2, Targets, ESGEdgeKind::Ret);
           for (d_t d5 : Targets) {
@@ -1005,8 +1532,7 @@ protected:
             }
             INC_COUNTER("EF Queries", 1, Full);
             PHASAR_LOG_LEVEL(DEBUG, "Compose: " << f5 << " * " << f);
-            propagteUnbalancedReturnFlow(RetSiteC, d5, IDEProblem.extend(f, f5),
-                                         Caller);
+            propagteUnbalancedReturnFlow(RetSiteC, d5, extend(f, f5), Caller);
             // register for value processing (2nd IDE phase)
             UnbalancedRetSites.insert(RetSiteC);
           }
@@ -1060,29 +1586,32 @@ protected:
   /// @param flowFunction The normal flow function to compute
   /// @param d1 The abstraction at the method's start node
   /// @param d2 The abstraction at the current node
-  /// @return The set of abstractions at the successor node
+  /// @param Targets Receives the set of abstractions at the successor node
   ///
-  container_type computeNormalFlowFunction(const FlowFunctionPtrType &FlowFunc,
-                                           d_t /*d1*/, d_t d2) {
-    return FlowFunc->computeTargets(d2);
+  void computeNormalFlowFunction(const FlowFunctionPtrType &FlowFunc,
+                                 d_t /*d1*/, d_t d2,
+                                 llvm::SmallVectorImpl<d_t> &Targets) {
+    FlowFunc->computeTargetsInto(std::move(d2), Targets);
   }
 
-  container_type
+  void
   computeSummaryFlowFunction(const FlowFunctionPtrType &SummaryFlowFunction,
-                             d_t /*d1*/, d_t d2) {
-    return SummaryFlowFunction->computeTargets(d2);
+                             d_t /*d1*/, d_t d2,
+                             llvm::SmallVectorImpl<d_t> &Targets) {
+    SummaryFlowFunction->computeTargetsInto(std::move(d2), Targets);
   }
 
   /// Computes the call flow function for the given call-site abstraction
   /// @param callFlowFunction The call flow function to compute
   /// @param d1 The abstraction at the current method's start node.
   /// @param d2 The abstraction at the call site
-  /// @return The set of caller-side abstractions at the callee's start node
+  /// @param Targets Receives the set of caller-side abstractions at the
+  /// callee's start node
   ///
-  container_type
-  computeCallFlowFunction(const FlowFunctionPtrType &CallFlowFunction,
-                          d_t /*d1*/, d_t d2) {
-    return CallFlowFunction->computeTargets(d2);
+  void computeCallFlowFunction(const FlowFunctionPtrType &CallFlowFunction,
+                               d_t /*d1*/, d_t d2,
+                               llvm::SmallVectorImpl<d_t> &Targets) {
+    CallFlowFunction->computeTargetsInto(std::move(d2), Targets);
   }
 
   /// Computes the call-to-return flow function for the given call-site
@@ -1091,11 +1620,13 @@ protected:
   /// compute
   /// @param d1 The abstraction at the current method's start node.
   /// @param d2 The abstraction at the call site
-  /// @return The set of caller-side abstractions at the return site
+  /// @param Targets Receives the set of caller-side abstractions at the
+  /// return site
   ///
-  container_type computeCallToReturnFlowFunction(
-      const FlowFunctionPtrType &CallToReturnFlowFunction, d_t /*d1*/, d_t d2) {
-    return CallToReturnFlowFunction->computeTargets(d2);
+  void computeCallToReturnFlowFunction(
+      const FlowFunctionPtrType &CallToReturnFlowFunction, d_t /*d1*/, d_t d2,
+      llvm::SmallVectorImpl<d_t> &Targets) {
+    CallToReturnFlowFunction->computeTargetsInto(std::move(d2), Targets);
   }
 
   /// Computes the return flow function for the given set of caller-side
@@ -1105,13 +1636,14 @@ protected:
   /// @param d2 The abstraction at the exit node in the callee
   /// @param callSite The call site
   /// @param callerSideDs The abstractions at the call site
-  /// @return The set of caller-side abstractions at the return site
+  /// @param Targets Receives the set of caller-side abstractions at the
+  /// return site
   ///
-  container_type
-  computeReturnFlowFunction(const FlowFunctionPtrType &RetFlowFunction,
-                            d_t /*d1*/, d_t d2, n_t /*CallSite*/,
-                            const Container & /*CallerSideDs*/) {
-    return RetFlowFunction->computeTargets(d2);
+  void computeReturnFlowFunction(const FlowFunctionPtrType &RetFlowFunction,
+                                 d_t /*d1*/, d_t d2, n_t /*CallSite*/,
+                                 const Container & /*CallerSideDs*/,
+                                 llvm::SmallVectorImpl<d_t> &Targets) {
+    RetFlowFunction->computeTargetsInto(std::move(d2), Targets);
   }
 
   /// Propagates the flow further down the exploded super graph, merging any
@@ -1139,6 +1671,21 @@ protected:
     PHASAR_LOG_LEVEL(
         DEBUG, "Edge function : " << f << " (result of previous compose)");
 
+    if (isSparse() && !isSparseRelevant(Target, TargetVal)) {
+      // Skip the statements that cannot affect TargetVal; their flow- and
+      // edge functions are the identity for it. Hence, there is no jump
+      // function and no path edge for (Target, TargetVal). The successors
+      // are relevant, so the recursive calls do not skip any further.
+      PAMM_GET_INSTANCE;
+      INC_COUNTER("Sparse Skips", 1, Full);
+      auto Succs = sparseSuccessorsOf(Target, TargetVal);
+      for (const auto &Next : Succs) {
+        propagate(SourceVal, Next, TargetVal, f);
+      }
+      return;
+    }
+
+    touch(Target);
     EdgeFunction<l_t> JumpFnE = [&]() {
       const auto RevLookupResult = JumpFn->reverseLookup(Target, TargetVal);
       if (RevLookupResult) {
@@ -1154,7 +1701,7 @@ protected:
       // was found
       return AllTop;
     }();
-    EdgeFunction<l_t> fPrime = IDEProblem.combine(JumpFnE, f);
+    EdgeFunction<l_t> fPrime = combine(JumpFnE, f);
     bool NewFunction = fPrime != JumpFnE;
 
     IF_LOG_LEVEL_ENABLED(DEBUG, {
@@ -1188,6 +1735,32 @@ protected:
     }
   }
 
+  /// Composes L and R using the IDEProblem's SemiRing. Consults the
+  /// EdgeFunctionMemoTable first, if enabled in the SolverConfig
+  EdgeFunction<l_t> extend(const EdgeFunction<l_t> &L,
+                           const EdgeFunction<l_t> &R) {
+    if (EFMemo) {
+      return EFMemo->compose(
+          L, R, [this](const EdgeFunction<l_t> &F, const EdgeFunction<l_t> &G) {
+            return IDEProblem.extend(F, G);
+          });
+    }
+    return IDEProblem.extend(L, R);
+  }
+
+  /// Joins L and R using the IDEProblem's SemiRing. Consults the
+  /// EdgeFunctionMemoTable first, if enabled in the SolverConfig
+  EdgeFunction<l_t> combine(const EdgeFunction<l_t> &L,
+                            const EdgeFunction<l_t> &R) {
+    if (EFMemo) {
+      return EFMemo->join(
+          L, R, [this](const EdgeFunction<l_t> &F, const EdgeFunction<l_t> &G) {
+            return IDEProblem.combine(F, G);
+          });
+    }
+    return IDEProblem.combine(L, R);
+  }
+
   l_t joinValueAt(n_t /*Unit*/, d_t /*Fact*/, l_t Curr, l_t NewVal) {
     return IDEProblem.join(std::move(Curr), std::move(NewVal));
   }
@@ -1203,6 +1776,7 @@ protected:
         FSummaryReuse[Key] += 1;
       }
     }
+    touch(SP);
     return EndsummaryTab.get(SP, d3).cellSet();
   }
 
@@ -1469,6 +2043,12 @@ protected:
                      "#Intra Path Edges: " << GET_COUNTER("Intra Path Edges"));
     PHASAR_LOG_LEVEL(INFO,
                      "#Inter Path Edges: " << GET_COUNTER("Inter Path Edges"));
+    if (Spill) {
+      PHASAR_LOG_LEVEL(INFO, "#Spilled functions: "
+                                 << GET_COUNTER("Spilled functions"));
+      PHASAR_LOG_LEVEL(INFO, "#Faulted-in functions: "
+                                 << GET_COUNTER("Faulted-in functions"));
+    }
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Full) {
       PHASAR_LOG_LEVEL(
           INFO, "Flow function query count: " << GET_COUNTER("FF Queries"));
@@ -1483,6 +2063,10 @@ protected:
                            << GET_COUNTER("SpecialSummary-FF Application"));
       PHASAR_LOG_LEVEL(INFO, "Jump function construciton count: "
                                  << GET_COUNTER("JumpFn Construction"));
+      if (isSparse()) {
+        PHASAR_LOG_LEVEL(INFO, "Sparse skip count: "
+                                   << GET_COUNTER("Sparse Skips"));
+      }
       PHASAR_LOG_LEVEL(INFO,
                        "Phase I duration: " << PRINT_TIMER("DFA Phase I"));
       PHASAR_LOG_LEVEL(INFO,
@@ -1495,6 +2079,107 @@ protected:
 public:
   void enableESGAsDot() { SolverConfig.setEmitESG(); }
 
+  /// Writes the exploded super-graph (ESG) to OS in the given Format.
+  ///
+  /// Unlike emitESGAsDot(), the nodes and edges are written incrementally
+  /// while iterating the recorded path edges, with integer node-ids and a
+  /// string table, so the ESG is never materialized in memory. Requires
+  /// IFDSIDESolverConfig::recordEdges().
+  void emitESG(llvm::raw_ostream &OS = llvm::outs(),
+               ESGExportFormat Format = ESGExportFormat::Dot) {
+    PHASAR_LOG_LEVEL(DEBUG, "Stream the exploded super-graph (ESG)");
+
+    struct StmtInfo {
+      uint32_t Idx{};
+      uint32_t FunStrId{};
+      uint32_t LabelStrId{};
+    };
+    struct FactInfo {
+      uint32_t Idx{};
+      uint32_t LabelStrId{};
+    };
+
+    ESGStreamWriter Writer(OS, Format, "Exploded super-graph");
+    std::unordered_map<n_t, StmtInfo> Stmts;
+    std::map<d_t, FactInfo> Facts;
+    /// (StmtIdx << 32 | FactIdx) -> node-id
+    llvm::DenseMap<uint64_t, uint32_t> Nodes;
+    auto ZeroStrId = Writer.getStringId("Λ");
+
+    auto GetStmt = [&](n_t Stmt) -> const StmtInfo & {
+      auto [It, Inserted] = Stmts.try_emplace(Stmt);
+      if (Inserted) {
+        It->second.Idx = uint32_t(Stmts.size() - 1);
+        It->second.FunStrId =
+            Writer.getStringId(ICF->getFunctionName(ICF->getFunctionOf(Stmt)));
+        It->second.LabelStrId = Writer.getStringId(NToString(Stmt));
+      }
+      return It->second;
+    };
+    auto GetFact = [&](const d_t &Fact) -> const FactInfo & {
+      auto [It, Inserted] = Facts.try_emplace(Fact);
+      if (Inserted) {
+        It->second.Idx = uint32_t(Facts.size() - 1);
+        It->second.LabelStrId = IDEProblem.isZeroValue(Fact)
+                                    ? ZeroStrId
+                                    : Writer.getStringId(DToString(Fact));
+      }
+      return It->second;
+    };
+    auto GetNode = [&](n_t Stmt, const d_t &Fact) {
+      const auto &SI = GetStmt(Stmt);
+      const auto &FI = GetFact(Fact);
+      auto [It, Inserted] =
+          Nodes.try_emplace((uint64_t(SI.Idx) << 32) | FI.Idx, 0);
+      if (Inserted) {
+        It->second = Writer.addNode(SI.FunStrId, SI.LabelStrId, FI.LabelStrId);
+      }
+      return It->second;
+    };
+
+    std::string EFLabel;
+    auto EmitEdges = [&](n_t Curr, n_t Succ,
+                         const std::map<d_t, Container> &D1ToD2s,
+                         bool IsInterProc) {
+      for (const auto &[D1, D2s] : D1ToD2s) {
+        auto From = GetNode(Curr, D1);
+        for (const auto &D2 : D2s) {
+          auto To = GetNode(Succ, D2);
+
+          auto EFStrId = ESGStreamWriter::NoString;
+          auto EFIt = IntermediateEdgeFunctions.find(
+              std::make_tuple(Curr, D1, Succ, D2));
+          if (EFIt != IntermediateEdgeFunctions.end() &&
+              !EFIt->second.empty()) {
+            EFLabel.clear();
+            for (const auto &EF : EFIt->second) {
+              EFLabel += to_string(EF) + ", ";
+            }
+            EFStrId = Writer.getStringId(EFLabel);
+          }
+          Writer.addEdge(From, To, IsInterProc, EFStrId);
+        }
+      }
+    };
+
+    ComputedIntraPathEdges.foreachCell(
+        [&](n_t Curr, n_t Succ, const std::map<d_t, Container> &D1ToD2s) {
+          EmitEdges(Curr, Succ, D1ToD2s, false);
+        });
+    ComputedInterPathEdges.foreachCell(
+        [&](n_t Curr, n_t Succ, const std::map<d_t, Container> &D1ToD2s) {
+          EmitEdges(Curr, Succ, D1ToD2s, true);
+        });
+    Writer.finish();
+
+    PHASAR_LOG_LEVEL(DEBUG, "Streamed " << Writer.getNumNodes()
+                                        << " ESG nodes and "
+                                        << Writer.getNumEdges() << " edges");
+  }
+
+  /// Builds the exploded super-graph (ESG) as DOTGraph and writes it to OS.
+  /// The DOTGraph clusters the nodes per function and fact, but it is built
+  /// completely in memory; prefer emitESG() for large programs.
   void
   emitESGAsDot(llvm::raw_ostream &OS = llvm::outs(),
                llvm::StringRef DotConfigDir = PhasarConfig::PhasarDirectory()) {
@@ -1724,6 +2409,17 @@ private:
   /// -- InteractiveIDESolverMixin implementation
 
   bool doInitialize() {
+    EdgeFunctionPool::Scope PoolScope(EFPool.get());
+    beginPhaseI();
+
+    PHASAR_LOG_LEVEL(INFO,
+                     "Submit initial seeds, construct exploded super graph");
+    // We start our analysis and construct exploded supergraph
+    submitInitialSeeds();
+    return !WorkList.empty();
+  }
+
+  void beginPhaseI() {
     PAMM_GET_INSTANCE;
     REG_COUNTER("Gen facts", 0, Core);
     REG_COUNTER("Kill facts", 0, Core);
@@ -1741,22 +2437,30 @@ private:
     REG_COUNTER("Process Normal", 0, Full);
     REG_COUNTER("Process Exit", 0, Full);
     REG_COUNTER("[Calls] getAliasSet", 0, Full);
+    REG_COUNTER("Spilled functions", 0, Core);
+    REG_COUNTER("Spilled jump functions", 0, Full);
+    REG_COUNTER("Faulted-in functions", 0, Core);
+    REG_COUNTER("Sparse Skips", 0, Full);
     REG_HISTOGRAM("Data-flow facts", Full);
     REG_HISTOGRAM("Points-to", Full);
 
+    if (SolverConfig.sparse() && !isSparse()) {
+      PHASAR_LOG_LEVEL(WARNING, "Sparse mode is disabled, because the solver "
+                                "is configured to record the ESG");
+    }
+
     PHASAR_LOG_LEVEL(INFO, "IDE solver is solving the specified problem");
-    PHASAR_LOG_LEVEL(INFO,
-                     "Submit initial seeds, construct exploded super graph");
     // computations starting here
     START_TIMER("DFA Phase I", Full);
-
-    // We start our analysis and construct exploded supergraph
-    submitInitialSeeds();
-    return !WorkList.empty();
   }
 
   bool doNext() {
-    assert(!WorkList.empty());
+    if (WorkList.empty()) {
+      // E.g., after restoring a checkpoint that has been taken at the end of
+      // phase I
+      return false;
+    }
+    EdgeFunctionPool::Scope PoolScope(EFPool.get());
     auto [Edge, EF] = std::move(WorkList.back());
     WorkList.pop_back();
 
@@ -1767,7 +2471,267 @@ private:
     return !WorkList.empty();
   }
 
+  [[nodiscard]] bool isSparse() const {
+    return SolverConfig.sparse() && !SolverConfig.recordEdges() &&
+           !SolverConfig.emitESG();
+  }
+
+  /// The solver relies on path edges at call-sites, exit- and start points,
+  /// seeds and unbalanced return sites, so these are always relevant
+  [[nodiscard]] bool isSparseRelevant(ByConstRef<n_t> Inst,
+                                      ByConstRef<d_t> Fact) const {
+    return ICF->isCallSite(Inst) || ICF->isExitInst(Inst) ||
+           ICF->isStartPoint(Inst) || Seeds.containsInitialSeedsFor(Inst) ||
+           UnbalancedRetSites.count(Inst) || IDEProblem.isRelevant(Inst, Fact);
+  }
+
+  /// Returns the first statements reachable from the irrelevant statement
+  /// From that are relevant for Fact. The results are cached per fact; the
+  /// cache is flushed once it exceeds SolverConfig.sparseSuccessorCacheSize()
+  /// entries.
+  const llvm::SmallVector<n_t, 2> &sparseSuccessorsOf(ByConstRef<n_t> From,
+                                                      ByConstRef<d_t> Fact) {
+    if (NumSparseSuccessors >= SolverConfig.sparseSuccessorCacheSize()) {
+      SparseSuccessors.clear();
+      NumSparseSuccessors = 0;
+    }
+    auto [It, Inserted] = SparseSuccessors[Fact].try_emplace(From);
+    if (!Inserted) {
+      return It->second;
+    }
+    ++NumSparseSuccessors;
+
+    auto &Succs = It->second;
+    llvm::SmallVector<n_t> WL = {From};
+    std::unordered_set<n_t> Visited = {From};
+    while (!WL.empty()) {
+      auto Curr = WL.pop_back_val();
+      for (const auto &Succ : ICF->getSuccsOf(Curr)) {
+        if (!Visited.insert(Succ).second) {
+          continue;
+        }
+        if (isSparseRelevant(Succ, Fact)) {
+          Succs.push_back(Succ);
+        } else {
+          WL.push_back(Succ);
+        }
+      }
+    }
+    return Succs;
+  }
+
+  template <typename EncoderT>
+  static void encodeJumpFunction(EncoderT &Entities, ByConstRef<d_t> SourceVal,
+                                 ByConstRef<n_t> Target,
+                                 ByConstRef<d_t> TargetVal,
+                                 const EdgeFunction<l_t> &EF) {
+    auto D1 = Entities.fact(SourceVal);
+    auto N = Entities.node(Target);
+    auto D2 = Entities.fact(TargetVal);
+    Entities.writeRecord('J', {D1, N, D2, Entities.edgeFunction(EF)});
+  }
+
+  template <typename EncoderT>
+  static void
+  encodeEndSummaries(EncoderT &Entities, ByConstRef<n_t> SP,
+                     ByConstRef<d_t> D1,
+                     const Table<n_t, d_t, EdgeFunction<l_t>> &Summaries) {
+    auto SPId = Entities.node(SP);
+    auto D1Id = Entities.fact(D1);
+    Summaries.foreachCell([&](ByConstRef<n_t> EP, ByConstRef<d_t> D2,
+                              const EdgeFunction<l_t> &EF) {
+      auto EPId = Entities.node(EP);
+      auto D2Id = Entities.fact(D2);
+      Entities.writeRecord('E', {SPId, D1Id, EPId, D2Id,
+                                 Entities.edgeFunction(EF)});
+    });
+  }
+
+  template <typename DecoderT> void decodeJumpFunction(DecoderT &Entities) {
+    auto D1 = Entities.fact();
+    auto N = Entities.node();
+    auto D2 = Entities.fact();
+    auto EF = Entities.edgeFunction();
+    if (!Entities.failed()) {
+      JumpFn->addFunction(std::move(D1), N, std::move(D2), std::move(EF));
+    }
+  }
+
+  template <typename DecoderT> void decodeEndSummary(DecoderT &Entities) {
+    auto SP = Entities.node();
+    auto D1 = Entities.fact();
+    auto EP = Entities.node();
+    auto D2 = Entities.fact();
+    auto EF = Entities.edgeFunction();
+    if (!Entities.failed()) {
+      addEndSummary(SP, std::move(D1), EP, std::move(D2), std::move(EF));
+    }
+  }
+
+  /// -- Memory budget
+
+  struct SpillState {
+    SpillFile File;
+    MemoryBudgetConfig Config;
+    llvm::unique_function<bool(IDESolver &, ByConstRef<f_t>,
+                               CheckpointEncoder &)>
+        Encode;
+    llvm::unique_function<bool(IDESolver &, llvm::StringRef)> Decode;
+
+    std::unordered_map<f_t, SpillFile::Segment> Spilled{};
+    /// The period, in which the function has been used last
+    std::unordered_map<f_t, size_t> LastUse{};
+    /// Functions whose entries could not be encoded
+    std::unordered_set<f_t> Unspillable{};
+    size_t Period = 0;
+    size_t NumFaultedIn = 0;
+  };
+
+  template <typename CodecT>
+  bool encodeSpilledFunction(CodecT &Codec, ByConstRef<f_t> Fun,
+                             CheckpointEncoder &Enc) {
+    auto IsZero = [this](d_t Fact) { return IDEProblem.isZeroValue(Fact); };
+    detail::CheckpointEntityEncoder<AnalysisDomainTy, CodecT> Entities(
+        Enc, Codec, IsZero);
+
+    for (const auto &Inst : ICF->getAllInstructionsOf(Fun)) {
+      JumpFn->foreachJumpFunctionAt(
+          Inst, [&](ByConstRef<d_t> SourceVal, ByConstRef<d_t> TargetVal,
+                    const EdgeFunction<l_t> &EF) {
+            encodeJumpFunction(Entities, SourceVal, Inst, TargetVal, EF);
+          });
+    }
+    for (const auto &SP : ICF->getStartPointsOf(Fun)) {
+      for (const auto &[D1, Summaries] : std::as_const(EndsummaryTab).row(SP)) {
+        encodeEndSummaries(Entities, SP, D1, Summaries);
+      }
+    }
+    Enc.writeTag('Z');
+    return !Entities.failed();
+  }
+
+  template <typename CodecT>
+  bool decodeSpilledFunction(CodecT &Codec, llvm::StringRef Buffer) {
+    auto DecOrErr =
+        CheckpointDecoder::create(Buffer, SpillMagic, CheckpointVersion);
+    if (!DecOrErr) {
+      return false;
+    }
+    auto &Dec = *DecOrErr;
+    detail::CheckpointEntityDecoder<AnalysisDomainTy, CodecT> Entities(
+        Dec, Codec, ZeroValue);
+
+    char Tag = 0;
+    while (!Entities.failed() && (Tag = Dec.nextTag()) != '\0' && Tag != 'Z') {
+      switch (Tag) {
+      case 'J':
+        decodeJumpFunction(Entities);
+        break;
+      case 'E':
+        decodeEndSummary(Entities);
+        break;
+      default:
+        return false;
+      }
+    }
+    return !Entities.failed() && Tag == 'Z';
+  }
+
+  /// Restores the encoded Entries of Fun, which has been spilled when the
+  /// checkpoint was created. Keeps them spilled, if a memory budget is enabled.
+  template <typename CodecT>
+  bool restoreSpilledFunction(CodecT &Codec, f_t Fun,
+                              llvm::StringRef Entries) {
+    if (!Spill) {
+      return decodeSpilledFunction(Codec, Entries);
+    }
+    if (!CheckpointDecoder::create(Entries, SpillMagic, CheckpointVersion)) {
+      return false;
+    }
+    auto Seg = Spill->File.write(Entries);
+    if (!Seg) {
+      PHASAR_LOG_LEVEL(ERROR, "Cannot write to the spill file '"
+                                  << Spill->File.getPath()
+                                  << "': " << Seg.getError().message());
+      return false;
+    }
+    Spill->Spilled.emplace(std::move(Fun), *Seg);
+    return true;
+  }
+
+  /// \returns True, iff Fun has been spilled
+  bool spillFunction(ByConstRef<f_t> Fun) {
+    PAMM_GET_INSTANCE;
+    CheckpointEncoder Enc(SpillMagic, CheckpointVersion);
+    if (!Spill->Encode(*this, Fun, Enc)) {
+      PHASAR_LOG_LEVEL(WARNING, "Cannot spill function " << FToString(Fun)
+                                                         << "; keep it");
+      Spill->Unspillable.insert(Fun);
+      return false;
+    }
+    auto Seg = Spill->File.write(std::move(Enc).take());
+    if (!Seg) {
+      PHASAR_LOG_LEVEL(ERROR, "Cannot write to the spill file '"
+                                  << Spill->File.getPath()
+                                  << "': " << Seg.getError().message());
+      return false;
+    }
+
+    // Only drop the entries after they are safely on disk
+    size_t NumJumpFns = 0;
+    for (const auto &Inst : ICF->getAllInstructionsOf(Fun)) {
+      NumJumpFns += JumpFn->removeFunctionsAt(Inst);
+    }
+    for (const auto &SP : ICF->getStartPointsOf(Fun)) {
+      EndsummaryTab.remove(SP);
+    }
+    Spill->Spilled.emplace(Fun, *Seg);
+
+    INC_COUNTER("Spilled functions", 1, Core);
+    INC_COUNTER("Spilled jump functions", NumJumpFns, Full);
+    return true;
+  }
+
+  void faultIn(typename std::unordered_map<f_t, SpillFile::Segment>::iterator
+                   SpilledIt) {
+    PAMM_GET_INSTANCE;
+    auto Fun = SpilledIt->first;
+    auto Seg = SpilledIt->second;
+    // Erase first, as decoding the entries touches Fun again
+    Spill->Spilled.erase(SpilledIt);
+
+    auto Buffer = Spill->File.read(Seg);
+    if (!Buffer) {
+      llvm::report_fatal_error("Cannot read from the spill file '" +
+                               Spill->File.getPath() +
+                               "': " + Buffer.getError().message());
+    }
+    if (!Spill->Decode(*this, (*Buffer)->getBuffer())) {
+      llvm::report_fatal_error("Corrupted spill file '" +
+                               Spill->File.getPath() + "'");
+    }
+    ++Spill->NumFaultedIn;
+    PHASAR_LOG_LEVEL(DEBUG, "Faulted in function " << FToString(Fun));
+    INC_COUNTER("Faulted-in functions", 1, Core);
+  }
+
+  /// Marks the function of Node as used and faults its jump functions and end
+  /// summaries back in, if they are spilled
+  void touch(ByConstRef<n_t> Node) {
+    if (LLVM_LIKELY(!Spill)) {
+      return;
+    }
+    auto Fun = ICF->getFunctionOf(Node);
+    Spill->LastUse[Fun] = Spill->Period;
+    if (auto It = Spill->Spilled.find(Fun); It != Spill->Spilled.end()) {
+      faultIn(It);
+    }
+  }
+
   void finalizeInternal() {
+    EdgeFunctionPool::Scope PoolScope(EFPool.get());
+    // Phase II needs all jump functions
+    restoreSpilledFunctions();
     PAMM_GET_INSTANCE;
     STOP_TIMER("DFA Phase I", Full);
     PHASAR_LOG_LEVEL(INFO, "[info]: IDE Phase I completed");
@@ -1786,7 +2750,7 @@ private:
       computeAndPrintStatistics();
     }
     if (SolverConfig.emitESG()) {
-      emitESGAsDot();
+      emitESG();
     }
   }
 
@@ -1807,6 +2771,11 @@ private:
   const i_t *ICF;
   IFDSIDESolverConfig &SolverConfig;
 
+  /// Only allocated, if SolverConfig.poolEdgeFunctions() is set. Declared
+  /// before all members that hold edge functions, such that it is destroyed
+  /// after them
+  std::unique_ptr<EdgeFunctionPool> EFPool;
+
   std::vector<std::pair<PathEdge<n_t, d_t>, EdgeFunction<l_t>>> WorkList;
   std::vector<std::pair<n_t, d_t>> ValuePropWL;
 
@@ -1842,6 +2811,17 @@ private:
   Table<n_t, d_t, l_t> ValTab;
 
   std::map<std::pair<n_t, d_t>, size_t> FSummaryReuse;
+
+  /// Only allocated, if SolverConfig.memoizeEdgeFunctions() is set
+  std::unique_ptr<EdgeFunctionMemoTable<l_t>> EFMemo;
+
+  /// Only allocated, if enableMemoryBudget() has been called
+  std::unique_ptr<SpillState> Spill;
+
+  /// The successors of irrelevant statements in sparse mode, by fact
+  std::unordered_map<d_t, std::unordered_map<n_t, llvm::SmallVector<n_t, 2>>>
+      SparseSuccessors;
+  size_t NumSparseSuccessors = 0;
 };
 
 template <typename AnalysisDomainTy, typename Container>
@@ -10,12 +10,15 @@
 #ifndef PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERAPIMIXIN_H
 #define PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERAPIMIXIN_H
 
+#include "phasar/Utils/Checkpoint.h"
 #include "phasar/Utils/Logger.h"
+#include "phasar/Utils/SpillFile.h"
 
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <cstddef>
 #include <functional>
@@ -423,6 +426,110 @@ public:
     }();
   }
 
+  // -- Checkpointing
+
+  /// Solves the analysis problem and periodically writes a checkpoint of the
+  /// solver state to Config.Path, from which the analysis can be resumed
+  /// using restoreCheckpoint() and one of the continue* functions.
+  ///
+  /// The solver only pauses for encoding its state with Codec; the checkpoint
+  /// is written to disk in the background. See IDESolverCheckpointCodec.h for
+  /// the requirements on Codec.
+  ///
+  /// \returns A view into the computed analysis results
+  template <typename CodecT>
+  decltype(auto) solveWithCheckpoints(CodecT &Codec,
+                                      CheckpointConfig Config) & {
+    checkpointingImpl(/*Initialize=*/true, Codec, std::move(Config));
+    return finalize();
+  }
+
+  /// Solves the analysis problem and periodically writes a checkpoint of the
+  /// solver state to Config.Path, from which the analysis can be resumed
+  /// using restoreCheckpoint() and one of the continue* functions.
+  ///
+  /// The solver only pauses for encoding its state with Codec; the checkpoint
+  /// is written to disk in the background. See IDESolverCheckpointCodec.h for
+  /// the requirements on Codec.
+  ///
+  /// \returns The computed analysis results
+  template <typename CodecT>
+  decltype(auto) solveWithCheckpoints(CodecT &Codec,
+                                      CheckpointConfig Config) && {
+    checkpointingImpl(/*Initialize=*/true, Codec, std::move(Config));
+    return std::move(*this).finalize();
+  }
+
+  /// Continues running the solver on the configured problem after it got
+  /// interrupted in a previous run or has been restored from a checkpoint.
+  /// Periodically writes a checkpoint of the solver state to Config.Path.
+  ///
+  /// \remark Please make sure to *only* call this function on an IDESolver
+  /// where the solving process is interrupted, i.e. one of the interruptable
+  /// solving methods returned std::nullopt or restoreCheckpoint() returned
+  /// true.
+  ///
+  /// \returns A view into the computed analysis results
+  template <typename CodecT>
+  decltype(auto) continueWithCheckpoints(CodecT &Codec,
+                                         CheckpointConfig Config) & {
+    checkpointingImpl(/*Initialize=*/false, Codec, std::move(Config));
+    return finalize();
+  }
+
+  /// Continues running the solver on the configured problem after it got
+  /// interrupted in a previous run or has been restored from a checkpoint.
+  /// Periodically writes a checkpoint of the solver state to Config.Path.
+  ///
+  /// \remark Please make sure to *only* call this function on an IDESolver
+  /// where the solving process is interrupted, i.e. one of the interruptable
+  /// solving methods returned std::nullopt or restoreCheckpoint() returned
+  /// true.
+  ///
+  /// \returns The computed analysis results
+  template <typename CodecT>
+  decltype(auto) continueWithCheckpoints(CodecT &Codec,
+                                         CheckpointConfig Config) && {
+    checkpointingImpl(/*Initialize=*/false, Codec, std::move(Config));
+    return std::move(*this).finalize();
+  }
+
+  // -- Memory budget
+
+  /// Solves the analysis problem within a memory budget: Every
+  /// Config.CheckInterval, checks whether the heap usage exceeds Config.Limit
+  /// and if so, spills the jump functions and end summaries of cold functions
+  /// to disk. They are faulted back in, once the solver reaches the respective
+  /// function again. See enableMemoryBudget() and enforceMemoryBudget().
+  ///
+  /// The entries are encoded with Codec; see IDESolverCheckpointCodec.h for
+  /// the requirements on Codec.
+  ///
+  /// \returns A view into the computed analysis results
+  template <typename CodecT>
+  decltype(auto) solveWithMemoryBudget(CodecT &Codec,
+                                       MemoryBudgetConfig Config) & {
+    memoryBudgetImpl(Codec, std::move(Config));
+    return finalize();
+  }
+
+  /// Solves the analysis problem within a memory budget: Every
+  /// Config.CheckInterval, checks whether the heap usage exceeds Config.Limit
+  /// and if so, spills the jump functions and end summaries of cold functions
+  /// to disk. They are faulted back in, once the solver reaches the respective
+  /// function again. See enableMemoryBudget() and enforceMemoryBudget().
+  ///
+  /// The entries are encoded with Codec; see IDESolverCheckpointCodec.h for
+  /// the requirements on Codec.
+  ///
+  /// \returns The computed analysis results
+  template <typename CodecT>
+  decltype(auto) solveWithMemoryBudget(CodecT &Codec,
+                                       MemoryBudgetConfig Config) && {
+    memoryBudgetImpl(Codec, std::move(Config));
+    return std::move(*this).finalize();
+  }
+
 private:
   [[nodiscard]] Derived &self() &noexcept {
     static_assert(std::is_base_of_v<IDESolverAPIMixin, Derived>,
@@ -442,6 +549,52 @@ private:
     }
   }
 
+  template <typename CodecT>
+  void checkpointingImpl(bool Initialize, CodecT &Codec,
+                         CheckpointConfig Config) {
+    auto Interval = Config.CheckInterval;
+    PeriodicCheckpointer Checkpointer(std::move(Config));
+    auto TakeCheckpointIfDue =
+        [this, &Codec,
+         &Checkpointer](std::chrono::steady_clock::time_point TimeStamp) {
+          if (Checkpointer.isDue(TimeStamp)) {
+            if (auto Buffer = self().createCheckpoint(Codec)) {
+              Checkpointer.write(std::move(*Buffer));
+            } else {
+              Checkpointer.postpone();
+            }
+          }
+          // Never cancel
+          return false;
+        };
+
+    [[maybe_unused]] bool Completed =
+        Initialize ? solveUntilImpl(TakeCheckpointIfDue, Interval)
+                   : continueUntilImpl(TakeCheckpointIfDue, Interval);
+    assert(Completed && "Checkpointing must not cancel the solver");
+    Checkpointer.wait();
+  }
+
+  template <typename CodecT>
+  void memoryBudgetImpl(CodecT &Codec, MemoryBudgetConfig Config) {
+    auto Interval = Config.CheckInterval;
+    if (!self().enableMemoryBudget(Codec, std::move(Config))) {
+      PHASAR_LOG_LEVEL(WARNING, "Solve without memory budget");
+      solveImpl();
+      return;
+    }
+    auto EnforceMemoryBudget = [this] {
+      self().enforceMemoryBudget();
+      // Never cancel
+      return false;
+    };
+
+    [[maybe_unused]] bool Completed =
+        solveUntilImpl(EnforceMemoryBudget, Interval);
+    assert(Completed && "Enforcing the memory budget must not cancel the "
+                        "solver");
+  }
+
   template <typename CancellationRequest>
   [[nodiscard]] bool
   continueUntilImpl(CancellationRequest CancellationRequested,
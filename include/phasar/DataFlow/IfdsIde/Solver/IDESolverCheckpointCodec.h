@@ -0,0 +1,249 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERCHECKPOINTCODEC_H
+#define PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERCHECKPOINTCODEC_H
+
+#include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionUtils.h"
+#include "phasar/Utils/ByRef.h"
+#include "phasar/Utils/Checkpoint.h"
+#include "phasar/Utils/JoinLattice.h"
+#include "phasar/Utils/Logger.h"
+#include "phasar/Utils/Printer.h"
+
+#include "llvm/ADT/STLFunctionalExtras.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace psr {
+
+/// IDESolver::createCheckpoint() and IDESolver::restoreCheckpoint() encode the
+/// analysis-specific parts of the solver state with a user-provided codec. A
+/// codec maps the statements, data-flow facts, functions and edge functions
+/// to strings that must stay valid across processes, e.g., metadata ids
+/// instead of pointers. It must provide the following members:
+///
+///   std::optional<std::string> encodeNode(n_t);
+///   std::optional<n_t> decodeNode(llvm::StringRef);
+///   std::optional<std::string> encodeFact(d_t);
+///   std::optional<d_t> decodeFact(llvm::StringRef);
+///   std::optional<std::string> encodeFunction(f_t);
+///   std::optional<f_t> decodeFunction(llvm::StringRef);
+///   std::optional<std::string> encodeEdgeFunction(const EdgeFunction<l_t> &);
+///   EdgeFunction<l_t> decodeEdgeFunction(llvm::StringRef); // null on error
+///
+/// The zero value is handled by the solver and never passed to the codec.
+///
+/// This class implements the edge-function part for the edge functions that
+/// IFDS analyses use. IDE analyses with custom edge functions can derive from
+/// it and handle their own edge functions before delegating to it.
+template <typename L> class DefaultEdgeFunctionCheckpointCodec {
+public:
+  using l_t = L;
+
+  [[nodiscard]] std::optional<std::string>
+  encodeEdgeFunction(const EdgeFunction<l_t> &EF) const {
+    if (llvm::isa<EdgeIdentity<l_t>>(EF)) {
+      return "id";
+    }
+    if constexpr (HasJoinLatticeTraits<l_t>) {
+      // Otherwise, the values of AllBottom and AllTop would need to be
+      // encoded as well
+      if (llvm::isa<AllBottom<l_t>>(EF)) {
+        return "bot";
+      }
+      if (llvm::isa<AllTop<l_t>>(EF)) {
+        return "top";
+      }
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] EdgeFunction<l_t>
+  decodeEdgeFunction(llvm::StringRef Str) const {
+    if (Str == "id") {
+      return EdgeIdentity<l_t>{};
+    }
+    if constexpr (HasJoinLatticeTraits<l_t>) {
+      if (Str == "bot") {
+        return AllBottom<l_t>{};
+      }
+      if (Str == "top") {
+        return AllTop<l_t>{};
+      }
+    }
+    return nullptr;
+  }
+};
+
+namespace detail {
+/// Encodes the solver entities with a codec into the string table of a
+/// CheckpointEncoder. The zero value is encoded as 0, all other facts as
+/// their string-id + 1.
+///
+/// As the encoder writes string records on demand, all entities of a record
+/// must be encoded before the record is started with writeTag().
+template <typename AnalysisDomainTy, typename CodecT>
+class CheckpointEntityEncoder {
+public:
+  using n_t = typename AnalysisDomainTy::n_t;
+  using d_t = typename AnalysisDomainTy::d_t;
+  using f_t = typename AnalysisDomainTy::f_t;
+  using l_t = typename AnalysisDomainTy::l_t;
+
+  CheckpointEntityEncoder(CheckpointEncoder &Enc, CodecT &Codec,
+                          llvm::function_ref<bool(d_t)> IsZero) noexcept
+      : Enc(Enc), Codec(Codec), IsZero(IsZero) {}
+
+  [[nodiscard]] uint64_t node(ByConstRef<n_t> Node) {
+    auto [It, Inserted] = NodeIds.try_emplace(Node, 0);
+    if (Inserted) {
+      if (auto Str = Codec.encodeNode(Node)) {
+        It->second = Enc.getStringId(*Str);
+      } else {
+        PHASAR_LOG_LEVEL(ERROR, "Cannot encode node " << NToString(Node));
+        Failed = true;
+      }
+    }
+    return It->second;
+  }
+
+  [[nodiscard]] uint64_t fact(ByConstRef<d_t> Fact) {
+    if (IsZero(Fact)) {
+      return 0;
+    }
+    auto [It, Inserted] = FactIds.try_emplace(Fact, 0);
+    if (Inserted) {
+      if (auto Str = Codec.encodeFact(Fact)) {
+        It->second = uint64_t(Enc.getStringId(*Str)) + 1;
+      } else {
+        PHASAR_LOG_LEVEL(ERROR, "Cannot encode fact " << DToString(Fact));
+        Failed = true;
+      }
+    }
+    return It->second;
+  }
+
+  [[nodiscard]] uint64_t function(ByConstRef<f_t> Fun) {
+    if (auto Str = Codec.encodeFunction(Fun)) {
+      return Enc.getStringId(*Str);
+    }
+    PHASAR_LOG_LEVEL(ERROR, "Cannot encode function " << FToString(Fun));
+    Failed = true;
+    return 0;
+  }
+
+  [[nodiscard]] uint64_t edgeFunction(const EdgeFunction<l_t> &EF) {
+    if (auto Str = Codec.encodeEdgeFunction(EF)) {
+      return Enc.getStringId(*Str);
+    }
+    PHASAR_LOG_LEVEL(ERROR, "Cannot encode edge function " << EF);
+    Failed = true;
+    return 0;
+  }
+
+  /// Writes a record consisting of already encoded entities
+  void writeRecord(char Tag, std::initializer_list<uint64_t> Nums) {
+    Enc.writeTag(Tag);
+    for (auto Num : Nums) {
+      Enc.writeNumber(Num);
+    }
+  }
+
+  [[nodiscard]] bool failed() const noexcept { return Failed; }
+
+private:
+  CheckpointEncoder &Enc;
+  CodecT &Codec;
+  llvm::function_ref<bool(d_t)> IsZero;
+  std::unordered_map<n_t, uint64_t> NodeIds;
+  std::unordered_map<d_t, uint64_t> FactIds;
+  bool Failed = false;
+};
+
+/// Reads the solver entities that have been written by the
+/// CheckpointEntityEncoder. After a failed read, all reads return
+/// default-constructed values.
+template <typename AnalysisDomainTy, typename CodecT>
+class CheckpointEntityDecoder {
+public:
+  using n_t = typename AnalysisDomainTy::n_t;
+  using d_t = typename AnalysisDomainTy::d_t;
+  using f_t = typename AnalysisDomainTy::f_t;
+  using l_t = typename AnalysisDomainTy::l_t;
+
+  CheckpointEntityDecoder(CheckpointDecoder &Dec, CodecT &Codec,
+                          d_t ZeroValue) noexcept
+      : Dec(Dec), Codec(Codec), ZeroValue(std::move(ZeroValue)) {}
+
+  [[nodiscard]] n_t node() {
+    auto Str = Dec.readString();
+    if (auto Node = Codec.decodeNode(Str)) {
+      return *Node;
+    }
+    fail("node", Str);
+    return n_t{};
+  }
+
+  [[nodiscard]] d_t fact() {
+    auto Id = Dec.readNumber();
+    if (Id == 0) {
+      return ZeroValue;
+    }
+    auto Str = Dec.getString(Id - 1);
+    if (auto Fact = Codec.decodeFact(Str)) {
+      return *Fact;
+    }
+    fail("fact", Str);
+    return ZeroValue;
+  }
+
+  [[nodiscard]] f_t function() {
+    auto Str = Dec.readString();
+    if (auto Fun = Codec.decodeFunction(Str)) {
+      return *Fun;
+    }
+    fail("function", Str);
+    return f_t{};
+  }
+
+  [[nodiscard]] EdgeFunction<l_t> edgeFunction() {
+    auto Str = Dec.readString();
+    auto EF = Codec.decodeEdgeFunction(Str);
+    if (EF == nullptr) {
+      fail("edge function", Str);
+    }
+    return EF;
+  }
+
+  [[nodiscard]] bool failed() { return Failed || Dec.hasError(); }
+
+private:
+  void fail(llvm::StringRef What, llvm::StringRef Str) {
+    if (!failed()) {
+      PHASAR_LOG_LEVEL(ERROR, "Cannot decode " << What << " '" << Str << '\'');
+    }
+    Failed = true;
+  }
+
+  CheckpointDecoder &Dec;
+  CodecT &Codec;
+  d_t ZeroValue;
+  bool Failed = false;
+};
+} // namespace detail
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERCHECKPOINTCODEC_H
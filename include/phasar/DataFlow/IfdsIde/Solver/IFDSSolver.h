@@ -33,7 +33,7 @@ template <typename AnalysisDomainTy,
 class IFDSSolver
     : public IDESolver<WithBinaryValueDomain<AnalysisDomainTy>, Container> {
 public:
-  using ProblemTy = IFDSTabulationProblem<AnalysisDomainTy>;
+  using ProblemTy = IFDSTabulationProblem<AnalysisDomainTy, Container>;
   using d_t = typename AnalysisDomainTy::d_t;
   using n_t = typename AnalysisDomainTy::n_t;
   using i_t = typename AnalysisDomainTy::i_t;
@@ -43,18 +43,21 @@ public:
                 std::is_base_of_v<IfdsDomainTy, AnalysisDomainTy>>>
   IFDSSolver(IFDSTabulationProblem<IfdsDomainTy, Container> &IFDSProblem,
              const i_t *ICF)
-      : IDESolver<WithBinaryValueDomain<AnalysisDomainTy>>(IFDSProblem, ICF) {}
+      : IDESolver<WithBinaryValueDomain<AnalysisDomainTy>, Container>(
+            IFDSProblem, ICF) {}
 
   ~IFDSSolver() override = default;
 
   /// Returns the data-flow results at the given statement.
   [[nodiscard]] virtual std::set<d_t> ifdsResultsAt(n_t Inst) {
-    std::set<d_t> KeySet;
-    std::unordered_map<d_t, BinaryDomain> ResultMap = this->resultsAt(Inst);
-    for (const auto &FlowFact : ResultMap) {
-      KeySet.insert(FlowFact.first);
-    }
-    return KeySet;
+    return this->getSolverResults().ifdsResultsAt(Inst);
+  }
+
+  /// Returns a range over the data-flow facts at the given statement without
+  /// copying them. The range is invalidated when the solver is destroyed or
+  /// continues solving.
+  [[nodiscard]] auto ifdsFactsAtView(n_t Inst, bool StripZero = false) {
+    return this->getSolverResults().factsAtView(Inst, StripZero);
   }
 
   /// Returns the data-flow results at the given statement while respecting
@@ -77,23 +80,14 @@ public:
       std::is_same_v<std::remove_reference_t<NTy>, llvm::Instruction *>,
       std::set<d_t>>
   ifdsResultsAtInLLVMSSA(NTy Inst) {
-    auto getResultMap // NOLINT
-        = [this, Inst]() {
-            if (Inst->getType()->isVoidTy()) {
-              return this->resultsAt(Inst);
-            }
-            // In this case we have a value on the left-hand side and must
-            // return the results at the successor instruction. Note that
-            // terminator instructions are always of void type.
-            assert(Inst->getNextNode() &&
-                   "Expected to find a valid successor node!");
-            return this->resultsAt(Inst->getNextNode());
-          };
-    std::set<d_t> KeySet;
-    for (auto &[FlowFact, LatticeValue] : getResultMap()) {
-      KeySet.insert(FlowFact);
+    if (Inst->getType()->isVoidTy()) {
+      return this->getSolverResults().ifdsResultsAt(Inst);
     }
-    return KeySet;
+    // In this case we have a value on the left-hand side and must
+    // return the results at the successor instruction. Note that
+    // terminator instructions are always of void type.
+    assert(Inst->getNextNode() && "Expected to find a valid successor node!");
+    return this->getSolverResults().ifdsResultsAt(Inst->getNextNode());
   }
 };
 
@@ -28,6 +28,7 @@
 #include <memory>
 #include <optional>
 #include <ostream>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -170,6 +171,50 @@ public:
         });
   }
 
+  /// Calls Handler(SourceVal, Target, TargetVal, EdgeFunc) for each recorded
+  /// jump function
+  template <typename HandlerFn>
+  void foreachJumpFunction(HandlerFn Handler) const {
+    NonEmptyForwardLookup.foreachCell(
+        [&Handler](ByConstRef<d_t> SourceVal, ByConstRef<n_t> Target,
+                   const auto &TargetFactAndEF) {
+          for (const auto &[TargetVal, EF] : TargetFactAndEF) {
+            std::invoke(Handler, SourceVal, Target, TargetVal, EF);
+          }
+        });
+  }
+
+  /// Calls Handler(SourceVal, TargetVal, EdgeFunc) for each recorded jump
+  /// function with the given target
+  template <typename HandlerFn>
+  void foreachJumpFunctionAt(ByConstRef<n_t> Target, HandlerFn Handler) const {
+    auto It = NonEmptyLookupByTargetNode.find(Target);
+    if (It != NonEmptyLookupByTargetNode.end()) {
+      It->second.foreachCell(std::move(Handler));
+    }
+  }
+
+  /// Removes all jump functions with the given target.
+  ///
+  /// \returns The number of removed jump functions
+  size_t removeFunctionsAt(ByConstRef<n_t> Target) {
+    auto It = NonEmptyLookupByTargetNode.find(Target);
+    if (It == NonEmptyLookupByTargetNode.end()) {
+      return 0;
+    }
+    size_t NumRemoved = 0;
+    It->second.foreachCell([this, &Target, &NumRemoved](
+                               ByConstRef<d_t> SourceVal,
+                               ByConstRef<d_t> /*TargetVal*/,
+                               const EdgeFunction<l_t> & /*EdgeFunc*/) {
+      std::ignore = NonEmptyForwardLookup.remove(SourceVal, Target);
+      ++NumRemoved;
+    });
+    NonEmptyReverseLookup.remove(Target);
+    NonEmptyLookupByTargetNode.erase(It);
+    return NumRemoved;
+  }
+
   /**
    * Removes a jump function. The source statement is implicit.
    * @see PathEdge
@@ -16,6 +16,9 @@
 #include "phasar/DataFlow/PathSensitivity/ExplodedSuperGraph.h"
 #include "phasar/Utils/Logger.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
+
 namespace psr {
 template <typename AnalysisDomainTy,
           typename Container = std::set<typename AnalysisDomainTy::d_t>>
@@ -52,11 +55,19 @@ public:
 
 private:
   void saveEdges(n_t Curr, n_t Succ, d_t CurrNode,
-                 const container_type &SuccNodes, ESGEdgeKind Kind) override {
+                 llvm::ArrayRef<d_t> SuccNodes, ESGEdgeKind Kind) override {
     ESG.saveEdges(std::move(Curr), std::move(CurrNode), std::move(Succ),
                   SuccNodes, Kind);
   }
 
+  void foreachAdditionalLiveFact(
+      llvm::function_ref<void(ByConstRef<d_t>)> Handler) const override {
+    // The ESG keeps the facts alive for path reconstruction after solving
+    for (const auto &Fact : ESG.facts()) {
+      Handler(Fact);
+    }
+  }
+
   ExplodedSuperGraph<domain_t> ESG;
 };
 
@@ -19,11 +19,16 @@
 
 #include "phasar/Domain/BinaryDomain.h"
 #include "phasar/Utils/ByRef.h"
+#include "phasar/Utils/ColumnarResults.h"
 #include "phasar/Utils/PAMMMacros.h"
 #include "phasar/Utils/Printer.h"
 #include "phasar/Utils/Table.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <functional>
 #include <set>
 #include <type_traits>
 #include <unordered_map>
@@ -51,6 +56,8 @@ public:
     return self().Results.get(Stmt, Node);
   }
 
+  /// Returns a copy of the resulting environment at the given statement.
+  /// Prefer resultsAtView() if you only need to iterate over the results.
   [[nodiscard]] std::unordered_map<d_t, l_t> resultsAt(ByConstRef<n_t> Stmt,
                                                        bool StripZero) const {
     std::unordered_map<d_t, l_t> Result = self().Results.row(Stmt);
@@ -65,18 +72,55 @@ public:
     return self().Results.row(Stmt);
   }
 
+  /// Returns a range over the (fact, value) pairs at the given statement
+  /// without copying them. The artificial zero value can be skipped.
+  ///
+  /// The range points into the underlying result table, so it stays valid as
+  /// long as the table is neither modified nor destroyed; it does not depend
+  /// on the lifetime of this SolverResults object.
+  [[nodiscard]] auto resultsAtView(ByConstRef<n_t> Stmt,
+                                   bool StripZero = false) const {
+    const std::unordered_map<d_t, l_t> &Row = self().Results.row(Stmt);
+    return llvm::make_filter_range(
+        Row, [ZV = d_t(self().ZV), StripZero](const auto &Entry) {
+          return !StripZero || Entry.first != ZV;
+        });
+  }
+
+  /// Returns a range over the data-flow facts that hold at the given
+  /// statement without copying them. See resultsAtView().
+  [[nodiscard]] auto factsAtView(ByConstRef<n_t> Stmt,
+                                 bool StripZero = false) const {
+    return llvm::map_range(
+        resultsAtView(Stmt, StripZero),
+        [](const auto &Entry) -> ByConstRef<d_t> { return Entry.first; });
+  }
+
   // this function only exists for IFDS problems which use BinaryDomain as their
   // value domain L
   template <typename ValueDomain = l_t,
             typename = typename std::enable_if_t<
                 std::is_same_v<ValueDomain, BinaryDomain>>>
   [[nodiscard]] std::set<d_t> ifdsResultsAt(ByConstRef<n_t> Stmt) const {
-    std::set<D> KeySet;
     const auto &ResultMap = self().Results.row(Stmt);
-    for (const auto &[FlowFact, Val] : ResultMap) {
-      KeySet.insert(FlowFact);
+    auto Facts = llvm::make_first_range(ResultMap);
+    return std::set<d_t>(Facts.begin(), Facts.end());
+  }
+
+  /// Calls Handler(n, d, l) for each computed result in the order in which
+  /// the results are stored, i.e., grouped by statement. In contrast to
+  /// getAllResultEntries(), nothing is copied.
+  template <typename HandlerFn>
+  void foreachResult(HandlerFn &&Handler, bool StripZero = false) const {
+    const auto &ZV = self().ZV;
+    for (const auto &[Stmt, Row] : self().Results.rowMap()) {
+      for (const auto &[Fact, Value] : Row) {
+        if (StripZero && Fact == ZV) {
+          continue;
+        }
+        std::invoke(Handler, Stmt, Fact, Value);
+      }
     }
-    return KeySet;
   }
 
   /// Returns the data-flow results at the given statement while respecting
@@ -125,6 +169,17 @@ public:
   resultAtInLLVMSSA(ByConstRef<n_t> Stmt, d_t Value,
                     bool AllowOverapproximation = false) const;
 
+  /// Calls Handler(Fact, Value) for each data-flow result at the given
+  /// statement while respecting LLVM's SSA semantics; see
+  /// resultsAtInLLVMSSA(). Does not copy the results, unless they have to be
+  /// merged from multiple successors.
+  template <typename HandlerFn, typename NTy = n_t>
+  typename std::enable_if_t<std::is_same_v<
+      std::decay_t<std::remove_pointer_t<NTy>>, llvm::Instruction>>
+  foreachResultAtInLLVMSSA(ByConstRef<n_t> Stmt, HandlerFn &&Handler,
+                           bool AllowOverapproximation = false,
+                           bool StripZero = false) const;
+
   [[nodiscard]] std::vector<typename Table<n_t, d_t, l_t>::Cell>
   getAllResultEntries() const {
     return self().Results.cellVec();
@@ -180,7 +235,44 @@ public:
     STOP_TIMER("DFA IDE Result Dumping", Full);
   }
 
+  /// Streams all results to OS in the compact columnar format of the
+  /// ColumnarResultsWriter. Statements, facts and values are written using
+  /// NToString(), DToString() and LToString() respectively.
+  void exportColumnar(llvm::raw_ostream &OS, bool StripZero = false) const {
+    ColumnarResultsWriter Writer(OS);
+    llvm::SmallVector<uint32_t> Facts;
+    llvm::SmallVector<uint32_t> Values;
+    const auto &ZV = self().ZV;
+    for (const auto &[Stmt, Row] : self().Results.rowMap()) {
+      Facts.clear();
+      Values.clear();
+      for (const auto &[Fact, Value] : Row) {
+        if (StripZero && Fact == ZV) {
+          continue;
+        }
+        Facts.push_back(Writer.getStringId(DToString(Fact)));
+        Values.push_back(Writer.getStringId(LToString(Value)));
+      }
+      if (!Facts.empty()) {
+        Writer.addRow(Writer.getStringId(NToString(Stmt)), Facts, Values);
+      }
+    }
+    Writer.finish();
+  }
+
 private:
+  /// The results at the statement, where the results of Stmt are visible in
+  /// LLVM's SSA semantics, or nullptr if these have to be merged from multiple
+  /// successors. Reports a fatal error in the latter case, if
+  /// AllowOverapproximation is false.
+  template <typename NTy = n_t>
+  [[nodiscard]] const std::unordered_map<d_t, l_t> *
+  getRowInLLVMSSA(ByConstRef<n_t> Stmt, bool AllowOverapproximation) const;
+
+  template <typename NTy = n_t>
+  [[nodiscard]] std::unordered_map<d_t, l_t>
+  joinSuccessorRowsInLLVMSSA(ByConstRef<n_t> Stmt) const;
+
   [[nodiscard]] const Derived &self() const noexcept {
     static_assert(std::is_base_of_v<SolverResultsBase, Derived>);
     return static_cast<const Derived &>(*this);
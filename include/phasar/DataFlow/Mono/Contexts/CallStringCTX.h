@@ -3,50 +3,68 @@
 
 #include "phasar/Utils/Printer.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/Support/raw_ostream.h"
 
-#include "boost/functional/hash.hpp"
-
-#include <deque>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <stdexcept>
 
 namespace psr {
 
+/// A call string of at most K call-sites. The call-sites are stored inline,
+/// so copying a context does not allocate.
 template <typename N, unsigned K> class CallStringCTX {
 protected:
-  std::deque<N> CallString;
+  std::array<N, K> CallString{};
+  uint32_t Size = 0;
   static constexpr unsigned KLimit = K;
   friend struct std::hash<psr::CallStringCTX<N, K>>;
 
 public:
   CallStringCTX() = default;
 
-  CallStringCTX(std::initializer_list<N> IList) : CallString(IList) {
+  CallStringCTX(std::initializer_list<N> IList) {
     if (IList.size() > KLimit) {
       throw std::runtime_error(
           "initial call std::string length exceeds maximal length K");
     }
+    std::copy(IList.begin(), IList.end(), CallString.begin());
+    Size = uint32_t(IList.size());
   }
 
   void push_back(N Stmt) { // NOLINT
-    if (CallString.size() > KLimit - 1) {
-      CallString.pop_front();
+    if constexpr (KLimit != 0) {
+      if (Size == KLimit) {
+        // Drop the oldest call-site
+        std::move(std::next(CallString.begin()), CallString.end(),
+                  CallString.begin());
+        --Size;
+      }
+      CallString[Size++] = Stmt;
     }
-    CallString.push_back(Stmt);
   }
 
   N pop_back() { // NOLINT
-    if (!CallString.empty()) {
-      N Stmt = CallString.back();
-      CallString.pop_back();
+    if (Size != 0) {
+      N Stmt = CallString[--Size];
+      CallString[Size] = N{};
       return Stmt;
     }
     return N{};
   }
 
+  /// The call-sites, oldest first
+  [[nodiscard]] llvm::ArrayRef<N> getCallSites() const noexcept {
+    return llvm::makeArrayRef(CallString.data(), Size);
+  }
+
   [[nodiscard]] bool isEqual(const CallStringCTX &Rhs) const {
-    return CallString == Rhs.CallString;
+    return getCallSites() == Rhs.getCallSites();
   }
 
   [[nodiscard]] bool isDifferent(const CallStringCTX &Rhs) const {
@@ -65,23 +83,26 @@ public:
 
   friend bool operator<(const CallStringCTX<N, K> &Lhs,
                         const CallStringCTX<N, K> &Rhs) {
-    return Lhs.cs < Rhs.cs;
+    auto LhsCS = Lhs.getCallSites();
+    auto RhsCS = Rhs.getCallSites();
+    return std::lexicographical_compare(LhsCS.begin(), LhsCS.end(),
+                                        RhsCS.begin(), RhsCS.end());
   }
 
   llvm::raw_ostream &print(llvm::raw_ostream &OS) const {
     OS << "Call string: [ ";
-    for (auto C : CallString) {
-      OS << NToString(C);
-      if (C != CallString.back()) {
+    for (uint32_t I = 0; I != Size; ++I) {
+      if (I != 0) {
         OS << " * ";
       }
+      OS << NToString(CallString[I]);
     }
     return OS << " ]";
   }
 
-  [[nodiscard]] bool empty() const { return CallString.empty(); }
+  [[nodiscard]] bool empty() const { return Size == 0; }
 
-  [[nodiscard]] std::size_t size() const { return CallString.size(); }
+  [[nodiscard]] std::size_t size() const { return Size; }
 };
 
 } // namespace psr
@@ -90,11 +111,9 @@ namespace std {
 
 template <typename N, unsigned K> struct hash<psr::CallStringCTX<N, K>> {
   size_t operator()(const psr::CallStringCTX<N, K> &CS) const noexcept {
-    boost::hash<std::deque<N>> HashDeque;
-    std::hash<unsigned> HashUnsigned;
-    size_t U = HashUnsigned(K);
-    size_t H = HashDeque(CS.CallString);
-    return U ^ (H << 1);
+    auto CallSites = CS.getCallSites();
+    return llvm::hash_combine(
+        K, llvm::hash_combine_range(CallSites.begin(), CallSites.end()));
   }
 };
 
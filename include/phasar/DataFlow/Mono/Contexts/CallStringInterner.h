@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_MONO_CONTEXTS_CALLSTRINGINTERNER_H
+#define PHASAR_DATAFLOW_MONO_CONTEXTS_CALLSTRINGINTERNER_H
+
+#include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// Interns the K-limited call strings over the call-sites N as dense 32-bit
+/// ids.
+///
+/// The call strings are stored in a trie, where the path from the root to a
+/// node spells the call string from the oldest to the newest call-site. The
+/// root is the empty call string with the id EmptyId. Hence, popping the
+/// newest call-site is a parent lookup and pushing a call-site is a single
+/// hash lookup once the transition has been created.
+template <typename N, unsigned K> class CallStringInterner {
+public:
+  using IdTy = uint32_t;
+
+  static constexpr IdTy EmptyId = 0;
+
+  CallStringInterner() { Nodes.push_back({N{}, EmptyId, 0}); }
+
+  /// The id of the call string Ctx followed by CallSite. Drops the oldest
+  /// call-site, if that would exceed the length K.
+  [[nodiscard]] IdTy push(IdTy Ctx, N CallSite) {
+    assert(Ctx < Nodes.size() && "Invalid call-string id");
+    if constexpr (K == 0) {
+      return EmptyId;
+    } else {
+      if (Nodes[Ctx].Length != K) {
+        return getOrCreateChild(Ctx, CallSite);
+      }
+      if (auto It = Transitions.find({Ctx, CallSite});
+          It != Transitions.end()) {
+        return It->second;
+      }
+
+      auto Ret = getOrCreateChild(dropFront(Ctx), CallSite);
+      Transitions.try_emplace({Ctx, CallSite}, Ret);
+      return Ret;
+    }
+  }
+
+  /// Splits the call string Ctx into the id of the call string without its
+  /// newest call-site and that call-site. Returns (EmptyId, N{}) for the empty
+  /// call string.
+  [[nodiscard]] std::pair<IdTy, N> pop(IdTy Ctx) const noexcept {
+    assert(Ctx < Nodes.size() && "Invalid call-string id");
+    const auto &Node = Nodes[Ctx];
+    return {Node.Parent, Node.Last};
+  }
+
+  /// The id of the call string CS
+  [[nodiscard]] IdTy intern(const CallStringCTX<N, K> &CS) {
+    auto Ret = EmptyId;
+    for (const auto &CallSite : CS.getCallSites()) {
+      Ret = getOrCreateChild(Ret, CallSite);
+    }
+    return Ret;
+  }
+
+  /// The call string with the id Ctx
+  [[nodiscard]] CallStringCTX<N, K> get(IdTy Ctx) const {
+    assert(Ctx < Nodes.size() && "Invalid call-string id");
+    std::array<N, K> CallSites{};
+    auto Length = Nodes[Ctx].Length;
+    for (auto I = Length; I != 0; --I) {
+      CallSites[I - 1] = Nodes[Ctx].Last;
+      Ctx = Nodes[Ctx].Parent;
+    }
+
+    CallStringCTX<N, K> Ret;
+    for (uint32_t I = 0; I != Length; ++I) {
+      Ret.push_back(CallSites[I]);
+    }
+    return Ret;
+  }
+
+  [[nodiscard]] size_t length(IdTy Ctx) const noexcept {
+    assert(Ctx < Nodes.size() && "Invalid call-string id");
+    return Nodes[Ctx].Length;
+  }
+
+  [[nodiscard]] static bool empty(IdTy Ctx) noexcept { return Ctx == EmptyId; }
+
+  /// The number of interned call strings, including the empty one
+  [[nodiscard]] size_t size() const noexcept { return Nodes.size(); }
+
+  llvm::raw_ostream &print(llvm::raw_ostream &OS, IdTy Ctx) const {
+    return get(Ctx).print(OS);
+  }
+
+private:
+  struct Node {
+    /// The newest call-site
+    N Last;
+    /// The call string without Last
+    IdTy Parent;
+    uint32_t Length;
+  };
+
+  IdTy getOrCreateChild(IdTy Parent, N CallSite) {
+    assert(Nodes[Parent].Length < K);
+    auto [It, Inserted] =
+        Transitions.try_emplace({Parent, CallSite}, IdTy(Nodes.size()));
+    if (Inserted) {
+      assert(Nodes.size() < std::numeric_limits<IdTy>::max() &&
+             "Too many call strings");
+      Nodes.push_back({CallSite, Parent, Nodes[Parent].Length + 1});
+    }
+    return It->second;
+  }
+
+  /// The id of Ctx without its oldest call-site
+  IdTy dropFront(IdTy Ctx) {
+    if (Ctx == EmptyId) {
+      return EmptyId;
+    }
+    if (DroppedFront.size() < Nodes.size()) {
+      DroppedFront.resize(Nodes.size(), NoId);
+    }
+    if (DroppedFront[Ctx] != NoId) {
+      return DroppedFront[Ctx];
+    }
+
+    // The recursion depth is bounded by K
+    const auto [Parent, Last] = pop(Ctx);
+    auto Ret = Parent == EmptyId ? EmptyId
+                                 : getOrCreateChild(dropFront(Parent), Last);
+    if (DroppedFront.size() < Nodes.size()) {
+      DroppedFront.resize(Nodes.size(), NoId);
+    }
+    DroppedFront[Ctx] = Ret;
+    return Ret;
+  }
+
+  static constexpr IdTy NoId = std::numeric_limits<IdTy>::max();
+
+  std::vector<Node> Nodes;
+  /// (call string, pushed call-site) -> call string. For call strings shorter
+  /// than K, these are the edges of the trie.
+  llvm::DenseMap<std::pair<IdTy, N>, IdTy> Transitions;
+  /// Memoizes dropFront()
+  std::vector<IdTy> DroppedFront;
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_MONO_CONTEXTS_CALLSTRINGINTERNER_H
@@ -18,6 +18,7 @@
 #define PHASAR_DATAFLOW_MONO_INTRAMONOPROBLEM_H
 
 #include "phasar/ControlFlow/CFGBase.h"
+#include "phasar/DataFlow/Mono/MonoWorklist.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
 #include "phasar/Pointer/AliasInfo.h"
 #include "phasar/Utils/Printer.h"
@@ -101,6 +102,13 @@ public:
 
   virtual bool setSoundness(Soundness /*S*/) { return false; }
 
+  /// The order in which the solver should process the control-flow edges.
+  /// The solver's result does not depend on it, but the number of flow
+  /// function applications that are needed to reach it does.
+  [[nodiscard]] virtual MonoWorklistStrategy getWorklistStrategy() const {
+    return MonoWorklistStrategy::FIFO;
+  }
+
   virtual void printContainer(llvm::raw_ostream &OS, mono_container_t C) const {
   }
 };
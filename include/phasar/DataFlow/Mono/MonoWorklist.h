@@ -0,0 +1,315 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_MONO_MONOWORKLIST_H
+#define PHASAR_DATAFLOW_MONO_MONOWORKLIST_H
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/ErrorHandling.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// The order in which the monotone solvers process the control-flow edges in
+/// their worklist
+enum class MonoWorklistStrategy {
+  /// Process the edges in the order in which they are added. Edges may be
+  /// contained in the worklist multiple times.
+  FIFO,
+  /// Always process the pending edge whose source comes first in
+  /// reverse-postorder. Each edge is pending at most once.
+  ReversePostOrder,
+  /// Like ReversePostOrder, but first orders by the topological order of the
+  /// strongly connected components (SCCs) of the control-flow graph, s.t. a
+  /// loop is iterated until it is stable, before its successors are
+  /// processed.
+  SCC,
+};
+
+[[nodiscard]] constexpr llvm::StringLiteral
+toString(MonoWorklistStrategy Strategy) noexcept {
+  switch (Strategy) {
+  case MonoWorklistStrategy::FIFO:
+    return "FIFO";
+  case MonoWorklistStrategy::ReversePostOrder:
+    return "ReversePostOrder";
+  case MonoWorklistStrategy::SCC:
+    return "SCC";
+  }
+  llvm_unreachable("All MonoWorklistStrategy variants should be handled in "
+                   "the switch above");
+}
+
+/// Counters that describe how much work a monotone solver has done
+struct MonoSolverStatistics {
+  /// The number of edges that have been taken from the worklist, i.e., the
+  /// number of times a flow function has been applied to an edge's source
+  size_t NumVisits{};
+  /// The number of distinct nodes that have been visited at least once
+  size_t NumVisitedNodes{};
+  /// The maximal number of visits of a single node
+  size_t MaxVisitsPerNode{};
+  /// The number of edges that have been added to the worklist
+  size_t NumPushes{};
+  /// The number of added edges that were already pending and have therefore
+  /// been dropped
+  size_t NumDuplicatePushes{};
+  size_t MaxWorklistSize{};
+};
+
+/// The worklist of control-flow edges (Src, Dst) of the monotone solvers.
+///
+/// For the priority-based strategies, the nodes of a control-flow graph
+/// should be numbered with addNodes() before their edges are added. Nodes
+/// that have not been numbered get the next free number on first use.
+template <typename N> class MonoWorklist {
+public:
+  using EdgeTy = std::pair<N, N>;
+
+  explicit MonoWorklist(
+      MonoWorklistStrategy Strategy = MonoWorklistStrategy::FIFO)
+      : Strategy(Strategy) {}
+
+  [[nodiscard]] MonoWorklistStrategy getStrategy() const noexcept {
+    return Strategy;
+  }
+
+  /// Numbers all nodes reachable from Roots according to the strategy.
+  /// Succs(Node) must return the (intra-procedural) successors of Node.
+  ///
+  /// Nodes that have already been numbered by a previous call are not
+  /// renumbered; all new nodes are ordered after them.
+  template <typename RootRangeT, typename SuccFnT>
+  void addNodes(const RootRangeT &Roots, SuccFnT &&Succs) {
+    if (Strategy == MonoWorklistStrategy::FIFO) {
+      return;
+    }
+
+    // Tarjan's SCC algorithm; its DFS yields the post-order as well
+    struct Frame {
+      N Node;
+      llvm::SmallVector<N, 2> Succs;
+      size_t NextSucc = 0;
+    };
+
+    std::vector<Frame> CallStack;
+    std::unordered_map<N, uint32_t> DFSNum;
+    std::unordered_map<N, uint32_t> LowLink;
+    std::unordered_map<N, uint32_t> SCCOf;
+    std::vector<N> SCCStack;
+    std::unordered_set<N> OnSCCStack;
+    std::vector<N> PostOrder;
+    uint32_t NumSCCs = 0;
+
+    auto Discover = [&](N Node) {
+      auto Num = uint32_t(DFSNum.size());
+      DFSNum[Node] = Num;
+      LowLink[Node] = Num;
+      SCCStack.push_back(Node);
+      OnSCCStack.insert(Node);
+      const auto &NodeSuccs = std::invoke(Succs, Node);
+      CallStack.push_back(
+          {Node, llvm::SmallVector<N, 2>(NodeSuccs.begin(), NodeSuccs.end())});
+    };
+
+    for (const auto &Root : Roots) {
+      if (Priority.count(Root) || DFSNum.count(Root)) {
+        continue;
+      }
+
+      Discover(Root);
+      while (!CallStack.empty()) {
+        auto &Top = CallStack.back();
+        if (Top.NextSucc != Top.Succs.size()) {
+          auto Succ = Top.Succs[Top.NextSucc++];
+          if (Priority.count(Succ)) {
+            // Already numbered by a previous call to addNodes()
+            continue;
+          }
+          if (auto It = DFSNum.find(Succ); It == DFSNum.end()) {
+            // Invalidates Top
+            Discover(Succ);
+          } else if (OnSCCStack.count(Succ)) {
+            auto &Low = LowLink[Top.Node];
+            Low = std::min(Low, It->second);
+          }
+          continue;
+        }
+
+        auto Node = Top.Node;
+        CallStack.pop_back();
+        PostOrder.push_back(Node);
+
+        auto Low = LowLink[Node];
+        if (Low == DFSNum[Node]) {
+          N Member;
+          do {
+            Member = SCCStack.back();
+            SCCStack.pop_back();
+            OnSCCStack.erase(Member);
+            SCCOf[Member] = NumSCCs;
+          } while (Member != Node);
+          ++NumSCCs;
+        }
+
+        if (!CallStack.empty()) {
+          auto &ParentLow = LowLink[CallStack.back().Node];
+          ParentLow = std::min(ParentLow, Low);
+        }
+      }
+    }
+
+    // Tarjan's algorithm finds the SCCs in reverse topological order
+    auto SortKey = [&](size_t PostOrderIdx) {
+      auto Node = PostOrder[PostOrderIdx];
+      uint32_t SCCIdx = Strategy == MonoWorklistStrategy::SCC
+                            ? NumSCCs - 1 - SCCOf[Node]
+                            : 0;
+      return std::make_pair(SCCIdx, PostOrder.size() - 1 - PostOrderIdx);
+    };
+
+    std::vector<size_t> Order(PostOrder.size());
+    for (size_t I = 0, End = Order.size(); I != End; ++I) {
+      Order[I] = I;
+    }
+    llvm::sort(Order, [&SortKey](size_t Lhs, size_t Rhs) {
+      return SortKey(Lhs) < SortKey(Rhs);
+    });
+
+    NodeAt.reserve(NodeAt.size() + Order.size());
+    for (auto Idx : Order) {
+      getOrCreatePriority(PostOrder[Idx]);
+    }
+  }
+
+  void push(EdgeTy Edge) {
+    ++Stats.NumPushes;
+    if (Strategy == MonoWorklistStrategy::FIFO) {
+      Fifo.push_back(std::move(Edge));
+    } else {
+      auto SrcPrio = getOrCreatePriority(Edge.first);
+      auto DstPrio = getOrCreatePriority(Edge.second);
+      if (!Pending.emplace(SrcPrio, DstPrio).second) {
+        ++Stats.NumDuplicatePushes;
+      }
+    }
+    Stats.MaxWorklistSize = std::max(Stats.MaxWorklistSize, size());
+  }
+
+  template <typename EdgeRangeT> void pushAll(const EdgeRangeT &Edges) {
+    for (const auto &Edge : Edges) {
+      push(Edge);
+    }
+  }
+
+  /// Adds Edges in front of all pending edges. Only affects the FIFO strategy.
+  template <typename EdgeRangeT> void pushFront(const EdgeRangeT &Edges) {
+    if (Strategy != MonoWorklistStrategy::FIFO) {
+      pushAll(Edges);
+      return;
+    }
+
+    auto Size = Fifo.size();
+    Fifo.insert(Fifo.begin(), Edges.begin(), Edges.end());
+    Stats.NumPushes += Fifo.size() - Size;
+    Stats.MaxWorklistSize = std::max(Stats.MaxWorklistSize, size());
+  }
+
+  /// Removes the next edge to process from the worklist
+  [[nodiscard]] EdgeTy pop() {
+    assert(!empty() && "Cannot pop from an empty worklist!");
+    EdgeTy Edge;
+    if (Strategy == MonoWorklistStrategy::FIFO) {
+      Edge = std::move(Fifo.front());
+      Fifo.pop_front();
+    } else {
+      auto [SrcPrio, DstPrio] = *Pending.begin();
+      Pending.erase(Pending.begin());
+      Edge = {NodeAt[SrcPrio], NodeAt[DstPrio]};
+    }
+
+    ++Stats.NumVisits;
+    auto &NumVisits = VisitsPerNode[Edge.first];
+    ++NumVisits;
+    Stats.MaxVisitsPerNode = std::max(Stats.MaxVisitsPerNode, NumVisits);
+    return Edge;
+  }
+
+  [[nodiscard]] bool empty() const noexcept {
+    return Fifo.empty() && Pending.empty();
+  }
+
+  [[nodiscard]] size_t size() const noexcept {
+    return Fifo.size() + Pending.size();
+  }
+
+  /// Calls Handler for each pending edge in the order they will be processed
+  template <typename HandlerFn> void foreachPending(HandlerFn &&Handler) const {
+    for (const auto &Edge : Fifo) {
+      std::invoke(Handler, Edge);
+    }
+    for (auto [SrcPrio, DstPrio] : Pending) {
+      std::invoke(Handler, EdgeTy{NodeAt[SrcPrio], NodeAt[DstPrio]});
+    }
+  }
+
+  /// The number of edges starting at Node that have been processed so far
+  [[nodiscard]] size_t getNumVisits(const N &Node) const {
+    auto It = VisitsPerNode.find(Node);
+    return It != VisitsPerNode.end() ? It->second : 0;
+  }
+
+  [[nodiscard]] MonoSolverStatistics getStatistics() const {
+    auto Ret = Stats;
+    Ret.NumVisitedNodes = VisitsPerNode.size();
+    return Ret;
+  }
+
+private:
+  uint32_t getOrCreatePriority(const N &Node) {
+    auto [It, Inserted] = Priority.try_emplace(Node, uint32_t(NodeAt.size()));
+    if (Inserted) {
+      NodeAt.push_back(Node);
+    }
+    return It->second;
+  }
+
+  MonoWorklistStrategy Strategy;
+
+  // Used by the FIFO strategy
+  std::deque<EdgeTy> Fifo;
+
+  // Used by the priority-based strategies; a lower number means a higher
+  // priority. The priorities of the nodes are unique, so an edge is uniquely
+  // identified by the priorities of its source and target.
+  std::set<std::pair<uint32_t, uint32_t>> Pending;
+  std::unordered_map<N, uint32_t> Priority;
+  std::vector<N> NodeAt;
+
+  std::unordered_map<N, size_t> VisitsPerNode;
+  MonoSolverStatistics Stats;
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_MONO_MONOWORKLIST_H
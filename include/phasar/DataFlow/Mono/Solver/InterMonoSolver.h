@@ -18,9 +18,16 @@
 #define PHASAR_DATAFLOW_MONO_SOLVER_INTERMONOSOLVER_H
 
 #include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
+#include "phasar/DataFlow/Mono/Contexts/CallStringInterner.h"
 #include "phasar/DataFlow/Mono/InterMonoProblem.h"
+#include "phasar/DataFlow/Mono/MonoWorklist.h"
+#include "phasar/Utils/Logger.h"
 
-#include <deque>
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -37,35 +44,40 @@ public:
   using v_t = typename AnalysisDomainTy::v_t;
   using i_t = typename AnalysisDomainTy::i_t;
   using mono_container_t = typename AnalysisDomainTy::mono_container_t;
+  using ContextInternerTy = CallStringInterner<n_t, K>;
+  using CtxIdTy = typename ContextInternerTy::IdTy;
 
 protected:
+  static constexpr CtxIdTy EmptyCtx = ContextInternerTy::EmptyId;
+
+  /// The facts at a single node, sorted by the ids of their contexts
+  using ContextResultsTy =
+      llvm::SmallVector<std::pair<CtxIdTy, mono_container_t>, 1>;
+
   ProblemTy &IMProblem;
-  std::deque<std::pair<n_t, n_t>> Worklist;
-  std::unordered_map<
-      n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
-      Analysis;
+  MonoWorklist<n_t> Worklist;
+  ContextInternerTy Contexts;
+  std::unordered_map<n_t, ContextResultsTy> Analysis;
   std::unordered_set<f_t> AddedFunctions;
   const i_t *ICF;
 
   void initialize() {
     for (auto &[Node, FlowFacts] : IMProblem.initialSeeds()) {
-      auto ControlFlowEdges =
-          ICF->getAllControlFlowEdges(ICF->getFunctionOf(Node));
-      Worklist.insert(Worklist.begin(), ControlFlowEdges.begin(),
-                      ControlFlowEdges.end());
+      auto Function = ICF->getFunctionOf(Node);
+      addNodesToWorklist(Function);
+      auto ControlFlowEdges = ICF->getAllControlFlowEdges(Function);
+      Worklist.pushFront(ControlFlowEdges);
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &[Src, Dst] : ControlFlowEdges) {
-        Analysis[Src][CallStringCTX<n_t, K>()] = IMProblem.allTop();
+        factsAt(Src, EmptyCtx) = IMProblem.allTop();
       }
       // Initialize last
       if (!ControlFlowEdges.empty()) {
-        Analysis[ControlFlowEdges.back().second][CallStringCTX<n_t, K>()] =
-            IMProblem.allTop();
+        factsAt(ControlFlowEdges.back().second, EmptyCtx) = IMProblem.allTop();
       }
       // Additionally, insert the initial seeds
-      Analysis[Node][CallStringCTX<n_t, K>()].insert(FlowFacts.begin(),
-                                                     FlowFacts.end());
+      factsAt(Node, EmptyCtx).insert(FlowFacts.begin(), FlowFacts.end());
     }
   }
 
@@ -83,12 +95,50 @@ protected:
 
   void printWorkList() {
     llvm::outs() << "CURRENT WORKLIST:\n";
-    for (auto &[Src, Dst] : Worklist) {
-      llvm::outs() << NToString(Src) << " --> " << NToString(Dst) << '\n';
-    }
+    Worklist.foreachPending([](const auto &Edge) {
+      llvm::outs() << NToString(Edge.first) << " --> "
+                   << NToString(Edge.second) << '\n';
+    });
     llvm::outs() << "-----------------\n";
   }
 
+  std::string containerToString(const mono_container_t &Facts) const {
+    std::string Ret;
+    llvm::raw_string_ostream OS(Ret);
+    IMProblem.printContainer(OS, Facts);
+    return Ret;
+  }
+
+  /// The facts at Node in the context Ctx. Inserts empty facts, if there are
+  /// none, yet, which invalidates the references to the other facts at Node.
+  mono_container_t &factsAt(n_t Node, CtxIdTy Ctx) {
+    auto &Results = Analysis[Node];
+    auto It = llvm::partition_point(
+        Results, [Ctx](const auto &Entry) { return Entry.first < Ctx; });
+    if (It == Results.end() || It->first != Ctx) {
+      It = Results.insert(It, {Ctx, mono_container_t{}});
+    }
+    return It->second;
+  }
+
+  /// The contexts in which there are facts at Node
+  llvm::SmallVector<CtxIdTy, 4> contextsAt(n_t Node) const {
+    llvm::SmallVector<CtxIdTy, 4> Ret;
+    if (auto It = Analysis.find(Node); It != Analysis.end()) {
+      for (const auto &Entry : It->second) {
+        Ret.push_back(Entry.first);
+      }
+    }
+    return Ret;
+  }
+
+  /// Numbers the instructions of Function for the priority-based worklist
+  /// strategies
+  void addNodesToWorklist(f_t Function) {
+    Worklist.addNodes(ICF->getStartPointsOf(Function),
+                      [this](n_t Inst) { return ICF->getSuccsOf(Inst); });
+  }
+
   void addCalleesToWorklist(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     // auto Dst = Edge.second;
@@ -98,27 +148,27 @@ protected:
         break;
       }
       AddedFunctions.insert(Callee);
+      addNodesToWorklist(Callee);
       // Add call Edge(s)
       for (auto StartPoint : ICF->getStartPointsOf(Callee)) {
-        Worklist.push_back({Src, StartPoint});
+        Worklist.push({Src, StartPoint});
       }
       // Add intra edges of callee
       auto Edges = ICF->getAllControlFlowEdges(Callee);
-      Worklist.insert(Worklist.begin(), Edges.begin(), Edges.end());
+      Worklist.pushFront(Edges);
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &[Src, Dst] : Edges) {
-        Analysis[Src][CallStringCTX<n_t, K>()] = IMProblem.allTop();
+        factsAt(Src, EmptyCtx) = IMProblem.allTop();
       }
       // Initialize last
       if (!Edges.empty()) {
-        Analysis[Edges.back().second][CallStringCTX<n_t, K>()] =
-            IMProblem.allTop();
+        factsAt(Edges.back().second, EmptyCtx) = IMProblem.allTop();
       }
       // Add return Edge(s)
       for (auto Ret : ICF->getExitPointsOf(Callee)) {
         for (auto RetSite : ICF->getReturnSitesOfCallAt(Src)) {
-          Worklist.push_back({Ret, RetSite});
+          Worklist.push({Ret, RetSite});
         }
       }
     }
@@ -129,16 +179,16 @@ protected:
   void addToWorklist(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    Worklist.push_back({Src, Dst});
+    Worklist.push({Src, Dst});
     // add intra-procedural edges again
     for (auto Nprimeprime : ICF->getSuccsOf(Dst)) {
-      Worklist.push_back({Dst, Nprimeprime});
+      Worklist.push({Dst, Nprimeprime});
     }
     // add inter-procedural call edges again
     if (ICF->isCallSite(Dst)) {
       for (auto Callee : ICF->getCalleesOfCallAt(Dst)) {
         for (auto StartPoint : ICF->getStartPointsOf(Callee)) {
-          Worklist.push_back({Dst, StartPoint});
+          Worklist.push({Dst, StartPoint});
         }
       }
     }
@@ -146,7 +196,7 @@ protected:
     if (ICF->isExitInst(Dst)) {
       for (const auto *Caller : ICF->getCallersOf(ICF->getFunctionOf(Dst))) {
         for (const auto *Nprimeprime : ICF->getSuccsOf(Caller)) {
-          Worklist.push_back({Dst, Nprimeprime});
+          Worklist.push({Dst, Nprimeprime});
         }
       }
     }
@@ -154,7 +204,11 @@ protected:
 
 public:
   InterMonoSolver(InterMonoProblem<AnalysisDomainTy> &IMP)
-      : IMProblem(IMP), ICF(IMP.getICFG()) {}
+      : InterMonoSolver(IMP, IMP.getWorklistStrategy()) {}
+
+  InterMonoSolver(InterMonoProblem<AnalysisDomainTy> &IMP,
+                  MonoWorklistStrategy Strategy)
+      : IMProblem(IMP), Worklist(Strategy), ICF(IMP.getICFG()) {}
 
   InterMonoSolver(const InterMonoSolver &) = delete;
 
@@ -166,51 +220,62 @@ public:
 
   virtual ~InterMonoSolver() = default;
 
+  /// The facts per node and call string. Materializes the call strings; use
+  /// getContexts() to resolve the context ids of the solver instead.
   std::unordered_map<
       n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
   getAnalysis() {
-    return Analysis;
+    std::unordered_map<
+        n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
+        Ret;
+    for (const auto &[Node, ContextResults] : Analysis) {
+      auto &NodeResults = Ret[Node];
+      for (const auto &[Ctx, Facts] : ContextResults) {
+        NodeResults.try_emplace(Contexts.get(Ctx), Facts);
+      }
+    }
+    return Ret;
+  }
+
+  [[nodiscard]] const ContextInternerTy &getContexts() const noexcept {
+    return Contexts;
   }
 
   void processNormal(std::pair<n_t, n_t> Edge) {
-    llvm::outs() << "Handle normal flow\n";
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    llvm::outs() << "Src: " << NToString(Src) << '\n';
-    llvm::outs() << "Dst: " << NToString(Dst) << '\n';
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
-    for (auto &[Ctx, Facts] : Analysis[Src]) {
-      Out[Ctx] = IMProblem.normalFlow(Src, Analysis[Src][Ctx]);
+    PHASAR_LOG_LEVEL(DEBUG, "Handle normal flow");
+    PHASAR_LOG_LEVEL(DEBUG, "Src: " << NToString(Src));
+    PHASAR_LOG_LEVEL(DEBUG, "Dst: " << NToString(Dst));
+    std::unordered_map<CtxIdTy, mono_container_t> Out;
+    for (auto Ctx : contextsAt(Src)) {
+      Out[Ctx] = IMProblem.normalFlow(Src, factsAt(Src, Ctx));
       // need to merge if Dst is a branch target
       if (ICF->isBranchTarget(Src, Dst)) {
-        llvm::outs() << "Num preds: " << ICF->getPredsOf(Dst).size() << '\n';
+        PHASAR_LOG_LEVEL(DEBUG, "Num preds: " << ICF->getPredsOf(Dst).size());
         for (auto Pred : ICF->getPredsOf(Dst)) {
           if (Pred != Src) {
             // we need to compute the out set of Pred and merge it with the
             // out set of Src on-the-fly as we do not have a dedicated
             // storage for merge points (otherwise we run into trouble with
             // merge operator such as set union)
-            auto OtherPredOut = IMProblem.normalFlow(Pred, Analysis[Pred][Ctx]);
+            auto OtherPredOut = IMProblem.normalFlow(Pred, factsAt(Pred, Ctx));
             Out[Ctx] = IMProblem.merge(Out[Ctx], OtherPredOut);
           }
         }
       }
       // Check if data-flow facts have changed and if so, add Edge(s) to
       // worklist again.
-      llvm::outs() << "\nNormal Out[Ctx]:\n";
-      IMProblem.printContainer(llvm::outs(), Out[Ctx]);
-      llvm::outs() << "\nAnalysis[Dst][Ctx]:\n";
-      IMProblem.printContainer(llvm::outs(), Analysis[Dst][Ctx]);
-      bool FlowFactStabilized =
-          IMProblem.equal_to(Out[Ctx], Analysis[Dst][Ctx]);
+      PHASAR_LOG_LEVEL(DEBUG,
+                       "Normal Out[Ctx]: " << containerToString(Out[Ctx]));
+      PHASAR_LOG_LEVEL(DEBUG, "Analysis[Dst][Ctx]: "
+                                  << containerToString(factsAt(Dst, Ctx)));
+      bool FlowFactStabilized = IMProblem.equal_to(Out[Ctx], factsAt(Dst, Ctx));
+      PHASAR_LOG_LEVEL(DEBUG, "Normal stabilized? --> " << FlowFactStabilized);
       if (!FlowFactStabilized) {
-        llvm::outs() << "\nNormal stabilized? --> " << FlowFactStabilized
-                     << '\n';
         auto Merged = Out[Ctx];
-        llvm::outs() << "Normal merged:\n";
-        IMProblem.printContainer(llvm::outs(), Merged);
-        llvm::outs() << '\n';
-        Analysis[Dst][Ctx] = Merged;
+        PHASAR_LOG_LEVEL(DEBUG, "Normal merged: " << containerToString(Merged));
+        factsAt(Dst, Ctx) = Merged;
         addToWorklist({Src, Dst});
       }
     }
@@ -219,60 +284,53 @@ public:
   void processCall(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
+    std::unordered_map<CtxIdTy, mono_container_t> Out;
     if (!isIntraEdge(Edge)) {
-      llvm::outs() << "Handle call flow\n";
-      llvm::outs() << "Src: " << NToString(Src) << '\n';
-      llvm::outs() << "Dst: " << NToString(Dst) << '\n';
-      for (auto &[Ctx, Facts] : Analysis[Src]) {
-        auto CTXAdd(Ctx);
-        CTXAdd.push_back(Src);
+      PHASAR_LOG_LEVEL(DEBUG, "Handle call flow");
+      PHASAR_LOG_LEVEL(DEBUG, "Src: " << NToString(Src));
+      PHASAR_LOG_LEVEL(DEBUG, "Dst: " << NToString(Dst));
+      for (auto Ctx : contextsAt(Src)) {
+        auto CTXAdd = Contexts.push(Ctx, Src);
         Out[CTXAdd] = IMProblem.callFlow(Src, ICF->getFunctionOf(Dst),
-                                         Analysis[Src][Ctx]);
+                                         factsAt(Src, Ctx));
         bool FlowFactStabilized =
-            IMProblem.equal_to(Out[CTXAdd], Analysis[Dst][CTXAdd]);
-        llvm::outs() << "Call Out[CTXAdd]:\n";
-        IMProblem.printContainer(llvm::outs(), Out[CTXAdd]);
-        llvm::outs() << '\n';
-        llvm::outs() << "Call Analysis[Dst][CTXAdd]:\n";
-        IMProblem.printContainer(llvm::outs(), Analysis[Dst][CTXAdd]);
-        llvm::outs() << '\n';
-        llvm::outs() << "Call stabilized? --> " << FlowFactStabilized << '\n';
+            IMProblem.equal_to(Out[CTXAdd], factsAt(Dst, CTXAdd));
+        PHASAR_LOG_LEVEL(DEBUG, "Call Out[CTXAdd]: "
+                                    << containerToString(Out[CTXAdd]));
+        PHASAR_LOG_LEVEL(DEBUG,
+                         "Call Analysis[Dst][CTXAdd]: "
+                             << containerToString(factsAt(Dst, CTXAdd)));
+        PHASAR_LOG_LEVEL(DEBUG, "Call stabilized? --> " << FlowFactStabilized);
         if (!FlowFactStabilized) {
           // auto merge = IMProblem.merge(Analysis[Dst][CTXAdd], Out[CTXAdd]);
           auto Merge = Out[CTXAdd];
-          llvm::outs() << "Call merge:\n";
-          IMProblem.printContainer(llvm::outs(), Merge);
-          llvm::outs() << '\n';
-          Analysis[Dst][CTXAdd] = Merge;
+          PHASAR_LOG_LEVEL(DEBUG, "Call merge: " << containerToString(Merge));
+          factsAt(Dst, CTXAdd) = Merge;
           addToWorklist({Src, Dst});
         }
       }
     } else {
       // Handle call-to-ret flow
-      llvm::outs() << "Handle call to ret flow\n";
-      llvm::outs() << "Src: " << NToString(Src) << '\n';
-      llvm::outs() << "Dst: " << NToString(Dst) << '\n';
-      for (auto &[Ctx, Facts] : Analysis[Src]) {
+      PHASAR_LOG_LEVEL(DEBUG, "Handle call to ret flow");
+      PHASAR_LOG_LEVEL(DEBUG, "Src: " << NToString(Src));
+      PHASAR_LOG_LEVEL(DEBUG, "Dst: " << NToString(Dst));
+      for (auto Ctx : contextsAt(Src)) {
         // call-to-ret flow does not modify contexts
         Out[Ctx] = IMProblem.callToRetFlow(
-            Src, Dst, ICF->getCalleesOfCallAt(Src), Analysis[Src][Ctx]);
+            Src, Dst, ICF->getCalleesOfCallAt(Src), factsAt(Src, Ctx));
         bool FlowFactStabilized =
-            IMProblem.equal_to(Out[Ctx], Analysis[Dst][Ctx]);
-        llvm::outs() << "Call to ret stabilized? --> " << FlowFactStabilized
-                     << '\n';
-        llvm::outs() << "Call Out[Ctx]:\n";
-        IMProblem.printContainer(llvm::outs(), Out[Ctx]);
-        llvm::outs() << '\n';
-        llvm::outs() << "Call Analysis[Dst][CTX]:\n";
-        IMProblem.printContainer(llvm::outs(), Analysis[Dst][Ctx]);
-        llvm::outs() << '\n';
+            IMProblem.equal_to(Out[Ctx], factsAt(Dst, Ctx));
+        PHASAR_LOG_LEVEL(DEBUG,
+                         "Call to ret stabilized? --> " << FlowFactStabilized);
+        PHASAR_LOG_LEVEL(DEBUG,
+                         "Call Out[Ctx]: " << containerToString(Out[Ctx]));
+        PHASAR_LOG_LEVEL(DEBUG, "Call Analysis[Dst][CTX]: "
+                                    << containerToString(factsAt(Dst, Ctx)));
         if (!FlowFactStabilized) {
           auto Merge = Out[Ctx];
-          llvm::outs() << "Call to ret merge:\n";
-          IMProblem.printContainer(llvm::outs(), Merge);
-          llvm::outs() << '\n';
-          Analysis[Dst][Ctx] =
+          PHASAR_LOG_LEVEL(DEBUG,
+                           "Call to ret merge: " << containerToString(Merge));
+          factsAt(Dst, Ctx) =
               Merge; // IMProblem.merge(Analysis[Dst][Ctx], Out[Ctx]);
           addToWorklist({Src, Dst});
         }
@@ -283,24 +341,29 @@ public:
   void processExit(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
-    llvm::outs() << "\nHandle ret flow in: "
-                 << ICF->getFunctionName(ICF->getFunctionOf(Src)) << '\n';
-    llvm::outs() << "Src: " << NToString(Src) << '\n';
-    llvm::outs() << "Dst: " << NToString(Dst) << '\n';
-    for (auto &[Ctx, Facts] : Analysis[Src]) {
-      auto CTXRm(Ctx);
-      CTXRm.print(llvm::outs() << "CTXRm: ") << '\n';
+    std::unordered_map<CtxIdTy, mono_container_t> Out;
+    PHASAR_LOG_LEVEL(DEBUG, "Handle ret flow in: " << ICF->getFunctionName(
+                                ICF->getFunctionOf(Src)));
+    PHASAR_LOG_LEVEL(DEBUG, "Src: " << NToString(Src));
+    PHASAR_LOG_LEVEL(DEBUG, "Dst: " << NToString(Dst));
+    for (auto Ctx : contextsAt(Src)) {
+      auto [CTXRm, LastCallSite] = Contexts.pop(Ctx);
+      IF_LOG_LEVEL_ENABLED(DEBUG, {
+        std::string CtxStr;
+        llvm::raw_string_ostream OS(CtxStr);
+        Contexts.print(OS, CTXRm);
+        PHASAR_LOG_LEVEL(DEBUG, "CTXRm: " << CtxStr);
+      });
       // we need to use several call- and retsites if the context is empty
       llvm::SmallVector<n_t> CallSites;
 
       // handle empty context
-      if (Ctx.empty()) {
+      if (Ctx == EmptyCtx) {
         const auto &Callers = ICF->getCallersOf(ICF->getFunctionOf(Src));
         CallSites.append(Callers.begin(), Callers.end());
       } else {
         // handle context containing at least one element
-        CallSites.push_back(CTXRm.pop_back());
+        CallSites.push_back(LastCallSite);
       }
 
       std::set<n_t> RetSites;
@@ -311,33 +374,29 @@ public:
       }
       for (auto CallSite : CallSites) {
         auto RetFactsPerCall = IMProblem.returnFlow(
-            CallSite, ICF->getFunctionOf(Src), Src, Dst, Analysis[Src][Ctx]);
+            CallSite, ICF->getFunctionOf(Src), Src, Dst, factsAt(Src, Ctx));
         Out[CTXRm].insert(RetFactsPerCall.begin(), RetFactsPerCall.end());
       }
       // TODO!
-      llvm::outs() << "ResSites.size(): " << RetSites.size() << '\n';
+      PHASAR_LOG_LEVEL(DEBUG, "ResSites.size(): " << RetSites.size());
       for (auto RetSite : RetSites) {
-        llvm::outs() << "RetSite: " << NToString(RetSite) << '\n';
-        llvm::outs() << "Return facts: ";
-        IMProblem.printContainer(llvm::outs(), Out[CTXRm]);
-        llvm::outs() << '\n';
-        llvm::outs() << "RetSite facts: ";
-        IMProblem.printContainer(llvm::outs(), Analysis[RetSite][CTXRm]);
-        llvm::outs() << '\n';
+        PHASAR_LOG_LEVEL(DEBUG, "RetSite: " << NToString(RetSite));
+        PHASAR_LOG_LEVEL(DEBUG,
+                         "Return facts: " << containerToString(Out[CTXRm]));
+        PHASAR_LOG_LEVEL(DEBUG, "RetSite facts: " << containerToString(
+                                    factsAt(RetSite, CTXRm)));
         bool FlowFactStabilized =
-            IMProblem.equal_to(Out[CTXRm], Analysis[RetSite][CTXRm]);
-        llvm::outs() << "Ret stabilized? --> " << FlowFactStabilized << '\n';
+            IMProblem.equal_to(Out[CTXRm], factsAt(RetSite, CTXRm));
+        PHASAR_LOG_LEVEL(DEBUG, "Ret stabilized? --> " << FlowFactStabilized);
         if (!FlowFactStabilized) {
+          auto &RetSiteFacts = factsAt(RetSite, CTXRm);
           mono_container_t Merge;
-          Merge.insert(Analysis[RetSite][CTXRm].begin(),
-                       Analysis[RetSite][CTXRm].end());
+          Merge.insert(RetSiteFacts.begin(), RetSiteFacts.end());
           Merge.insert(Out[CTXRm].begin(), Out[CTXRm].end());
-          Analysis[RetSite][CTXRm] = Merge;
-          Analysis[Dst][CTXRm] = Merge;
+          RetSiteFacts = Merge;
+          factsAt(Dst, CTXRm) = Merge;
           // IMProblem.merge(Analysis[RetSite][CTXRm], Out[CTXRm]);
-          llvm::outs() << "Merged to: ";
-          IMProblem.printContainer(llvm::outs(), Merge);
-          llvm::outs() << '\n';
+          PHASAR_LOG_LEVEL(DEBUG, "Merged to: " << containerToString(Merge));
           // addToWorklist({Src, RetSite});
         }
       }
@@ -358,8 +417,7 @@ public:
   virtual void solve() {
     initialize();
     while (!Worklist.empty()) {
-      std::pair<n_t, n_t> Edge = Worklist.front();
-      Worklist.pop_front();
+      std::pair<n_t, n_t> Edge = Worklist.pop();
       auto Src = Edge.first;
       // auto Dst = Edge.second;
       if (ICF->isCallSite(Src)) {
@@ -379,6 +437,15 @@ public:
     }
   }
 
+  [[nodiscard]] MonoWorklistStrategy getWorklistStrategy() const noexcept {
+    return Worklist.getStrategy();
+  }
+
+  /// How often the solver has visited the nodes of the ICFG so far
+  [[nodiscard]] MonoSolverStatistics getStatistics() const {
+    return Worklist.getStatistics();
+  }
+
   mono_container_t getResultsAt(n_t Stmt) {
     mono_container_t Result;
     for (auto &[Ctx, Facts] : Analysis[Stmt]) {
@@ -396,7 +463,7 @@ public:
         OS << "\tEMPTY\n";
       } else {
         for (auto &[Context, FlowFacts] : ContextMap) {
-          Context.print(OS) << '\n';
+          Contexts.print(OS, Context) << '\n';
           if (FlowFacts.empty()) {
             OS << "\tEMPTY\n";
           } else {
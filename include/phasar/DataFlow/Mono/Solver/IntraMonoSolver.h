@@ -18,9 +18,9 @@
 #define PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOSOLVER_H
 
 #include "phasar/DataFlow/Mono/IntraMonoProblem.h"
+#include "phasar/DataFlow/Mono/MonoWorklist.h"
 #include "phasar/Utils/BitVectorSet.h"
 
-#include <deque>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -41,7 +41,7 @@ public:
 
 protected:
   ProblemTy &IMProblem;
-  std::deque<std::pair<n_t, n_t>> Worklist;
+  MonoWorklist<n_t> Worklist;
   std::unordered_map<n_t, mono_container_t> Analysis;
   const CFGBase<c_t> *CFG;
 
@@ -50,10 +50,11 @@ protected:
     for (const auto &EntryPoint : EntryPoints) {
       auto Function =
           IMProblem.getProjectIRDB()->getFunctionDefinition(EntryPoint);
+      Worklist.addNodes(CFG->getStartPointsOf(Function),
+                        [this](n_t Inst) { return CFG->getSuccsOf(Inst); });
       auto ControlFlowEdges = CFG->getAllControlFlowEdges(Function);
       // add all intra-procedural edges to the worklist
-      Worklist.insert(Worklist.begin(), ControlFlowEdges.begin(),
-                      ControlFlowEdges.end());
+      Worklist.pushFront(ControlFlowEdges);
       // set all analysis information to the empty set
       for (auto Insts : CFG->getAllInstructionsOf(Function)) {
         Analysis.insert(std::make_pair(Insts, IMProblem.allTop()));
@@ -66,7 +67,11 @@ protected:
   }
 
 public:
-  IntraMonoSolver(ProblemTy &IMP) : IMProblem(IMP), CFG(IMP.getCFG()) {}
+  IntraMonoSolver(ProblemTy &IMP)
+      : IntraMonoSolver(IMP, IMP.getWorklistStrategy()) {}
+
+  IntraMonoSolver(ProblemTy &IMP, MonoWorklistStrategy Strategy)
+      : IMProblem(IMP), Worklist(Strategy), CFG(IMP.getCFG()) {}
 
   virtual ~IntraMonoSolver() = default;
 
@@ -76,8 +81,7 @@ public:
     // step 2: Iteration (updating Worklist and Analysis)
     while (!Worklist.empty()) {
       // llvm::outs() << "worklist size: " << Worklist.size() << "\n";
-      std::pair<n_t, n_t> Edge = Worklist.front();
-      Worklist.pop_front();
+      std::pair<n_t, n_t> Edge = Worklist.pop();
       n_t Src = Edge.first;
       n_t Dst = Edge.second;
       auto Out = IMProblem.normalFlow(Src, Analysis[Src]);
@@ -97,7 +101,7 @@ public:
       if (!IMProblem.equal_to(Out, Analysis[Dst])) {
         Analysis[Dst] = Out;
         for (auto Nprimeprime : CFG->getSuccsOf(Dst)) {
-          Worklist.push_back({Dst, Nprimeprime});
+          Worklist.push({Dst, Nprimeprime});
         }
       }
     }
@@ -111,6 +115,15 @@ public:
 
   mono_container_t getResultsAt(n_t Stmt) { return Analysis[Stmt]; }
 
+  [[nodiscard]] MonoWorklistStrategy getWorklistStrategy() const noexcept {
+    return Worklist.getStrategy();
+  }
+
+  /// How often the solver has visited the nodes of the CFG so far
+  [[nodiscard]] MonoSolverStatistics getStatistics() const {
+    return Worklist.getStatistics();
+  }
+
   virtual void dumpResults(llvm::raw_ostream &OS = llvm::outs()) {
     OS << "Intra-Monotone solver results:\n"
           "------------------------------\n";
@@ -135,6 +148,10 @@ template <typename Problem>
 IntraMonoSolver(Problem &)
     -> IntraMonoSolver<typename Problem::ProblemAnalysisDomain>;
 
+template <typename Problem>
+IntraMonoSolver(Problem &, MonoWorklistStrategy)
+    -> IntraMonoSolver<typename Problem::ProblemAnalysisDomain>;
+
 template <typename Problem>
 using IntraMonoSolver_P =
     IntraMonoSolver<typename Problem::ProblemAnalysisDomain>;
@@ -12,11 +12,13 @@
 
 #include "phasar/DataFlow/IfdsIde/Solver/ESGEdgeKind.h"
 #include "phasar/Utils/ByRef.h"
+#include "phasar/Utils/DeltaListArena.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/Printer.h"
 #include "phasar/Utils/StableVector.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseMapInfo.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/Sequence.h"
@@ -31,6 +33,7 @@
 #include "llvm/Support/raw_ostream.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <numeric>
 #include <optional>
@@ -40,6 +43,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace psr {
 
@@ -49,6 +53,11 @@ namespace psr {
 /// Not all covered instructions of a BasicBlock might be present; however, it
 /// is guaranteed that for each BasicBlock covered by the analysis there is at
 /// least one node in the ExplicitESG containing an instruction from that BB.
+///
+/// The graph is stored compactly, as it may get as large as the solver's own
+/// tables: Nodes are identified by 32-bit ids, instructions and data-flow
+/// facts are interned once and referenced by 32-bit ids, and the (rare)
+/// neighbor lists are delta-encoded in a chunked DeltaListArena.
 template <typename AnalysisDomainTy> class ExplodedSuperGraph {
 public:
   using n_t = typename AnalysisDomainTy::n_t;
@@ -59,13 +68,8 @@ public:
   };
 
   struct NodeData {
-    d_t Value{};
-    n_t Source{};
-  };
-
-  struct NodeAdj {
-    size_t PredecessorIdx = Node::NoPredId;
-    llvm::SmallVector<size_t, 0> Neighbors{};
+    uint32_t ValueId{};
+    uint32_t SourceId{};
   };
 
   class BuildNodeRef;
@@ -79,36 +83,36 @@ public:
 
     [[nodiscard]] ByConstRef<d_t> value() const noexcept {
       assert(*this);
-      return Owner->NodeDataOwner[NodeId].Value;
+      return Owner->Facts[Owner->NodeDataOwner[NodeId].ValueId];
     }
 
     [[nodiscard]] ByConstRef<n_t> source() const noexcept {
       assert(*this);
-      return Owner->NodeDataOwner[NodeId].Source;
+      return Owner->Insts[Owner->NodeDataOwner[NodeId].SourceId];
     }
 
     [[nodiscard]] NodeRef predecessor() const noexcept {
       assert(*this);
-      auto PredId = Owner->NodeAdjOwner[NodeId].PredecessorIdx;
-      return PredId == Node::NoPredId ? NodeRef() : NodeRef(PredId, Owner);
+      auto PredId = Owner->PredecessorOwner[NodeId];
+      return PredId == NoId ? NodeRef() : NodeRef(PredId, Owner);
     }
 
     [[nodiscard]] bool hasNeighbors() const noexcept {
       assert(*this);
-      return !Owner->NodeAdjOwner[NodeId].Neighbors.empty();
+      return Owner->NeighborLists.count(uint32_t(NodeId));
     }
 
     [[nodiscard]] bool getNumNeighbors() const noexcept {
       assert(*this);
-      return Owner->NodeAdjOwner[NodeId].Neighbors.size();
+      return Owner->NeighborLists.lookup(uint32_t(NodeId)).size();
     }
 
     [[nodiscard]] auto neighbors() const noexcept {
       assert(*this);
 
-      return llvm::map_range(Owner->NodeAdjOwner[NodeId].Neighbors,
-                             [Owner{Owner}](size_t NBIdx) {
-                               assert(NBIdx != Node::NoPredId);
+      return llvm::map_range(Owner->neighborIds(NodeId),
+                             [Owner{Owner}](uint32_t NBIdx) {
+                               assert(NBIdx != NoId);
                                return NodeRef(NBIdx, Owner);
                              });
     }
@@ -171,16 +175,14 @@ public:
   ~ExplodedSuperGraph() = default;
 
   [[nodiscard]] NodeRef getNodeOrNull(n_t Inst, d_t Fact) const {
-    auto It = FlowFactVertexMap.find(
-        std::make_pair(std::move(Inst), std::move(Fact)));
-    if (It != FlowFactVertexMap.end()) {
-      return NodeRef(It->second, this);
+    if (auto NodeId = getNodeIdOrNull(std::move(Inst), std::move(Fact))) {
+      return NodeRef(*NodeId, this);
     }
     return nullptr;
   }
 
   [[nodiscard]] NodeRef fromNodeId(size_t NodeId) const noexcept {
-    assert(NodeDataOwner.size() == NodeAdjOwner.size());
+    assert(NodeDataOwner.size() == PredecessorOwner.size());
     assert(NodeId < NodeDataOwner.size());
 
     return NodeRef(NodeId, this);
@@ -193,7 +195,7 @@ public:
   template <typename Container>
   void saveEdges(n_t Curr, d_t CurrNode, n_t Succ, const Container &SuccNodes,
                  ESGEdgeKind Kind) {
-    auto PredId = getNodeIdOrNull(Curr, std::move(CurrNode));
+    auto PredId = getNodeIdOrNull(Curr, CurrNode);
 
     /// The Identity CTR-flow on the zero-value has no meaning at all regarding
     /// path sensitivity, so skip it
@@ -205,31 +207,31 @@ public:
 
   // NOLINTNEXTLINE(readability-identifier-naming)
   [[nodiscard]] auto node_begin() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
+    assert(PredecessorOwner.size() == NodeDataOwner.size());
     return llvm::map_iterator(
         llvm::seq(size_t(0), NodeDataOwner.size()).begin(), BuildNodeRef(this));
   }
   // NOLINTNEXTLINE(readability-identifier-naming)
   [[nodiscard]] auto node_end() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
+    assert(PredecessorOwner.size() == NodeDataOwner.size());
     return llvm::map_iterator(llvm::seq(size_t(0), NodeDataOwner.size()).end(),
                               BuildNodeRef(this));
   }
   [[nodiscard]] auto nodes() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
+    assert(PredecessorOwner.size() == NodeDataOwner.size());
     return llvm::map_range(llvm::seq(size_t(0), NodeDataOwner.size()),
                            BuildNodeRef(this));
   }
 
   [[nodiscard]] size_t size() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
+    assert(PredecessorOwner.size() == NodeDataOwner.size());
     return NodeDataOwner.size();
   }
 
   /// Printing:
 
   void printAsDot(llvm::raw_ostream &OS) const {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
+    assert(PredecessorOwner.size() == NodeDataOwner.size());
     OS << "digraph ESG{\n";
     psr::scope_exit ClosingBrace = [&OS] { OS << '}'; };
 
@@ -252,64 +254,106 @@ public:
     printAsDot(ROS);
   }
 
+  /// All data-flow facts that are referred to by any node of this graph
+  [[nodiscard]] llvm::ArrayRef<d_t> facts() const noexcept { return Facts; }
+
   void printESGNodes(llvm::raw_ostream &OS) const {
-    for (const auto &[Node, _] : FlowFactVertexMap) {
-      OS << "( " << NToString(Node.first) << "; " << DToString(Node.second)
-         << " )\n";
+    for (const auto &[Key, _] : FlowFactVertexMap) {
+      OS << "( " << NToString(Insts[Key >> 32]) << "; "
+         << DToString(Facts[uint32_t(Key)]) << " )\n";
     }
   }
 
+  /// Approximation of the number of bytes that are allocated by this graph
+  [[nodiscard]] size_t getApproxMemoryUsage() const noexcept {
+    return NodeDataOwner.capacity() * sizeof(NodeData) +
+           PredecessorOwner.capacity() * sizeof(uint32_t) +
+           NeighborLists.getMemorySize() + NeighborArena.getAllocatedBytes() +
+           FlowFactVertexMap.getMemorySize() +
+           Insts.capacity() * sizeof(n_t) + Facts.capacity() * sizeof(d_t) +
+           (InstIds.size() + FactIds.size()) * 4 * sizeof(void *);
+  }
+
 private:
-  struct PathInfoHash {
-    size_t operator()(const std::pair<n_t, d_t> &ND) const {
-      return std::hash<n_t>()(ND.first) * 31 + std::hash<d_t>()(ND.second);
+  static constexpr uint32_t NoId = ~uint32_t(0);
+
+  [[nodiscard]] static uint64_t getKey(uint32_t InstId,
+                                       uint32_t FactId) noexcept {
+    return (uint64_t(InstId) << 32) | FactId;
+  }
+
+  [[nodiscard]] uint32_t internInst(n_t Inst) {
+    auto [It, Inserted] = InstIds.try_emplace(Inst, Insts.size());
+    if (Inserted) {
+      Insts.push_back(std::move(Inst));
     }
-  };
+    return It->second;
+  }
 
-  struct PathInfoEq {
-    bool operator()(const std::pair<n_t, d_t> &Lhs,
-                    const std::pair<n_t, d_t> &Rhs) const {
-      return Lhs.first == Rhs.first && Lhs.second == Rhs.second;
+  [[nodiscard]] uint32_t internFact(ByConstRef<d_t> Fact) {
+    auto [It, Inserted] = FactIds.try_emplace(Fact, Facts.size());
+    if (Inserted) {
+      Facts.push_back(Fact);
+    }
+    return It->second;
+  }
+
+  [[nodiscard]] std::optional<uint32_t>
+  getNodeIdOrNull(ByConstRef<n_t> Inst, ByConstRef<d_t> Fact) const {
+    auto InstIt = InstIds.find(Inst);
+    if (InstIt == InstIds.end()) {
+      return std::nullopt;
+    }
+    auto FactIt = FactIds.find(Fact);
+    if (FactIt == FactIds.end()) {
+      return std::nullopt;
     }
-  };
 
-  [[nodiscard]] std::optional<size_t> getNodeIdOrNull(n_t Inst,
-                                                      d_t Fact) const {
-    auto It = FlowFactVertexMap.find(
-        std::make_pair(std::move(Inst), std::move(Fact)));
-    if (It != FlowFactVertexMap.end()) {
+    auto It = FlowFactVertexMap.find(getKey(InstIt->second, FactIt->second));
+    if (It != FlowFactVertexMap.end() && It->second != NoId) {
       return It->second;
     }
     return std::nullopt;
   }
 
-  void saveEdge(std::optional<size_t> PredId, n_t Curr, d_t CurrNode, n_t Succ,
-                d_t SuccNode, bool MaySkipEdge) {
-    auto [SuccVtxIt, Inserted] = FlowFactVertexMap.try_emplace(
-        std::make_pair(Succ, SuccNode), Node::NoPredId);
+  [[nodiscard]] auto neighborIds(size_t NodeId) const noexcept {
+    auto It = NeighborLists.find(uint32_t(NodeId));
+    return NeighborArena.entries(It != NeighborLists.end()
+                                     ? It->second
+                                     : DeltaListArena::List{});
+  }
 
-    // Save a reference into the FlowFactVertexMap before the SuccVtxIt gets
-    // invalidated
-    auto &SuccVtxNode = SuccVtxIt->second;
+  void saveEdge(std::optional<uint32_t> PredId, n_t Curr,
+                ByConstRef<d_t> CurrNode, n_t Succ, ByConstRef<d_t> SuccNode,
+                bool MaySkipEdge) {
+    auto SuccFactId = internFact(SuccNode);
+    auto SuccKey = getKey(internInst(Succ), SuccFactId);
+    auto [SuccVtxIt, Inserted] = FlowFactVertexMap.try_emplace(SuccKey, NoId);
 
+    // Insertions into the FlowFactVertexMap invalidate the SuccVtxIt, so
+    // only keep the key
+    auto SuccVtxNode = SuccVtxIt->second;
     // NOLINTNEXTLINE(readability-identifier-naming)
-    auto makeNode = [this, PredId, Curr, &CurrNode, &SuccNode]() mutable {
-      assert(NodeAdjOwner.size() == NodeDataOwner.size());
-      auto Ret = NodeDataOwner.size();
+    auto setSuccVtxNode = [this, SuccKey](uint32_t NodeId) {
+      FlowFactVertexMap[SuccKey] = NodeId;
+    };
 
-      auto &NodData = NodeDataOwner.emplace_back();
-      auto &NodAdj = NodeAdjOwner.emplace_back();
-      NodData.Value = SuccNode;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    auto makeNode = [this, PredId, Curr, &CurrNode, SuccFactId]() {
+      assert(PredecessorOwner.size() == NodeDataOwner.size());
+      auto Ret = uint32_t(NodeDataOwner.size());
+      assert(Ret != NoId && "Too many nodes in the ExplodedSuperGraph");
+
+      auto CurrId = internInst(Curr);
+      NodeDataOwner.push_back({SuccFactId, CurrId});
+      PredecessorOwner.push_back(PredId.value_or(NoId));
 
       if (!PredId) {
         // For the seeds: Just that the FlowFactVertexMap is filled at that
         // position...
-        FlowFactVertexMap[std::make_pair(Curr, CurrNode)] = Ret;
+        FlowFactVertexMap[getKey(CurrId, internFact(CurrNode))] = Ret;
       }
 
-      NodAdj.PredecessorIdx = PredId.value_or(Node::NoPredId);
-      NodData.Source = Curr;
-
       return Ret;
     };
 
@@ -318,19 +362,20 @@ private:
       // We still want to create the destination node for the ret-FF later
       assert(PredId);
       if (Inserted) {
-        SuccVtxNode = makeNode();
-        NodeAdjOwner.back().PredecessorIdx = Node::NoPredId;
+        setSuccVtxNode(makeNode());
+        PredecessorOwner.back() = NoId;
       }
       return;
     }
 
-    if (PredId && NodeDataOwner[*PredId].Value == SuccNode &&
-        NodeDataOwner[*PredId].Source->getParent() == Succ->getParent() &&
+    if (PredId && NodeDataOwner[*PredId].ValueId == SuccFactId &&
+        Insts[NodeDataOwner[*PredId].SourceId]->getParent() ==
+            Succ->getParent() &&
         SuccNode != ZeroValue) {
 
       // Identity edge, we don't need a new node; just assign the Pred here
       if (Inserted) {
-        SuccVtxNode = *PredId;
+        setSuccVtxNode(*PredId);
         return;
       }
 
@@ -341,37 +386,45 @@ private:
     }
 
     if (Inserted) {
-      SuccVtxNode = makeNode();
+      setSuccVtxNode(makeNode());
       return;
     }
 
     // Node has already been created, but MaySkipEdge above prevented us from
     // connecting with the pred. Now, we have a non-skippable edge to connect to
-    NodeRef SuccVtx(SuccVtxNode, this);
-    if (!SuccVtx.predecessor()) {
-      NodeAdjOwner[SuccVtxNode].PredecessorIdx =
-          PredId.value_or(Node::NoPredId);
-      NodeDataOwner[SuccVtxNode].Source = Curr;
+    if (PredecessorOwner[SuccVtxNode] == NoId) {
+      PredecessorOwner[SuccVtxNode] = PredId.value_or(NoId);
+      NodeDataOwner[SuccVtxNode].SourceId = internInst(Curr);
       return;
     }
 
     // This node has more than one predecessor; add a neighbor then
-    if (SuccVtx.predecessor().id() != PredId.value_or(Node::NoPredId) &&
-        llvm::none_of(SuccVtx.neighbors(),
-                      [Pred = PredId.value_or(Node::NoPredId)](NodeRef Nd) {
-                        return Nd.predecessor().id() == Pred;
-                      })) {
+    auto Pred = PredId.value_or(NoId);
+    if (PredecessorOwner[SuccVtxNode] != Pred &&
+        llvm::none_of(neighborIds(SuccVtxNode), [this, Pred](uint32_t NB) {
+          return PredecessorOwner[NB] == Pred;
+        })) {
 
       auto NewNode = makeNode();
-      NodeAdjOwner[SuccVtxNode].Neighbors.push_back(NewNode);
+      auto &Neighbors =
+          NeighborLists.try_emplace(SuccVtxNode, SuccVtxNode).first->second;
+      NeighborArena.append(Neighbors, NewNode);
       return;
     }
   }
 
   std::vector<NodeData> NodeDataOwner;
-  std::vector<NodeAdj> NodeAdjOwner;
-  std::unordered_map<std::pair<n_t, d_t>, size_t, PathInfoHash, PathInfoEq>
-      FlowFactVertexMap{};
+  std::vector<uint32_t> PredecessorOwner;
+  /// Only the few nodes with more than one predecessor have neighbors
+  llvm::DenseMap<uint32_t, DeltaListArena::List> NeighborLists;
+  DeltaListArena NeighborArena;
+
+  std::vector<n_t> Insts;
+  std::unordered_map<n_t, uint32_t> InstIds;
+  std::vector<d_t> Facts;
+  std::unordered_map<d_t, uint32_t> FactIds;
+  /// Maps getKey(InstId, FactId) to the node id
+  llvm::DenseMap<uint64_t, uint32_t> FlowFactVertexMap{};
 
   // ZeroValue
   d_t ZeroValue;
@@ -42,8 +42,14 @@ public:
     return false;
   }
 
+  [[nodiscard]] VirtualCallTargetCacheStats
+  getVirtualCallTargetCacheStats() const noexcept override {
+    return CHATargets.getStats();
+  }
+
 protected:
   MaybeUniquePtr<const LLVMTypeHierarchy, true> TH;
+  VirtualCallTargetCache CHATargets;
 };
 } // namespace psr
 
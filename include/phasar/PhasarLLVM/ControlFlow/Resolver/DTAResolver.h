@@ -53,8 +53,17 @@ public:
     return false;
   }
 
+  [[nodiscard]] VirtualCallTargetCacheStats
+  getVirtualCallTargetCacheStats() const noexcept override {
+    auto Ret = CHAResolver::getVirtualCallTargetCacheStats();
+    Ret += DTATargets.getStats();
+    return Ret;
+  }
+
 protected:
   TypeGraph_t TypeGraph;
+  /// Invalidated whenever the TypeGraph changes
+  VirtualCallTargetCache DTATargets;
 
   /**
    * An heuristic that return true if the bitcast instruction is interesting to
@@ -43,10 +43,18 @@ public:
     return false;
   }
 
+  [[nodiscard]] VirtualCallTargetCacheStats
+  getVirtualCallTargetCacheStats() const noexcept override {
+    auto Ret = CHAResolver::getVirtualCallTargetCacheStats();
+    Ret += RTATargets.getStats();
+    return Ret;
+  }
+
 private:
   void resolveAllocatedStructTypes();
 
   std::vector<const llvm::StructType *> AllocatedStructTypes;
+  VirtualCallTargetCache RTATargets;
 };
 } // namespace psr
 
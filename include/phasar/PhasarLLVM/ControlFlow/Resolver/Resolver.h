@@ -17,8 +17,10 @@
 #ifndef PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_RESOLVER_H_
 #define PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_RESOLVER_H_
 
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/VirtualCallTargetCache.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseSet.h"
 
 #include <memory>
@@ -61,6 +63,18 @@ protected:
   getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx,
                             const llvm::CallBase *CallSite);
 
+  /// Same as above, but does not check whether the entry is consistent with a
+  /// specific call-site. Used to fill a VirtualCallTargetCache.
+  const llvm::Function *getNonPureVirtualVFTEntry(const llvm::StructType *T,
+                                                  unsigned Idx);
+
+  /// Adds those of the (cached) Targets to PossibleTargets that are consistent
+  /// with CallSite
+  static void addConsistentTargets(
+      llvm::SmallDenseSet<const llvm::Function *, 4> &PossibleTargets,
+      llvm::ArrayRef<const llvm::Function *> Targets,
+      const llvm::CallBase *CallSite);
+
 public:
   using FunctionSetTy = llvm::SmallDenseSet<const llvm::Function *, 4>;
 
@@ -88,6 +102,13 @@ public:
 
   [[nodiscard]] virtual std::string str() const = 0;
 
+  /// The hit/miss counters of the virtual-call target caches of this resolver,
+  /// if any
+  [[nodiscard]] virtual VirtualCallTargetCacheStats
+  getVirtualCallTargetCacheStats() const noexcept {
+    return {};
+  }
+
   [[nodiscard]] virtual bool mutatesHelperAnalysisInformation() const noexcept {
     // Conservatively returns true. Override if possible
     return true;
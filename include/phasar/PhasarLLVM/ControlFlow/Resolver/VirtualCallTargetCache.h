@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_VIRTUALCALLTARGETCACHE_H
+#define PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_VIRTUALCALLTARGETCACHE_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace llvm {
+class Function;
+class StructType;
+} // namespace llvm
+
+namespace psr {
+
+/// Hit/miss counters of a VirtualCallTargetCache
+struct VirtualCallTargetCacheStats {
+  size_t Hits{};
+  size_t Misses{};
+
+  [[nodiscard]] double getHitRate() const noexcept {
+    auto Total = Hits + Misses;
+    return Total ? double(Hits) / double(Total) : 0.0;
+  }
+
+  VirtualCallTargetCacheStats &
+  operator+=(const VirtualCallTargetCacheStats &Other) noexcept {
+    Hits += Other.Hits;
+    Misses += Other.Misses;
+    return *this;
+  }
+};
+
+/// Memoizes the possible targets of virtual calls per (receiver type, vtable
+/// index) pair, as many call-sites share the same pair.
+///
+/// The cached targets do not depend on the concrete call-site, so they are not
+/// yet checked for signature consistency with it; see isConsistentCall().
+///
+/// This cache is thread-safe.
+class VirtualCallTargetCache {
+public:
+  using TargetListTy = llvm::SmallVector<const llvm::Function *, 4>;
+  using TargetListPtrTy = std::shared_ptr<const TargetListTy>;
+
+  VirtualCallTargetCache() noexcept = default;
+
+  VirtualCallTargetCache(const VirtualCallTargetCache &) = delete;
+  VirtualCallTargetCache &operator=(const VirtualCallTargetCache &) = delete;
+  VirtualCallTargetCache(VirtualCallTargetCache &&) = delete;
+  VirtualCallTargetCache &operator=(VirtualCallTargetCache &&) = delete;
+  ~VirtualCallTargetCache() = default;
+
+  /// Returns the memoized targets for ReceiverTy and VFTIndex, or computes
+  /// them with Compute() and memoizes the result if not found. The returned
+  /// targets are shared with the cache and stay alive even if the cache is
+  /// cleared concurrently.
+  template <typename ComputeFn>
+  [[nodiscard]] TargetListPtrTy getOrCompute(const llvm::StructType *ReceiverTy,
+                                             unsigned VFTIndex,
+                                             ComputeFn &&Compute) {
+    KeyT Key{ReceiverTy, VFTIndex};
+    {
+      std::shared_lock Lck(Mtx);
+      if (auto It = Cache.find(Key); It != Cache.end()) {
+        Hits.fetch_add(1, std::memory_order_relaxed);
+        return It->second;
+      }
+    }
+
+    // Compute outside of the lock; this walks the type hierarchy
+    auto Targets = std::make_shared<TargetListTy>(
+        std::invoke(std::forward<ComputeFn>(Compute)));
+    // Different sub-types may inherit the same implementation
+    llvm::sort(*Targets);
+    Targets->erase(std::unique(Targets->begin(), Targets->end()),
+                   Targets->end());
+
+    Misses.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard Lck(Mtx);
+    // Another thread may have been faster; then, use its result
+    return Cache.try_emplace(Key, std::move(Targets)).first->second;
+  }
+
+  [[nodiscard]] VirtualCallTargetCacheStats getStats() const noexcept {
+    return {
+        Hits.load(std::memory_order_relaxed),
+        Misses.load(std::memory_order_relaxed),
+    };
+  }
+
+  [[nodiscard]] size_t size() const {
+    std::shared_lock Lck(Mtx);
+    return Cache.size();
+  }
+
+  /// Invalidates all memoized targets, e.g., because the information they are
+  /// computed from has changed. Targets that have been returned before stay
+  /// valid. Keeps the hit/miss counters.
+  void clear() {
+    std::lock_guard Lck(Mtx);
+    Cache.clear();
+  }
+
+private:
+  using KeyT = std::pair<const llvm::StructType *, unsigned>;
+
+  llvm::DenseMap<KeyT, TargetListPtrTy> Cache;
+  std::atomic_size_t Hits{};
+  std::atomic_size_t Misses{};
+  mutable std::shared_mutex Mtx;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_VIRTUALCALLTARGETCACHE_H
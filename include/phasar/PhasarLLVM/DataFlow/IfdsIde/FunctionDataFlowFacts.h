@@ -1,9 +1,13 @@
 #include "phasar/Utils/DefaultValue.h"
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/Twine.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -17,12 +21,78 @@ struct Parameter {
 struct ReturnValue {};
 
 struct DataFlowFact {
-  DataFlowFact(Parameter Param) noexcept : Fact(Param) {}
-  DataFlowFact(ReturnValue Ret) noexcept : Fact(Ret) {}
+  constexpr DataFlowFact(Parameter Param) noexcept : Fact(Param) {}
+  constexpr DataFlowFact(ReturnValue Ret) noexcept : Fact(Ret) {}
 
   std::variant<Parameter, ReturnValue> Fact;
 };
 
+/// One row of a read-only library summary: Data flows from the parameter
+/// ParamIndex of the function FunctionName to Fact.
+struct LibrarySummaryEntry {
+  std::string_view FunctionName;
+  uint32_t ParamIndex{};
+  DataFlowFact Fact;
+};
+
+/// A read-only library summary that is stored as an array of
+/// LibrarySummaryEntry sorted by FunctionName.
+///
+/// The entries can be defined as constexpr array, such that the summary lives
+/// in the read-only data segment and does not require any initialization at
+/// runtime. Use isSorted() to verify the order in a static_assert.
+class LibrarySummaryTable {
+public:
+  constexpr LibrarySummaryTable() noexcept = default;
+  constexpr LibrarySummaryTable(
+      llvm::ArrayRef<LibrarySummaryEntry> Entries) noexcept
+      : Entries(Entries) {}
+
+  /// Returns all entries of the function with the given name, in the order of
+  /// their definition. Runs in O(log n).
+  [[nodiscard]] llvm::ArrayRef<LibrarySummaryEntry>
+  getEntriesForFunction(llvm::StringRef FuncKey) const noexcept {
+    auto [Beg, End] = std::equal_range(Entries.begin(), Entries.end(),
+                                       std::string_view(FuncKey), KeyLess{});
+    return {Beg, End};
+  }
+
+  [[nodiscard]] bool contains(llvm::StringRef FuncKey) const noexcept {
+    return !getEntriesForFunction(FuncKey).empty();
+  }
+
+  [[nodiscard]] auto begin() const noexcept { return Entries.begin(); }
+  [[nodiscard]] auto end() const noexcept { return Entries.end(); }
+
+  [[nodiscard]] size_t size() const noexcept { return Entries.size(); }
+  [[nodiscard]] bool empty() const noexcept { return Entries.empty(); }
+
+  template <size_t N>
+  [[nodiscard]] static constexpr bool
+  isSorted(const LibrarySummaryEntry (&Entries)[N]) noexcept {
+    for (size_t I = 1; I < N; ++I) {
+      if (Entries[I].FunctionName < Entries[I - 1].FunctionName) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  struct KeyLess {
+    bool operator()(const LibrarySummaryEntry &Entry,
+                    std::string_view Key) const noexcept {
+      return Entry.FunctionName < Key;
+    }
+    bool operator()(std::string_view Key,
+                    const LibrarySummaryEntry &Entry) const noexcept {
+      return Key < Entry.FunctionName;
+    }
+  };
+
+  llvm::ArrayRef<LibrarySummaryEntry> Entries;
+};
+
 class FunctionDataFlowFacts {
 public:
   using ParamaterMappingTy =
@@ -30,6 +100,12 @@ public:
 
   FunctionDataFlowFacts() noexcept = default;
 
+  explicit FunctionDataFlowFacts(const LibrarySummaryTable &Table) {
+    for (const auto &Entry : Table) {
+      addElement(Entry.FunctionName, Entry.ParamIndex, Entry.Fact);
+    }
+  }
+
   // insert a set of data flow facts
   void insertSet(llvm::StringRef FuncKey, uint32_t Index,
                  std::vector<DataFlowFact> OutSet) {
@@ -73,4 +149,26 @@ private:
   llvm::StringMap<ParamaterMappingTy> Fdff;
 };
 
+/// Reads a library summary from the JSON file at Path. See
+/// parseFunctionDataFlowFacts() for the expected format.
+[[nodiscard]] FunctionDataFlowFacts
+readFunctionDataFlowFacts(const llvm::Twine &Path);
+
+/// Parses a library summary from a JSON string of the following form:
+///
+/// {
+///   "<function-name>": [
+///     { "from": <param-index>, "to": <param-index> },
+///     { "from": <param-index>, "to": "ret" },
+///     ...
+///   ],
+///   ...
+/// }
+///
+/// Each object describes a data-flow from a parameter of the function either
+/// to another parameter or to the return value. Malformed entries are skipped
+/// with a warning.
+[[nodiscard]] FunctionDataFlowFacts
+parseFunctionDataFlowFacts(llvm::StringRef JsonAsString);
+
 } // namespace psr::library_summary
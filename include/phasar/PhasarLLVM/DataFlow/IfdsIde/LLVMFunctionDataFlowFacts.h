@@ -14,6 +14,12 @@ class LLVMFunctionDataFlowFacts;
 [[nodiscard]] LLVMFunctionDataFlowFacts
 readFromFDFF(const FunctionDataFlowFacts &Fdff, const LLVMProjectIRDB &Irdb);
 
+/// Resolves the entries of Table against the functions of Irdb in a single
+/// pass over the module's functions.
+[[nodiscard]] LLVMFunctionDataFlowFacts
+readFromSummaryTable(const LibrarySummaryTable &Table,
+                     const LLVMProjectIRDB &Irdb);
+
 class LLVMFunctionDataFlowFacts {
 public:
   LLVMFunctionDataFlowFacts() noexcept = default;
@@ -67,6 +73,9 @@ public:
 
   friend LLVMFunctionDataFlowFacts
   readFromFDFF(const FunctionDataFlowFacts &Fdff, const LLVMProjectIRDB &Irdb);
+  friend LLVMFunctionDataFlowFacts
+  readFromSummaryTable(const LibrarySummaryTable &Table,
+                       const LLVMProjectIRDB &Irdb);
 
 private:
   std::unordered_map<const llvm::Function *, ParamaterMappingTy> LLVMFdff;
@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMSOLVERCHECKPOINTCODEC_H
+#define PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMSOLVERCHECKPOINTCODEC_H
+
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolverCheckpointCodec.h"
+
+#include "llvm/ADT/StringRef.h"
+
+#include <optional>
+#include <string>
+
+namespace llvm {
+class Instruction;
+class Value;
+class Function;
+} // namespace llvm
+
+namespace psr {
+class LLVMProjectIRDB;
+
+/// Encodes the LLVM statements, data-flow facts and functions of a solver
+/// checkpoint by their PhASAR metadata ids (see getMetaDataID()) and
+/// function names, respectively. Hence, a checkpoint can only be restored
+/// on the same IR, from which it has been created.
+///
+/// Facts that have no metadata id, e.g., constants, cannot be encoded.
+class LLVMCheckpointEntityCodec {
+public:
+  explicit LLVMCheckpointEntityCodec(const LLVMProjectIRDB &IRDB) noexcept
+      : IRDB(&IRDB) {}
+
+  [[nodiscard]] std::optional<std::string>
+  encodeNode(const llvm::Instruction *Inst) const;
+  [[nodiscard]] std::optional<const llvm::Instruction *>
+  decodeNode(llvm::StringRef Str) const;
+
+  [[nodiscard]] std::optional<std::string>
+  encodeFact(const llvm::Value *Fact) const;
+  [[nodiscard]] std::optional<const llvm::Value *>
+  decodeFact(llvm::StringRef Str) const;
+
+  [[nodiscard]] std::optional<std::string>
+  encodeFunction(const llvm::Function *Fun) const;
+  [[nodiscard]] std::optional<const llvm::Function *>
+  decodeFunction(llvm::StringRef Str) const;
+
+private:
+  const LLVMProjectIRDB *IRDB{};
+};
+
+/// The checkpoint codec for LLVM-based analyses whose edge functions are
+/// handled by the DefaultEdgeFunctionCheckpointCodec, e.g., all IFDS
+/// analyses.
+template <typename L>
+class LLVMSolverCheckpointCodec : public LLVMCheckpointEntityCodec,
+                                  public DefaultEdgeFunctionCheckpointCodec<L> {
+public:
+  using LLVMCheckpointEntityCodec::LLVMCheckpointEntityCodec;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMSOLVERCHECKPOINTCODEC_H
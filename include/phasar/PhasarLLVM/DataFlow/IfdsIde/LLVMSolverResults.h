@@ -11,6 +11,7 @@
 #define PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMSOLVERRESULTS_H
 
 #include "phasar/DataFlow/IfdsIde/SolverResults.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 #include "phasar/Utils/JoinLattice.h"
 #include "phasar/Utils/Logger.h"
 
@@ -27,76 +28,115 @@ namespace psr::detail {
 /// here yet (TODO!)
 template <typename Derived, typename N, typename D, typename L>
 template <typename NTy>
-auto SolverResultsBase<Derived, N, D, L>::resultsAtInLLVMSSA(
-    ByConstRef<n_t> Stmt, bool AllowOverapproximation, bool StripZero) const ->
-    typename std::enable_if_t<
-        std::is_same_v<std::decay_t<std::remove_pointer_t<NTy>>,
-                       llvm::Instruction>,
-        std::unordered_map<d_t, l_t>> {
-  std::unordered_map<d_t, l_t> Result = [this, Stmt, AllowOverapproximation]() {
-    if (Stmt->getType()->isVoidTy()) {
-      return self().Results.row(Stmt);
-    }
-    if (!Stmt->getNextNode()) {
-      auto GetStartRow = [this](const llvm::BasicBlock *BB) -> decltype(auto) {
-        const auto *First = &BB->front();
-        if (llvm::isa<llvm::DbgInfoIntrinsic>(First)) {
-          First = First->getNextNonDebugInstruction();
-        }
-        return self().Results.row(First);
-      };
-
-      // We have reached the end of a BasicBlock. If there is a successor BB
-      // that only has one predecessor, we are lucky and can just take results
-      // from there
-      for (const llvm::BasicBlock *Succ : llvm::successors(Stmt)) {
-        if (Succ->hasNPredecessors(1)) {
-          return GetStartRow(Succ);
-        }
-      }
+auto SolverResultsBase<Derived, N, D, L>::getRowInLLVMSSA(
+    ByConstRef<n_t> Stmt, bool AllowOverapproximation) const
+    -> const std::unordered_map<d_t, l_t> * {
+  static_assert(std::is_same_v<std::decay_t<std::remove_pointer_t<NTy>>,
+                               llvm::Instruction>);
 
-      if (!AllowOverapproximation) {
-        llvm::report_fatal_error("[resultsAtInLLVMSSA]: Cannot precisely "
-                                 "collect the results at instruction " +
-                                 llvm::Twine(llvmIRToString(Stmt)));
+  if (Stmt->getType()->isVoidTy()) {
+    return &self().Results.row(Stmt);
+  }
+  if (Stmt->getNextNode()) {
+    return &self().Results.row(Stmt->getNextNode());
+  }
+
+  // We have reached the end of a BasicBlock. If there is a successor BB
+  // that only has one predecessor, we are lucky and can just take results
+  // from there
+  for (const llvm::BasicBlock *Succ : llvm::successors(Stmt)) {
+    if (Succ->hasNPredecessors(1)) {
+      const auto *First = &Succ->front();
+      if (llvm::isa<llvm::DbgInfoIntrinsic>(First)) {
+        First = First->getNextNonDebugInstruction();
       }
+      return &self().Results.row(First);
+    }
+  }
 
-      // There is no successor with only one predecessor.
-      // All we can do is merge the results from all successors to get a sound
-      // overapproximation. This is not optimal and may be replaced in the
-      // future.
-      PHASAR_LOG_LEVEL(WARNING, "[resultsAtInLLVMSSA]: Cannot precisely "
-                                "collect the results at instruction "
-                                    << llvmIRToString(Stmt)
-                                    << ". Use a sound, but potentially "
-                                       "imprecise overapproximation");
-      std::unordered_map<d_t, l_t> Ret;
-      for (const llvm::BasicBlock *Succ : llvm::successors(Stmt)) {
-        const auto &Row = GetStartRow(Succ);
-        for (const auto &[Fact, Value] : Row) {
-          auto [It, Inserted] = Ret.try_emplace(Fact, Value);
-          if (!Inserted && Value != It->second) {
-            if constexpr (HasJoinLatticeTraits<l_t>) {
-              It->second = JoinLatticeTraits<l_t>::join(It->second, Value);
-            } else {
-              // We have no way of correctly merging, so set the value to the
-              // default constructed l_t hoping it marks BOTTOM.
-              It->second = l_t();
-            }
-          }
+  if (!AllowOverapproximation) {
+    llvm::report_fatal_error("[resultsAtInLLVMSSA]: Cannot precisely "
+                             "collect the results at instruction " +
+                             llvm::Twine(llvmIRToString(Stmt)));
+  }
+  return nullptr;
+}
+
+template <typename Derived, typename N, typename D, typename L>
+template <typename NTy>
+auto SolverResultsBase<Derived, N, D, L>::joinSuccessorRowsInLLVMSSA(
+    ByConstRef<n_t> Stmt) const -> std::unordered_map<d_t, l_t> {
+  // There is no successor with only one predecessor.
+  // All we can do is merge the results from all successors to get a sound
+  // overapproximation. This is not optimal and may be replaced in the
+  // future.
+  PHASAR_LOG_LEVEL(WARNING, "[resultsAtInLLVMSSA]: Cannot precisely "
+                            "collect the results at instruction "
+                                << llvmIRToString(Stmt)
+                                << ". Use a sound, but potentially "
+                                   "imprecise overapproximation");
+  std::unordered_map<d_t, l_t> Ret;
+  for (const llvm::BasicBlock *Succ : llvm::successors(Stmt)) {
+    const auto *First = &Succ->front();
+    if (llvm::isa<llvm::DbgInfoIntrinsic>(First)) {
+      First = First->getNextNonDebugInstruction();
+    }
+    for (const auto &[Fact, Value] : self().Results.row(First)) {
+      auto [It, Inserted] = Ret.try_emplace(Fact, Value);
+      if (!Inserted && Value != It->second) {
+        if constexpr (HasJoinLatticeTraits<l_t>) {
+          It->second = JoinLatticeTraits<l_t>::join(It->second, Value);
+        } else {
+          // We have no way of correctly merging, so set the value to the
+          // default constructed l_t hoping it marks BOTTOM.
+          It->second = l_t();
         }
       }
-      return Ret;
     }
-    assert(Stmt->getNextNode() && "Expected to find a valid successor node!");
-    return self().Results.row(Stmt->getNextNode());
-  }();
+  }
+  return Ret;
+}
+
+template <typename Derived, typename N, typename D, typename L>
+template <typename NTy>
+auto SolverResultsBase<Derived, N, D, L>::resultsAtInLLVMSSA(
+    ByConstRef<n_t> Stmt, bool AllowOverapproximation, bool StripZero) const ->
+    typename std::enable_if_t<
+        std::is_same_v<std::decay_t<std::remove_pointer_t<NTy>>,
+                       llvm::Instruction>,
+        std::unordered_map<d_t, l_t>> {
+  const auto *Row = getRowInLLVMSSA<NTy>(Stmt, AllowOverapproximation);
+  std::unordered_map<d_t, l_t> Result =
+      Row ? *Row : joinSuccessorRowsInLLVMSSA<NTy>(Stmt);
   if (StripZero) {
     Result.erase(self().ZV);
   }
   return Result;
 }
 
+template <typename Derived, typename N, typename D, typename L>
+template <typename HandlerFn, typename NTy>
+auto SolverResultsBase<Derived, N, D, L>::foreachResultAtInLLVMSSA(
+    ByConstRef<n_t> Stmt, HandlerFn &&Handler, bool AllowOverapproximation,
+    bool StripZero) const ->
+    typename std::enable_if_t<std::is_same_v<
+        std::decay_t<std::remove_pointer_t<NTy>>, llvm::Instruction>> {
+  auto Visit = [this, &Handler, StripZero](const auto &Row) {
+    for (const auto &[Fact, Value] : Row) {
+      if (StripZero && Fact == self().ZV) {
+        continue;
+      }
+      std::invoke(Handler, Fact, Value);
+    }
+  };
+
+  if (const auto *Row = getRowInLLVMSSA<NTy>(Stmt, AllowOverapproximation)) {
+    Visit(*Row);
+  } else {
+    Visit(joinSuccessorRowsInLLVMSSA<NTy>(Stmt));
+  }
+}
+
 template <typename Derived, typename N, typename D, typename L>
 template <typename NTy>
 auto SolverResultsBase<Derived, N, D, L>::resultAtInLLVMSSA(
@@ -3,7 +3,14 @@
 namespace psr {
 namespace library_summary {
 class FunctionDataFlowFacts;
+class LibrarySummaryTable;
 } // namespace library_summary
 
+/// The LibC summary as read-only table. Does not require any initialization.
+[[nodiscard]] library_summary::LibrarySummaryTable
+getLibCSummaryTable() noexcept;
+
+/// The LibC summary as mutable FunctionDataFlowFacts. Built from
+/// getLibCSummaryTable() on first use.
 [[nodiscard]] const library_summary::FunctionDataFlowFacts &getLibCSummary();
 } // namespace psr
@@ -14,9 +14,11 @@
 
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/FoldingSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/TrailingObjects.h"
+#include "llvm/Support/raw_ostream.h"
 
 #include <memory>
 #include <vector>
@@ -27,6 +29,43 @@ class GetElementPtrInst;
 } // namespace llvm
 
 namespace psr {
+
+/// Memory statistics of an AbstractMemoryLocationFactory. Useful to measure
+/// the effect of the k-limit (BOUND) on the number of distinct memory
+/// locations.
+struct AbstractMemoryLocationStatistics {
+  /// The number of distinct (hash-consed) memory locations
+  size_t NumLocations = 0;
+  /// The number of llvm::Values whose memory location is cached
+  size_t NumCachedValues = 0;
+  /// The number of arena blocks allocated so far
+  size_t NumBlocks = 0;
+  /// The total number of bytes allocated for the arena blocks
+  size_t NumAllocatedBytes = 0;
+  /// The number of bytes within the arena blocks that are occupied by memory
+  /// locations
+  size_t NumUsedBytes = 0;
+  /// The number of bytes within the arena blocks that have been reclaimed by
+  /// the garbage collection and are available for reuse
+  size_t NumFreeBytes = 0;
+  /// The number of requests that could be answered with an already existing
+  /// memory location
+  size_t NumPoolHits = 0;
+  /// The number of requests that required to allocate a new memory location
+  size_t NumPoolMisses = 0;
+  /// The number of create() requests that hit the llvm::Value-cache
+  size_t NumCacheHits = 0;
+  /// The number of garbage collections
+  size_t NumCollections = 0;
+  /// The number of memory locations that have been reclaimed by the garbage
+  /// collections
+  size_t NumReclaimedLocations = 0;
+
+  friend llvm::raw_ostream &
+  operator<<(llvm::raw_ostream &OS,
+             const AbstractMemoryLocationStatistics &Stats);
+};
+
 namespace detail {
 
 /// A factory for detail::AbstractMemoryLocationImpl. Caches all intermedicate
@@ -50,6 +89,12 @@ private:
     Block *Root = nullptr;
     void **Pos = nullptr, **End = nullptr;
     size_t InitialCapacity{};
+    size_t NumBlocks{};
+    size_t NumAllocatedBytes{};
+    size_t NumUsedBytes{};
+    size_t NumFreeBytes{};
+    /// Reclaimed slots, indexed by their size in pointers
+    std::vector<std::vector<void **>> FreeLists;
 
     Allocator() noexcept = default;
     Allocator(size_t InitialCapacity);
@@ -63,6 +108,8 @@ private:
     AbstractMemoryLocationImpl *create(const llvm::Value *Baseptr,
                                        size_t Lifetime,
                                        llvm::ArrayRef<ptrdiff_t> Offsets);
+    /// Puts the slot of AML onto the free-list for reuse
+    void destroy(AbstractMemoryLocationImpl *AML);
 
   private:
     constexpr static size_t ExpectedNumAmLsPerBlock = 1024;
@@ -81,6 +128,18 @@ private:
                  const detail::AbstractMemoryLocationImpl *>
       Cache;
 
+  /// The impls that have been created since the last garbage collection.
+  /// Only tracked after the first (full) collection.
+  std::vector<const detail::AbstractMemoryLocationImpl *> YoungGeneration;
+  /// The impls that have been marked live for the next garbage collection
+  llvm::DenseSet<const detail::AbstractMemoryLocationImpl *> LiveMarks;
+
+  size_t NumPoolHits = 0;
+  size_t NumPoolMisses = 0;
+  size_t NumCacheHits = 0;
+  size_t NumCollections = 0;
+  size_t NumReclaimedLocations = 0;
+
 #ifdef XTAINT_DIAGNOSTICS
   llvm::DenseSet<const detail::AbstractMemoryLocationImpl *>
       overApproximatedAMLs;
@@ -122,6 +181,8 @@ protected:
   const AbstractMemoryLocationImpl *
   limitImpl(const AbstractMemoryLocationImpl *AML);
 
+  void markLiveImpl(const AbstractMemoryLocationImpl *AML);
+
 public:
   AbstractMemoryLocationFactoryBase(size_t InitialCapacity);
   AbstractMemoryLocationFactoryBase(const llvm::DataLayout *DL,
@@ -130,6 +191,24 @@ public:
 
   [[nodiscard]] inline size_t size() const { return Pool.size(); }
 
+  [[nodiscard]] AbstractMemoryLocationStatistics getStatistics() const;
+
+  /// Reclaims the memory of all memory locations that have not been marked
+  /// live (see AbstractMemoryLocationFactory::markLive()) since the last
+  /// collection. The reclaimed memory is reused for new memory locations.
+  ///
+  /// A minor collection (Full = false) only considers the young generation,
+  /// i.e., the memory locations that have been created since the last
+  /// collection; the survivors are promoted to the old generation. The first
+  /// collection is always a full collection.
+  ///
+  /// It is the caller's responsibility to mark *all* memory locations that
+  /// are still referenced anywhere, e.g., in the tables of the IDESolver.
+  /// References to reclaimed memory locations are dangling.
+  ///
+  /// \returns The number of reclaimed memory locations
+  size_t collectGarbage(bool Full = false);
+
 #ifdef XTAINT_DIAGNOSTICS
   inline size_t getNumOverApproximatedFacts() const {
     return overApproximatedAMLs.size();
@@ -168,6 +247,11 @@ public:
     return {getOrCreateZeroImpl()};
   }
 
+  /// Marks AML as live for the next call to collectGarbage()
+  void markLive(const AbstractMemoryLocation &AML) {
+    markLiveImpl(AML.operator->());
+  }
+
   /// Creates a decendant AbstractMemoryLocation by adding an indirection
   /// (through a store instructon) on AML. The Ind offset-slice can be used to
   /// store indirect taints.
@@ -17,14 +17,17 @@ namespace psr::XTaint {
 
 struct KillIfSanitizedEdgeFunction
     : EdgeFunctionBase<KillIfSanitizedEdgeFunction> {
-  BasicBlockOrdering *BBO{};
-  const llvm::Instruction *Load{};
+  /// Interned by the SanitizerCheckPool of the analysis. Only the Load is
+  /// relevant here
+  const SanitizerCheck *Check{};
 
   using l_t = EdgeDomain;
 
   [[nodiscard]] l_t computeTarget(ByConstRef<l_t> Source) const;
 
-  [[nodiscard]] inline const llvm::Instruction *getLoad() const { return Load; }
+  [[nodiscard]] inline const llvm::Instruction *getLoad() const {
+    return Check->Load;
+  }
 };
 
 llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
@@ -17,9 +17,8 @@ namespace psr::XTaint {
 struct TransferEdgeFunction : EdgeFunctionBase<TransferEdgeFunction> {
   using l_t = EdgeDomain;
 
-  BasicBlockOrdering *BBO{};
-  const llvm::Instruction *Load{};
-  const llvm::Instruction *To{};
+  /// Interned by the SanitizerCheckPool of the analysis
+  const SanitizerCheck *Check{};
 
   [[nodiscard]] l_t computeTarget(ByConstRef<l_t> Source) const;
 
@@ -13,15 +13,48 @@
 #include "phasar/DataFlow/IfdsIde/EdgeFunctionUtils.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/AllSanitized.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/EdgeDomain.h"
+#include "phasar/Utils/StableVector.h"
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Hashing.h"
 
 #include <memory>
+#include <utility>
 
 namespace psr::XTaint {
 
 static constexpr size_t JoinThreshold = 2;
 
+/// The parameters of the edge functions that check for sanitizers, i.e.
+/// KillIfSanitizedEdgeFunction and TransferEdgeFunction.
+struct SanitizerCheck {
+  BasicBlockOrdering *BBO{};
+  const llvm::Instruction *Load{};
+  const llvm::Instruction *To{};
+};
+
+/// Interns SanitizerCheck objects, such that the edge functions referring to
+/// them only need to store a single pointer. This way, they fit into the
+/// small-object buffer of EdgeFunction and do not require a heap-allocation.
+class SanitizerCheckPool {
+public:
+  explicit SanitizerCheckPool(BasicBlockOrdering &BBO) noexcept : BBO(&BBO) {}
+
+  [[nodiscard]] const SanitizerCheck *
+  getOrCreate(const llvm::Instruction *Load,
+              const llvm::Instruction *To = nullptr);
+
+  [[nodiscard]] size_t size() const noexcept { return Storage.size(); }
+
+private:
+  BasicBlockOrdering *BBO{};
+  StableVector<SanitizerCheck> Storage;
+  llvm::DenseMap<
+      std::pair<const llvm::Instruction *, const llvm::Instruction *>,
+      const SanitizerCheck *>
+      Cache;
+};
+
 EdgeFunction<EdgeDomain> makeComposeEF(const EdgeFunction<EdgeDomain> &F,
                                        const EdgeFunction<EdgeDomain> &G);
 
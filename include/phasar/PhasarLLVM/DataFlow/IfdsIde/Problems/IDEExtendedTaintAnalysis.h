@@ -19,6 +19,7 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/EdgeDomain.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/Helpers.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/XTaintAnalysisBase.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/XTaintEdgeFunctionBase.h"
 #include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
 #include "phasar/PhasarLLVM/TaintConfig/LLVMTaintConfig.h"
@@ -185,7 +186,7 @@ public:
                            bool DisableStrongUpdates,
                            GetDomTree &&GDT = DefaultDominatorTreeAnalysis{})
       : base_t(IRDB, std::move(EntryPoints), std::nullopt), AnalysisBase(TSF),
-        PT(PT), ICF(ICF), BBO(std::forward<GetDomTree>(GDT)),
+        PT(PT), ICF(ICF), BBO(std::forward<GetDomTree>(GDT)), SaniChecks(BBO),
         FactFactory(IRDB->getNumInstructions()),
         DL(IRDB->getModule()->getDataLayout()), Bound(Bound),
         PostProcessed(DisableStrongUpdates),
@@ -264,6 +265,8 @@ private:
   // Used for determining whether a dataflow fact is still tained or already
   // sanitized
   BasicBlockOrdering BBO;
+  /// Interned parameters for the sanitizer-checking edge functions
+  SanitizerCheckPool SaniChecks;
 
   AbstractMemoryLocationFactory<d_t> FactFactory;
   const llvm::DataLayout &DL;
@@ -305,6 +308,35 @@ public:
   [[nodiscard]] inline size_t getNumDataflowFacts() const {
     return FactFactory.size();
   }
+  /// Statistics about the memory consumed by the AbstractMemoryLocations
+  /// (the dataflow facts) of this analysis
+  [[nodiscard]] inline AbstractMemoryLocationStatistics
+  getFactStatistics() const {
+    return FactFactory.getStatistics();
+  }
+
+  /// Reclaims the memory of all dataflow facts that are referenced neither by
+  /// the Solver nor by this analysis. Unless Full is set, only the facts that
+  /// have been created since the last collection are considered. Drops the
+  /// flow- and edge-function caches of Solver.
+  ///
+  /// May only be called while Solver is paused, e.g., between calls to
+  /// nextN(), or after it has finished. Use getFactStatistics() to decide
+  /// when to collect.
+  ///
+  /// \returns The number of reclaimed facts
+  template <typename SolverT>
+  size_t collectGarbage(SolverT &Solver, bool Full = false) {
+    Solver.clearFlowEdgeFunctionCaches();
+    Solver.foreachLiveFact([this](d_t Fact) { FactFactory.markLive(Fact); });
+#ifdef XTAINT_DIAGNOSTICS
+    for (auto Fact : allTaintedValues) {
+      FactFactory.markLive(Fact);
+    }
+#endif
+    return FactFactory.collectGarbage(Full);
+  }
+
 #ifdef XTAINT_DIAGNOSTICS
   // Note: This number is probably smaller than getNumDataflowFacts()
   inline size_t getNumTaintedValues() const { return allTaintedValues.size(); }
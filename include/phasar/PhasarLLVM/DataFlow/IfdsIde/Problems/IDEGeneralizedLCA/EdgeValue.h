@@ -36,6 +36,7 @@ private:
 public:
   EdgeValue(const llvm::Value *Val);
   EdgeValue(const EdgeValue &EV);
+  EdgeValue(EdgeValue &&EV) noexcept = default;
   EdgeValue(llvm::APInt &&VI);
   EdgeValue(const llvm::APInt &VI);
   EdgeValue(llvm::APFloat &&VF);
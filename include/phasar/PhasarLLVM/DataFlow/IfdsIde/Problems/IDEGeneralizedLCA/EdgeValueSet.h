@@ -13,31 +13,50 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValue.h"
 #include "phasar/Utils/JoinLattice.h"
 
+#include "llvm/ADT/SmallVector.h"
+
 #include <initializer_list>
-#include <unordered_set>
+#include <utility>
 
 namespace psr::glca {
 
+/// A set of EdgeValues.
+///
+/// The sets are bounded by a small k (see IDEGeneralizedLCA's MaxSetSize), so
+/// we store the elements unordered in a small vector and search them linearly.
+/// This avoids the node- and bucket allocations and the hashing of a
+/// std::unordered_set for every lattice operation.
 class EdgeValueSet {
-  std::unordered_set<EdgeValue> Underlying;
+public:
+  static constexpr size_t InlineCapacity = 2;
+
+private:
+  llvm::SmallVector<EdgeValue, InlineCapacity> Underlying;
 
 public:
+  using iterator = typename decltype(Underlying)::iterator;
+  using const_iterator = typename decltype(Underlying)::const_iterator;
+
   EdgeValueSet();
-  template <typename Iter>
-  EdgeValueSet(Iter Begin, Iter End) : Underlying(Begin, End) {}
+  template <typename Iter> EdgeValueSet(Iter Begin, Iter End) {
+    for (; Begin != End; ++Begin) {
+      insert(*Begin);
+    }
+  }
   EdgeValueSet(std::initializer_list<EdgeValue> IList);
-  auto begin() -> decltype(Underlying.begin());
-  auto end() -> decltype(Underlying.end());
-  auto begin() const -> decltype(Underlying.begin());
-  auto end() const -> decltype(Underlying.end());
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
   int count(const EdgeValue &EV) const;
-  auto find(const EdgeValue &EV) -> decltype(Underlying.find(EV));
-  auto find(const EdgeValue &EV) const -> decltype(Underlying.find(EV));
+  iterator find(const EdgeValue &EV);
+  const_iterator find(const EdgeValue &EV) const;
 
   size_t size() const;
-  auto insert(const EdgeValue &EV) -> decltype(Underlying.insert(EV));
-  auto insert(EdgeValue &&EV) -> decltype(Underlying.insert(EV));
+  std::pair<iterator, bool> insert(const EdgeValue &EV);
+  std::pair<iterator, bool> insert(EdgeValue &&EV);
   bool empty() const;
+  /// Set-equality, i.e. independent of the order of the elements
   bool operator==(const EdgeValueSet &Other) const;
   bool operator!=(const EdgeValueSet &Other) const;
 };
@@ -24,6 +24,7 @@
 #include "phasar/Utils/JoinLattice.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/Printer.h"
+#include "phasar/Utils/SmallFlatSet.h"
 #include "phasar/Utils/TypeTraits.h"
 
 #include "llvm/ADT/StringRef.h"
@@ -48,7 +49,7 @@ namespace detail {
 
 class IDETypeStateAnalysisBaseCommon : public LLVMAnalysisDomainDefault {
 public:
-  using container_type = std::set<d_t>;
+  using container_type = SmallFlatSet<d_t>;
   using FlowFunctionPtrType = FlowFunctionPtrType<d_t, container_type>;
 };
 
@@ -134,8 +135,7 @@ private:
 
   std::map<const llvm::Value *, LLVMAliasInfo::AliasSetTy> AliasCache;
   LLVMAliasInfoRef PT{};
-  std::map<const llvm::Value *, std::set<const llvm::Value *>>
-      RelevantAllocaCache;
+  std::map<const llvm::Value *, container_type> RelevantAllocaCache;
 };
 } // namespace detail
 
@@ -147,11 +147,13 @@ struct IDETypeStateAnalysisDomain : public LLVMAnalysisDomainDefault {
 template <typename TypeStateDescriptionTy>
 class IDETypeStateAnalysis
     : public IDETabulationProblem<
-          IDETypeStateAnalysisDomain<TypeStateDescriptionTy>>,
+          IDETypeStateAnalysisDomain<TypeStateDescriptionTy>,
+          detail::IDETypeStateAnalysisBaseCommon::container_type>,
       private detail::IDETypeStateAnalysisBase {
 public:
-  using IDETabProblemType =
-      IDETabulationProblem<IDETypeStateAnalysisDomain<TypeStateDescriptionTy>>;
+  using IDETabProblemType = IDETabulationProblem<
+      IDETypeStateAnalysisDomain<TypeStateDescriptionTy>,
+      detail::IDETypeStateAnalysisBaseCommon::container_type>;
   using typename IDETabProblemType::container_type;
   using typename IDETabProblemType::d_t;
   using typename IDETabProblemType::f_t;
@@ -14,6 +14,7 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMFunctionDataFlowFacts.h"
 #include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
+#include "phasar/Utils/SmallFlatSet.h"
 
 #include <map>
 #include <set>
@@ -38,7 +39,9 @@ class LLVMTaintConfig;
  * taint-sensitive source and sink functions.
  */
 class IFDSTaintAnalysis
-    : public IFDSTabulationProblem<LLVMIFDSAnalysisDomainDefault> {
+    : public IFDSTabulationProblem<
+          LLVMIFDSAnalysisDomainDefault,
+          SmallFlatSet<LLVMIFDSAnalysisDomainDefault::d_t>> {
 
 public:
   // Setup the configuration type
@@ -80,6 +83,8 @@ public:
 
   bool isZeroValue(d_t FlowFact) const noexcept override;
 
+  [[nodiscard]] bool isRelevant(n_t Inst, d_t Fact) const override;
+
   void emitTextReport(const SolverResults<n_t, d_t, BinaryDomain> &SR,
                       llvm::raw_ostream &OS = llvm::outs()) override;
 
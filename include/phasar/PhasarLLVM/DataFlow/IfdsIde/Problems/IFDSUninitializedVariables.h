@@ -62,6 +62,8 @@ public:
 
   [[nodiscard]] bool isZeroValue(d_t Fact) const noexcept override;
 
+  [[nodiscard]] bool isRelevant(n_t Inst, d_t Fact) const override;
+
   void emitTextReport(const SolverResults<n_t, d_t, l_t> &Results,
                       llvm::raw_ostream &OS = llvm::outs()) override;
 
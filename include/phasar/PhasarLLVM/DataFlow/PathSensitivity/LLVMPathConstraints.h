@@ -12,11 +12,15 @@
 
 #include "phasar/Utils/MaybeUniquePtr.h"
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLFunctionalExtras.h"
 #include "llvm/ADT/SmallVector.h"
 
 #include "z3++.h"
 
 #include <optional>
+#include <unordered_map>
+#include <utility>
 
 namespace llvm {
 class Value;
@@ -29,6 +33,7 @@ class BranchInst;
 class CmpInst;
 class BinaryOperator;
 class CallBase;
+class raw_ostream;
 } // namespace llvm
 
 namespace psr {
@@ -39,6 +44,27 @@ public:
     llvm::SmallVector<const llvm::Value *, 4> Variables;
   };
 
+  struct CacheStatistics {
+    /// Number of queries for the constraint of a CFG edge
+    size_t NumEdgeQueries{};
+    /// Number of edge queries that were answered from the edge cache
+    size_t NumEdgeCacheHits{};
+    /// Number of distinct constraint fragments
+    size_t NumFragments{};
+    /// Number of interned fragments that were already known
+    size_t NumFragmentHits{};
+    /// Number of recorded unsat-cores
+    size_t NumInfeasibleCores{};
+    /// Number of paths that have been rejected by a recorded unsat-core
+    /// without invoking the solver
+    size_t NumPrunedByCore{};
+    /// Number of feasibility queries that were answered from the verdict cache
+    size_t NumVerdictCacheHits{};
+
+    friend llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                                         const CacheStatistics &S);
+  };
+
   explicit LLVMPathConstraints(z3::context *Z3Ctx = nullptr,
                                bool IgnoreDebugInstructions = true);
 
@@ -48,10 +74,57 @@ public:
   std::optional<z3::expr> getConstraintFromEdge(const llvm::Instruction *Curr,
                                                 const llvm::Instruction *Succ);
 
+  /// The returned constraints are cached per edge and interned, so
+  /// repeated queries for the same edge yield the identical Z3 AST.
   std::optional<ConstraintAndVariables>
   getConstraintAndVariablesFromEdge(const llvm::Instruction *Curr,
                                     const llvm::Instruction *Succ);
 
+  /// Returns the canonical representative of the constraint fragment E and
+  /// keeps it alive, such that its AST id stays unique for the lifetime of
+  /// this object.
+  z3::expr internFragment(const z3::expr &E);
+
+  /// Returns the Boolean literal that tracks the (interned) Fragment when
+  /// checking a path with assumptions, i.e., the path is asserted as
+  /// implies(Lit, Fragment) for each fragment and checked under all literals.
+  /// There is exactly one literal per fragment.
+  z3::expr getTrackingLiteral(const z3::expr &Fragment);
+
+  /// Whether E is the tracking literal of some fragment
+  [[nodiscard]] bool isTrackingLiteral(const z3::expr &E) const {
+    return FragmentOfLiteral.count(E.id());
+  }
+
+  /// Records the unsat-core that the solver reported for a path that has been
+  /// checked under the tracking literals of its fragments, such that all
+  /// paths that contain the same core can be rejected by isKnownInfeasible().
+  void recordInfeasible(const z3::expr_vector &Core);
+
+  /// Whether a recorded unsat-core contains the (interned) NewFragment and
+  /// all other fragments of it are on the current path, as determined by
+  /// IsOnPath on the AST ids.
+  [[nodiscard]] bool
+  isKnownInfeasible(const z3::expr &NewFragment,
+                    llvm::function_ref<bool(unsigned)> IsOnPath);
+
+  /// Returns the cached satisfiability of the (hash-consed) Query, if any
+  [[nodiscard]] std::optional<bool> getCachedVerdict(const z3::expr &Query);
+
+  /// Caches whether Query is satisfiable. Keeps Query alive, such that its AST
+  /// id cannot be reused. Once MaxNumCachedVerdicts verdicts are cached, the
+  /// cache is cleared before inserting the next one.
+  void cacheVerdict(const z3::expr &Query, bool Sat);
+
+  static constexpr size_t DefaultMaxNumCachedVerdicts = size_t(1) << 16;
+  void setMaxNumCachedVerdicts(size_t MaxNum) noexcept {
+    MaxNumCachedVerdicts = MaxNum;
+  }
+
+  [[nodiscard]] const CacheStatistics &getStatistics() const noexcept {
+    return Stats;
+  }
+
 private:
   [[nodiscard]] std::optional<ConstraintAndVariables>
   internalGetConstraintAndVariablesFromEdge(const llvm::Instruction *From,
@@ -90,6 +163,23 @@ private:
 
   MaybeUniquePtr<z3::context> Z3Ctx;
   std::unordered_map<const llvm::Value *, ConstraintAndVariables> Z3Expr;
+  llvm::DenseMap<
+      std::pair<const llvm::Instruction *, const llvm::Instruction *>,
+      std::optional<ConstraintAndVariables>>
+      EdgeConstraints;
+  std::unordered_map<unsigned, z3::expr> Fragments;
+  /// Maps the AST id of a fragment to its tracking literal
+  std::unordered_map<unsigned, z3::expr> TrackingLiterals;
+  /// Maps the AST id of a tracking literal to the AST id of its fragment
+  llvm::DenseMap<unsigned, unsigned> FragmentOfLiteral;
+  /// The unsat-cores as sorted AST ids of their fragments
+  llvm::SmallVector<llvm::SmallVector<unsigned, 4>, 0> InfeasibleCores;
+  /// Maps the AST id of a fragment to the indices of all cores containing it
+  llvm::DenseMap<unsigned, llvm::SmallVector<unsigned, 2>> CoresByFragment;
+  /// Maps the AST id of a feasibility query to the query and its verdict
+  std::unordered_map<unsigned, std::pair<z3::expr, bool>> Verdicts;
+  size_t MaxNumCachedVerdicts = DefaultMaxNumCachedVerdicts;
+  CacheStatistics Stats{};
   bool IgnoreDebugInstructions;
 };
 } // namespace psr
@@ -20,6 +20,16 @@ namespace psr {
 struct Z3BasedPathSensitivityConfig
     : PathSensitivityConfigBase<Z3BasedPathSensitivityConfig> {
   std::optional<z3::expr> AdditionalConstraint;
+  /// The number of threads used to check the path feasibility. Each thread
+  /// uses its own Z3 context
+  unsigned NumSolverThreads = 1;
+
+  [[nodiscard]] Z3BasedPathSensitivityConfig
+  withNumSolverThreads(unsigned NumThreads) const &noexcept {
+    auto Ret = *this;
+    Ret.NumSolverThreads = NumThreads;
+    return Ret;
+  }
 
   [[nodiscard]] Z3BasedPathSensitivityConfig
   withAdditionalConstraint(const z3::expr &Constr) const &noexcept {
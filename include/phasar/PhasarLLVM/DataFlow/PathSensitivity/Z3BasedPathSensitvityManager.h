@@ -32,6 +32,7 @@
 #include <memory>
 #include <system_error>
 #include <type_traits>
+#include <utility>
 
 namespace llvm {
 class Instruction;
@@ -49,6 +50,16 @@ public:
                 "Invalid graph type: Must support edge-removal!");
 
 protected:
+  Z3BasedPathSensitivityManagerBase();
+  ~Z3BasedPathSensitivityManagerBase();
+  Z3BasedPathSensitivityManagerBase(
+      Z3BasedPathSensitivityManagerBase &&) noexcept;
+  Z3BasedPathSensitivityManagerBase &
+  operator=(Z3BasedPathSensitivityManagerBase &&) noexcept;
+
+  /// Removes all edges from the RevDAG that cannot be part of a feasible path
+  /// to Leaf. Verdicts are cached in the LPC across calls. Runs the Z3 solver
+  /// on Config.NumSolverThreads threads.
   z3::expr filterOutUnreachableNodes(graph_type &RevDAG, vertex_t Leaf,
                                      const Z3BasedPathSensitivityConfig &Config,
                                      LLVMPathConstraints &LPC) const;
@@ -59,6 +70,14 @@ protected:
                          LLVMPathConstraints &LPC) const;
 
   static void deduplicatePaths(FlowPathSequence<n_t> &Paths);
+
+private:
+  /// The thread pool and per-thread Z3 contexts of filterOutUnreachableNodes()
+  class SolverThreads;
+
+  /// Created by the first call to filterOutUnreachableNodes() with more than
+  /// one solver thread and reused by all subsequent calls
+  mutable std::unique_ptr<SolverThreads> Threads;
 };
 
 template <typename AnalysisDomainTy,
@@ -64,6 +64,11 @@ public:
   [[nodiscard]] LLVMBasedICFG &getICFG();
   [[nodiscard]] LLVMBasedCFG &getCFG();
 
+  /// Eagerly constructs all helper analyses and freezes them, s.t. they are
+  /// not modified anymore when being queried. Afterwards, the helper analyses
+  /// can be shared by data-flow analyses running on different threads.
+  void freeze();
+
 private:
   std::unique_ptr<LLVMProjectIRDB> IRDB;
   std::unique_ptr<LLVMAliasSet> PT;
@@ -24,6 +24,7 @@
 
 #include "nlohmann/json.hpp"
 
+#include <shared_mutex>
 #include <utility>
 
 namespace llvm {
@@ -88,6 +89,14 @@ public:
       const llvm::Value *V, const llvm::Value *PotentialValue,
       bool IntraProcOnly = false, const llvm::Instruction *I = nullptr);
 
+  /// Analyzes all functions that have not been analyzed lazily, yet, and
+  /// makes the alias information safe to be queried from multiple threads
+  /// concurrently. Afterwards, the alias sets must not be changed anymore,
+  /// i.e., mergeWith() and introduceAlias() must not be called.
+  void freeze(LLVMProjectIRDB *IRDB);
+
+  [[nodiscard]] bool isFrozen() const noexcept { return Frozen; }
+
   void mergeWith(const LLVMAliasSet &OtherPTI);
 
   void introduceAlias(const llvm::Value *V1, const llvm::Value *V2,
@@ -131,6 +140,10 @@ public:
 private:
   void computeValuesAliasSet(const llvm::Value *V);
 
+  /// Computes V's alias set if necessary and returns it. Synchronizes with
+  /// other threads if this alias info is frozen.
+  [[nodiscard]] BoxedPtr<AliasSetTy> getOrComputeAliasSet(const llvm::Value *V);
+
   void computeFunctionsAliasSet(llvm::Function *F);
 
   void addSingletonAliasSet(const llvm::Value *V);
@@ -160,6 +173,11 @@ private:
   AliasSetOwner<AliasSetTy> Owner{&MRes};
 
   AliasSetMap AliasSets;
+
+  // Once frozen, queries for values without an alias set still add a fresh
+  // singleton set; these insertions are guarded by this mutex
+  bool Frozen = false;
+  std::shared_mutex FrozenMtx;
 };
 
 static_assert(IsAliasInfo<LLVMAliasSet>);
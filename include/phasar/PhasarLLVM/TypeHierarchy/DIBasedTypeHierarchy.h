@@ -13,9 +13,11 @@
 #include "phasar/PhasarLLVM/TypeHierarchy/DIBasedTypeHierarchyData.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMVFTable.h"
 #include "phasar/TypeHierarchy/TypeHierarchy.h"
+#include "phasar/Utils/CompressedTransitiveClosure.h"
 
 #include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/IR/DebugInfo.h"
@@ -32,6 +34,8 @@ class DIBasedTypeHierarchy
 public:
   using ClassType = const llvm::DIType *;
   using f_t = const llvm::Function *;
+  using SubTypeRange =
+      CompressedTransitiveClosure::value_range<const llvm::DICompositeType *>;
 
   explicit DIBasedTypeHierarchy(const LLVMProjectIRDB &IRDB);
   explicit DIBasedTypeHierarchy(const LLVMProjectIRDB *IRDB,
@@ -44,7 +48,10 @@ public:
 
   [[nodiscard]] bool isSubType(ClassType Type,
                                ClassType SubType) const override {
-    return llvm::is_contained(subTypesOf(Type), SubType);
+    auto TyIt = TypeToVertex.find(Type);
+    auto SubTyIt = TypeToVertex.find(SubType);
+    return TyIt != TypeToVertex.end() && SubTyIt != TypeToVertex.end() &&
+           SubTypeClosure.reaches(TyIt->second, SubTyIt->second);
   }
 
   [[nodiscard]] std::set<ClassType> getSubTypes(ClassType Type) const override {
@@ -52,9 +59,9 @@ public:
     return {Range.begin(), Range.end()};
   }
 
-  /// A more efficient version of getSubTypes()
-  [[nodiscard]] llvm::iterator_range<const ClassType *>
-  subTypesOf(ClassType Ty) const noexcept;
+  /// A more efficient version of getSubTypes() that does not allocate. The
+  /// range includes Ty itself.
+  [[nodiscard]] SubTypeRange subTypesOf(ClassType Ty) const noexcept;
 
   [[nodiscard]] ClassType
   getType(llvm::StringRef TypeName) const noexcept override {
@@ -102,25 +109,25 @@ public:
 
 private:
   [[nodiscard]] DIBasedTypeHierarchyData getTypeHierarchyData() const;
-  [[nodiscard]] llvm::iterator_range<const ClassType *>
-  subTypesOf(size_t TypeIdx) const noexcept;
+  [[nodiscard]] SubTypeRange subTypesOf(size_t TypeIdx) const noexcept;
 
   // ---
 
   llvm::StringMap<ClassType> NameToType;
-  // Map each type to an integer index that is used by VertexTypes and
-  // DerivedTypesOf.
-  // Note: all the below arrays should always have the same size (except for
-  // Hierarchy)!
+  // Map each type to an integer index that is used by VertexTypes,
+  // DerivedTypesOf and SubTypeClosure.
+  // Note: all the below arrays should always have the same size!
   llvm::DenseMap<ClassType, size_t> TypeToVertex;
   // The class types we care about ("VertexProperties")
   std::vector<const llvm::DICompositeType *> VertexTypes;
-  std::vector<std::pair<uint32_t, uint32_t>> TransitiveDerivedIndex;
-  // The inheritance graph linearized as-if constructed by L2R pre-order
-  // traversal from the roots. Allows efficient access to the transitive closure
+  // The direct sub-types of each type, i.e., the edges of the inheritance graph
+  // (base -> derived). Only used for serialization
+  std::vector<llvm::SmallVector<uint32_t>> DerivedTypesOf;
+  // The reflexive transitive closure of the inheritance graph (base -> derived)
+  // as pre-order intervals. Allows efficient access to the transitive closure
   // without ever storing it explicitly. This only works, because the type-graph
   // is known to never contain loops
-  std::vector<ClassType> Hierarchy;
+  CompressedTransitiveClosure SubTypeClosure;
 
   // The VTables of the polymorphic types in the TH. default-constructed if not
   // exists
@@ -20,6 +20,7 @@
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchyData.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMVFTable.h"
 #include "phasar/TypeHierarchy/TypeHierarchy.h"
+#include "phasar/Utils/CompressedTransitiveClosure.h"
 
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
@@ -62,7 +63,6 @@ public:
 
     const llvm::StructType *Type = nullptr;
     std::optional<LLVMVFTable> VFT = std::nullopt;
-    std::set<const llvm::StructType *> ReachableTypes;
   };
 
   /// Edges in the class hierarchy graph doesn't hold any additional
@@ -96,9 +96,17 @@ public:
   static inline constexpr llvm::StringLiteral PureVirtualCallName =
       "__cxa_pure_virtual";
 
+  using SubTypeRange =
+      CompressedTransitiveClosure::value_range<const llvm::StructType *>;
+
 private:
   bidigraph_t TypeGraph;
   std::unordered_map<const llvm::StructType *, vertex_t> TypeVertexMap;
+  // The struct type of each vertex, s.t. SubTypeClosure can map its vertices
+  // back to types
+  std::vector<const llvm::StructType *> VertexTypes;
+  // The reflexive transitive closure of TypeGraph
+  CompressedTransitiveClosure SubTypeClosure;
   // maps type names to the corresponding vtable
   std::unordered_map<const llvm::StructType *, LLVMVFTable> TypeVFTMap;
   // holds all modules that are included in the type hierarchy
@@ -116,6 +124,8 @@ private:
   std::vector<const llvm::Function *>
   getVirtualFunctions(const llvm::Module &M, const llvm::StructType &Type);
 
+  void buildSubTypeClosure();
+
 protected:
   void buildLLVMTypeHierarchy(const llvm::Module &M);
 
@@ -153,7 +163,8 @@ public:
    * @param M LLVM module
    *
    * Extracts new information from the given module and adds new vertices
-   * and edges accordingly to the type hierarchy graph.
+   * and edges accordingly to the type hierarchy graph. Afterwards, the
+   * transitive sub-type relation is recomputed.
    */
   void constructHierarchy(const llvm::Module &M);
 
@@ -165,13 +176,20 @@ public:
   [[nodiscard]] inline bool
   isSubType(const llvm::StructType *Type,
             const llvm::StructType *SubType) const override {
-    auto ReachableTypes = getSubTypes(Type);
-    return ReachableTypes.count(SubType);
+    auto TyIt = TypeVertexMap.find(Type);
+    auto SubTyIt = TypeVertexMap.find(SubType);
+    return TyIt != TypeVertexMap.end() && SubTyIt != TypeVertexMap.end() &&
+           SubTypeClosure.reaches(TyIt->second, SubTyIt->second);
   }
 
   std::set<const llvm::StructType *>
   getSubTypes(const llvm::StructType *Type) const override;
 
+  /// A more efficient version of getSubTypes() that does not allocate. The
+  /// range includes Type itself.
+  [[nodiscard]] SubTypeRange
+  subTypesOf(const llvm::StructType *Type) const noexcept;
+
   [[nodiscard]] const llvm::StructType *
   getType(llvm::StringRef TypeName) const override;
 
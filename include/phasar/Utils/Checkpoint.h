@@ -0,0 +1,173 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_CHECKPOINT_H
+#define PHASAR_UTILS_CHECKPOINT_H
+
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace psr {
+
+/// Encodes a checkpoint into an in-memory buffer.
+///
+/// A checkpoint starts with a magic string and a version byte, followed by a
+/// sequence of records, each starting with a one-byte tag chosen by the user.
+/// The record contents are ULEB128 encoded numbers and ids of interned
+/// strings. A string is written as a record of its own with the reserved tag
+/// 'S' before its first use (see StringTableWriter), so all string ids of a
+/// record must be obtained via getStringId() before the record is started with
+/// writeTag().
+class CheckpointEncoder {
+public:
+  CheckpointEncoder(llvm::StringRef Magic, uint8_t Version);
+  CheckpointEncoder(const CheckpointEncoder &) = delete;
+  CheckpointEncoder &operator=(const CheckpointEncoder &) = delete;
+
+  /// Returns the id of Str. Writes a string record, if Str has not been seen
+  /// before.
+  [[nodiscard]] uint32_t getStringId(llvm::StringRef Str);
+
+  /// Starts a new record. Tag must not be 'S'.
+  void writeTag(char Tag);
+  void writeNumber(uint64_t Num);
+  /// Writes the length of Bytes, followed by Bytes as they are, e.g., a nested
+  /// checkpoint
+  void writeBytes(llvm::StringRef Bytes);
+
+  [[nodiscard]] size_t size() const noexcept { return Buffer.size(); }
+
+  /// Returns the encoded checkpoint. The encoder must not be used afterwards.
+  [[nodiscard]] std::string take() &&;
+
+private:
+  std::string Buffer;
+  llvm::raw_string_ostream OS;
+  StringTableWriter Strings;
+};
+
+/// Decodes a checkpoint that has been written by the CheckpointEncoder.
+///
+/// Reading past the end or referencing an unknown string puts the decoder
+/// into an error state, in which all reads return zero values; check
+/// hasError() after reading a record.
+class CheckpointDecoder {
+public:
+  /// Fails with std::errc::illegal_byte_sequence, if Buffer does not start
+  /// with the expected magic string and version.
+  [[nodiscard]] static llvm::ErrorOr<CheckpointDecoder>
+  create(llvm::StringRef Buffer, llvm::StringRef Magic, uint8_t Version);
+
+  CheckpointDecoder(CheckpointDecoder &&) noexcept = default;
+  ~CheckpointDecoder();
+
+  /// Returns the tag of the next record, transparently consuming string
+  /// records. Returns '\0' at the end of the buffer or on error.
+  [[nodiscard]] char nextTag();
+  [[nodiscard]] uint64_t readNumber();
+  /// Reads bytes that have been written with CheckpointEncoder::writeBytes()
+  [[nodiscard]] llvm::StringRef readBytes();
+  /// Reads a string id and returns the corresponding string
+  [[nodiscard]] llvm::StringRef readString() { return getString(readNumber()); }
+  /// Returns the string with the given id, for string ids that have been
+  /// encoded together with other information, e.g., with an offset
+  [[nodiscard]] llvm::StringRef getString(uint64_t Id);
+
+  [[nodiscard]] bool hasError() noexcept { return Failed || !Cur; }
+
+private:
+  explicit CheckpointDecoder(llvm::StringRef Buffer) noexcept;
+
+  llvm::DataExtractor Data;
+  llvm::DataExtractor::Cursor Cur;
+  StringTableReader Strings;
+  bool Failed = false;
+};
+
+/// Writes Buffer to Path atomically: The data is first written to a temporary
+/// file next to Path, which then replaces Path. Hence, a crash while writing
+/// never destroys a previous checkpoint at Path.
+[[nodiscard]] std::error_code writeCheckpointFile(llvm::StringRef Path,
+                                                  llvm::StringRef Buffer);
+
+struct CheckpointConfig {
+  /// The file to write the checkpoints to. Each checkpoint replaces the
+  /// previous one.
+  std::string Path;
+  /// Take a checkpoint after this time has elapsed since the last one
+  std::chrono::milliseconds Interval = std::chrono::minutes{10};
+  /// Take a checkpoint, if the heap usage has grown by at least this many
+  /// bytes since the last one. 0 disables this trigger.
+  size_t MemoryGrowthThreshold = 0;
+  /// How often to check whether a checkpoint is due. Checking is cheap, but
+  /// requires the solver to be paused.
+  std::chrono::milliseconds CheckInterval = std::chrono::seconds{1};
+};
+
+/// Decides when to take the next checkpoint and writes the checkpoints to disk
+/// in the background, such that the solver only pauses for encoding its state
+/// into memory.
+class PeriodicCheckpointer {
+public:
+  explicit PeriodicCheckpointer(CheckpointConfig Config);
+  PeriodicCheckpointer(const PeriodicCheckpointer &) = delete;
+  PeriodicCheckpointer &operator=(const PeriodicCheckpointer &) = delete;
+  /// Waits for a pending write to complete
+  ~PeriodicCheckpointer();
+
+  /// Whether the interval has elapsed or the heap usage has grown by more
+  /// than the threshold since the last checkpoint
+  [[nodiscard]] bool isDue(std::chrono::steady_clock::time_point Now) const;
+
+  /// Writes Buffer to the configured path in a background thread. Waits for a
+  /// previous write to complete first.
+  void write(std::string Buffer);
+
+  /// Restarts the interval without writing a checkpoint, e.g., when the state
+  /// could not be encoded
+  void postpone();
+
+  /// Waits for a pending write to complete
+  void wait();
+
+  [[nodiscard]] const CheckpointConfig &getConfig() const noexcept {
+    return Config;
+  }
+  /// The number of checkpoints that have been passed to write()
+  [[nodiscard]] size_t getNumCheckpoints() const noexcept {
+    return NumCheckpoints;
+  }
+  /// The error of the last completed write, if any. Call wait() before.
+  [[nodiscard]] std::error_code getLastError() const noexcept {
+    return LastError;
+  }
+
+private:
+  CheckpointConfig Config;
+  std::chrono::steady_clock::time_point LastCheckpoint;
+  size_t LastMemoryUsage = 0;
+  size_t NumCheckpoints = 0;
+  std::thread Writer;
+  std::error_code LastError;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_CHECKPOINT_H
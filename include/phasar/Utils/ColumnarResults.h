@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_COLUMNARRESULTS_H
+#define PHASAR_UTILS_COLUMNARRESULTS_H
+
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace psr {
+
+/// Writes data-flow results, i.e., (statement, fact, value) triples,
+/// incrementally to a compact binary file that can be queried offline with
+/// the ColumnarResultsReader.
+///
+/// All statements, facts and values are stored as ids into a string table.
+/// Each string is written once before its first use (see StringTableWriter).
+/// The results are grouped into rows, one row per statement; within a row, the
+/// fact- and value ids are stored as two separate columns.
+///
+/// The format starts with the magic bytes "PSRRES", followed by a version
+/// byte (currently 1). After that, a sequence of records follows, each
+/// starting with a one-byte tag:
+///   'S' <payload>                    next string (ids are assigned in order)
+///   'R' <stmt> <n> <fact>*n <val>*n  the results at the statement stmt
+///   'Z'                              end of results
+/// All numbers are ULEB128 encoded; a string payload is its ULEB128 encoded
+/// length followed by the raw bytes.
+class ColumnarResultsWriter {
+public:
+  /// Writes the header to OS
+  explicit ColumnarResultsWriter(llvm::raw_ostream &OS);
+  ColumnarResultsWriter(const ColumnarResultsWriter &) = delete;
+  ColumnarResultsWriter &operator=(const ColumnarResultsWriter &) = delete;
+  /// Calls finish(), if not done already
+  ~ColumnarResultsWriter();
+
+  /// Returns the id of Str. Writes the string to the output, if it has not
+  /// been seen before.
+  [[nodiscard]] uint32_t getStringId(llvm::StringRef Str);
+
+  /// Writes the results at the statement StmtStrId. FactStrIds and
+  /// ValueStrIds must have the same length; the i-th value belongs to the
+  /// i-th fact.
+  void addRow(uint32_t StmtStrId, llvm::ArrayRef<uint32_t> FactStrIds,
+              llvm::ArrayRef<uint32_t> ValueStrIds);
+
+  /// Writes the trailer. No rows may be added afterwards.
+  void finish();
+
+  [[nodiscard]] size_t getNumRows() const noexcept { return NumRows; }
+  [[nodiscard]] size_t getNumResults() const noexcept { return NumResults; }
+  [[nodiscard]] size_t getNumStrings() const noexcept {
+    return Strings.size();
+  }
+
+private:
+  llvm::raw_ostream &OS;
+  StringTableWriter Strings;
+  size_t NumRows = 0;
+  size_t NumResults = 0;
+  bool Finished = false;
+};
+
+/// Queries a result file written by the ColumnarResultsWriter.
+///
+/// Parsing only builds an index of the string table and the rows; the fact-
+/// and value columns are decoded on demand. The reader does not own the
+/// buffer, so it must outlive the reader.
+class ColumnarResultsReader {
+public:
+  using ResultHandlerTy = llvm::function_ref<void(
+      llvm::StringRef Stmt, llvm::StringRef Fact, llvm::StringRef Value)>;
+
+  /// Parses Buffer. Fails with std::errc::illegal_byte_sequence, if Buffer
+  /// does not hold a valid result file.
+  [[nodiscard]] static llvm::ErrorOr<ColumnarResultsReader>
+  create(llvm::StringRef Buffer);
+
+  [[nodiscard]] size_t getNumStrings() const noexcept {
+    return Strings.size();
+  }
+  [[nodiscard]] llvm::StringRef getString(uint32_t Id) const {
+    return Strings.getString(Id);
+  }
+
+  [[nodiscard]] size_t getNumRows() const noexcept { return Rows.size(); }
+  [[nodiscard]] size_t getNumResults() const noexcept { return NumResults; }
+
+  /// Whether there are any results at Stmt
+  [[nodiscard]] bool containsStmt(llvm::StringRef Stmt) const;
+
+  /// Calls Handler for each result at Stmt in the order they were written
+  void foreachResultAt(llvm::StringRef Stmt, ResultHandlerTy Handler) const;
+
+  /// Calls Handler for each result in the order they were written
+  void foreachResult(ResultHandlerTy Handler) const;
+
+private:
+  struct Row {
+    uint32_t StmtStrId;
+    uint32_t NumResults;
+    /// Offset of the fact column within the buffer
+    uint64_t FactsOffset;
+    /// Offset of the value column within the buffer
+    uint64_t ValuesOffset;
+  };
+
+  explicit ColumnarResultsReader(llvm::StringRef Buffer) noexcept
+      : Buffer(Buffer) {}
+
+  void foreachResultIn(const Row &R, ResultHandlerTy Handler) const;
+
+  llvm::StringRef Buffer;
+  StringTableReader Strings;
+  std::vector<Row> Rows;
+  /// Statement string -> indices into Rows
+  llvm::StringMap<std::vector<uint32_t>> RowsOfStmt;
+  size_t NumResults = 0;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_COLUMNARRESULTS_H
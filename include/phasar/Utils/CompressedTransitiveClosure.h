@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_COMPRESSEDTRANSITIVECLOSURE_H
+#define PHASAR_UTILS_COMPRESSEDTRANSITIVECLOSURE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/iterator.h"
+#include "llvm/ADT/iterator_range.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// The reflexive transitive closure of a DAG over the dense node-ids
+/// [0, NumNodes) in the interval-compressed form of Agrawal, Borgida and
+/// Jagadish: The nodes are numbered in pre-order of a DFS spanning forest, s.t.
+/// every spanning subtree is a contiguous interval of numbers. The closure of a
+/// node is then stored as a sorted list of disjoint intervals. For trees -- and
+/// in practice for most type hierarchies -- this is a single interval per node,
+/// so the whole closure takes O(N) space.
+///
+/// Reachability queries are a binary search over the intervals of the source
+/// node and iterating the reachable nodes does not allocate.
+///
+/// The graph must not contain cycles other than self-loops.
+class CompressedTransitiveClosure {
+public:
+  /// A closed interval [first, second] of pre-order numbers
+  using Interval = std::pair<uint32_t, uint32_t>;
+
+  /// Iterates the node-ids reachable from a node in pre-order
+  class iterator
+      : public llvm::iterator_facade_base<iterator, std::forward_iterator_tag,
+                                          uint32_t, ptrdiff_t, const uint32_t *,
+                                          const uint32_t &> {
+  public:
+    iterator() noexcept = default;
+    iterator(const Interval *CurrIv, const Interval *EndIv,
+             const uint32_t *NodeAt) noexcept
+        : CurrIv(CurrIv), EndIv(EndIv), NodeAt(NodeAt),
+          Pos(CurrIv != EndIv ? CurrIv->first : 0) {}
+
+    [[nodiscard]] const uint32_t &operator*() const noexcept {
+      return NodeAt[Pos];
+    }
+
+    iterator &operator++() noexcept {
+      if (Pos != CurrIv->second) {
+        ++Pos;
+        return *this;
+      }
+      ++CurrIv;
+      Pos = CurrIv != EndIv ? CurrIv->first : 0;
+      return *this;
+    }
+    using iterator::iterator_facade_base::operator++;
+
+    [[nodiscard]] bool operator==(const iterator &Other) const noexcept {
+      return CurrIv == Other.CurrIv && Pos == Other.Pos;
+    }
+
+  private:
+    const Interval *CurrIv{};
+    const Interval *EndIv{};
+    const uint32_t *NodeAt{};
+    uint32_t Pos = 0;
+  };
+
+  /// Maps a node-id to the value stored at that index
+  template <typename T> struct ValueOf {
+    const T *Values;
+    const T &operator()(uint32_t Node) const noexcept { return Values[Node]; }
+  };
+
+  template <typename T>
+  using value_range =
+      llvm::iterator_range<llvm::mapped_iterator<iterator, ValueOf<T>>>;
+
+  CompressedTransitiveClosure() noexcept = default;
+
+  /// Computes the closure of the graph with NumNodes nodes and the given edges.
+  /// Edges may be duplicated or already transitive.
+  CompressedTransitiveClosure(
+      size_t NumNodes, llvm::ArrayRef<std::pair<uint32_t, uint32_t>> Edges);
+
+  /// Checks whether To is reachable from From. Every node reaches itself.
+  [[nodiscard]] bool reaches(uint32_t From, uint32_t To) const noexcept;
+
+  /// All nodes reachable from From, including From itself
+  [[nodiscard]] llvm::iterator_range<iterator>
+  reachableFrom(uint32_t From) const noexcept {
+    auto Ivs = intervals(From);
+    return {iterator(Ivs.begin(), Ivs.end(), NodeAt.data()),
+            iterator(Ivs.end(), Ivs.end(), NodeAt.data())};
+  }
+
+  /// All nodes reachable from From, mapped to the corresponding entry in
+  /// Values. Values must be indexed by node-id.
+  template <typename T>
+  [[nodiscard]] value_range<T>
+  reachableFrom(uint32_t From, llvm::ArrayRef<T> Values) const noexcept {
+    assert(Values.size() == size());
+    return llvm::map_range(reachableFrom(From), ValueOf<T>{Values.data()});
+  }
+
+  /// An empty range, e.g., for values that are not part of the graph
+  template <typename T>
+  [[nodiscard]] static value_range<T> emptyRange() noexcept {
+    llvm::mapped_iterator<iterator, ValueOf<T>> It(iterator(),
+                                                   ValueOf<T>{nullptr});
+    return {It, It};
+  }
+
+  /// The number of nodes reachable from From, including From itself
+  [[nodiscard]] size_t numReachable(uint32_t From) const noexcept;
+
+  /// The sorted, disjoint pre-order intervals that are reachable from From
+  [[nodiscard]] llvm::ArrayRef<Interval>
+  intervals(uint32_t From) const noexcept {
+    assert(From < size());
+    return llvm::makeArrayRef(Intervals)
+        .slice(IntervalOffsets[From],
+               IntervalOffsets[From + 1] - IntervalOffsets[From]);
+  }
+
+  [[nodiscard]] size_t size() const noexcept { return NodeAt.size(); }
+  [[nodiscard]] bool empty() const noexcept { return NodeAt.empty(); }
+
+  /// The total number of stored intervals; equals size() for forests
+  [[nodiscard]] size_t getNumIntervals() const noexcept {
+    return Intervals.size();
+  }
+
+private:
+  // Node-id -> pre-order number
+  std::vector<uint32_t> PreOrderNum;
+  // Pre-order number -> node-id
+  std::vector<uint32_t> NodeAt;
+  // The intervals of node I are [IntervalOffsets[I], IntervalOffsets[I+1])
+  std::vector<uint32_t> IntervalOffsets;
+  std::vector<Interval> Intervals;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_COMPRESSEDTRANSITIVECLOSURE_H
@@ -12,12 +12,22 @@
 
 #include "phasar/Utils/GraphTraits.h"
 #include "phasar/Utils/Logger.h"
+#include "phasar/Utils/TypeTraits.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/IntEqClasses.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallBitVector.h"
 #include "llvm/ADT/SmallVector.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <utility>
+
 namespace psr {
 
 template <typename GraphTy>
@@ -83,20 +93,39 @@ createEquivalentGraphFrom(GraphTy &&G, const llvm::IntEqClasses &Eq)
   return Ret;
 }
 
+namespace detail {
+/// Hashes the value of a graph node to group the candidates for equivalent
+/// nodes. Values that cannot be hashed all fall into the same group.
+template <typename T>
+[[nodiscard]] size_t hashGraphNodeValue(const T &Val) noexcept {
+  if constexpr (is_llvm_hashable_v<T>) {
+    using llvm::hash_value;
+    return hash_value(Val);
+  } else if constexpr (is_std_hashable_v<T>) {
+    return std::hash<T>{}(Val);
+  } else if constexpr (is_iterable_v<const T &>) {
+    size_t Hash = 0;
+    for (const auto &Elem : Val) {
+      Hash = llvm::hash_combine(Hash, hashGraphNodeValue(Elem));
+    }
+    return Hash;
+  } else {
+    return 0;
+  }
+}
+
+/// Computes the equivalence classes by iteratively merging pairs of
+/// candidates until a fixpoint is reached. Quadratic in the number of
+/// vertices, but also works on cyclic graphs.
 template <typename GraphTy>
-[[nodiscard]] llvm::IntEqClasses minimizeGraph(const GraphTy &G)
-#if __cplusplus >= 202002L
-    requires is_graph<GraphTy>
-#endif
-{
+[[nodiscard]] llvm::IntEqClasses minimizeGraphIteratively(const GraphTy &G) {
 
   using traits_t = GraphTraits<GraphTy>;
   using vertex_t = typename traits_t::vertex_t;
   using edge_t = typename traits_t::edge_t;
 
-  auto DagSize = traits_t::size(G);
   llvm::SmallVector<std::pair<vertex_t, vertex_t>> WorkList;
-  WorkList.reserve(DagSize);
+  WorkList.reserve(traits_t::size(G));
 
   const auto &Vertices = traits_t::vertices(G);
 
@@ -139,9 +168,6 @@ template <typename GraphTy>
     return I - 1;
   };
 
-  /// NOTE: This algorithm can be further optimized, but for now it is fast
-  /// enough
-
   bool Changed = true;
   while (Changed) {
     Changed = false;
@@ -179,6 +205,157 @@ template <typename GraphTy>
     }
   }
 
+  Equiv.compress();
+  return Equiv;
+}
+
+} // namespace detail
+
+/// Computes the equivalence classes of the vertices of G, where two vertices
+/// are equivalent iff they have the same value and the same number of
+/// out-edges, and their out-edges have pairwise equal weights and equivalent
+/// targets (in order; for vertices with two out-edges in any order).
+///
+/// For acyclic graphs, the classes are computed bottom-up in reverse
+/// topological order, such that the classes of all successors of a vertex are
+/// final when the vertex is classified. Vertices are then grouped by a hash of
+/// their value and successor classes, so this takes expected linear time in
+/// the size of the graph. Cyclic graphs fall back to iterative pairwise
+/// merging.
+template <typename GraphTy>
+[[nodiscard]] llvm::IntEqClasses minimizeGraph(const GraphTy &G)
+#if __cplusplus >= 202002L
+    requires is_graph<GraphTy>
+#endif
+{
+  using traits_t = GraphTraits<GraphTy>;
+  using vertex_t = typename traits_t::vertex_t;
+
+  auto DagSize = traits_t::size(G);
+
+  /// Predecessors in CSR format and the number of not yet classified
+  /// successors of each vertex
+  llvm::SmallVector<unsigned, 0> PredOffsets(DagSize + 1);
+  llvm::SmallVector<unsigned, 0> NumPendingSuccs(DagSize);
+  for (auto Vtx : traits_t::vertices(G)) {
+    for (const auto &Edge : traits_t::outEdges(G, Vtx)) {
+      ++PredOffsets[traits_t::target(Edge) + 1];
+      ++NumPendingSuccs[Vtx];
+    }
+  }
+  std::partial_sum(PredOffsets.begin(), PredOffsets.end(),
+                   PredOffsets.begin());
+  llvm::SmallVector<vertex_t, 0> Preds(PredOffsets.back());
+  {
+    auto Fill = PredOffsets;
+    for (auto Vtx : traits_t::vertices(G)) {
+      for (const auto &Edge : traits_t::outEdges(G, Vtx)) {
+        Preds[Fill[traits_t::target(Edge)]++] = Vtx;
+      }
+    }
+  }
+
+  /// The representative vertex of each classified vertex
+  llvm::SmallVector<vertex_t, 0> Rep(DagSize, traits_t::Invalid);
+  llvm::DenseMap<llvm::hash_code, llvm::SmallVector<vertex_t, 1>> Buckets;
+  Buckets.reserve(DagSize);
+
+  auto targetRep = [&Rep](const auto &Edge) {
+    return Rep[traits_t::target(Edge)];
+  };
+
+  auto hashVertex = [&G, &targetRep](vertex_t Vtx) {
+    auto Hash = llvm::hash_combine(
+        detail::hashGraphNodeValue(traits_t::node(G, Vtx)),
+        traits_t::outDegree(G, Vtx));
+    const auto &Edges = traits_t::outEdges(G, Vtx);
+    if (traits_t::outDegree(G, Vtx) == 2) {
+      /// Both orders of the out-edges are equivalent
+      auto First = targetRep(*Edges.begin());
+      auto Second = targetRep(*std::next(Edges.begin()));
+      return llvm::hash_combine(Hash, std::min(First, Second),
+                                std::max(First, Second));
+    }
+    for (const auto &Edge : Edges) {
+      Hash = llvm::hash_combine(Hash, targetRep(Edge));
+    }
+    return Hash;
+  };
+
+  auto isEquivalent = [&targetRep](const auto &LHS, const auto &RHS) {
+    return traits_t::weight(LHS) == traits_t::weight(RHS) &&
+           targetRep(LHS) == targetRep(RHS);
+  };
+
+  auto isEquivalentVertex = [&G, &isEquivalent](vertex_t LHS, vertex_t RHS) {
+    if (traits_t::outDegree(G, LHS) != traits_t::outDegree(G, RHS) ||
+        !(traits_t::node(G, LHS) == traits_t::node(G, RHS))) {
+      return false;
+    }
+
+    const auto &LEdges = traits_t::outEdges(G, LHS);
+    const auto &REdges = traits_t::outEdges(G, RHS);
+    if (llvm::all_of(llvm::zip(LEdges, REdges), [&isEquivalent](auto Pair) {
+          return isEquivalent(std::get<0>(Pair), std::get<1>(Pair));
+        })) {
+      return true;
+    }
+
+    if (traits_t::outDegree(G, LHS) == 2) {
+      auto LFirst = *LEdges.begin();
+      auto LSecond = *std::next(LEdges.begin());
+      auto RFirst = *REdges.begin();
+      auto RSecond = *std::next(REdges.begin());
+      return isEquivalent(LFirst, RSecond) && isEquivalent(LSecond, RFirst);
+    }
+    return false;
+  };
+
+  llvm::SmallVector<vertex_t, 0> WorkList;
+  for (auto Vtx : traits_t::vertices(G)) {
+    if (NumPendingSuccs[Vtx] == 0) {
+      WorkList.push_back(Vtx);
+    }
+  }
+
+  size_t NumClassified = 0;
+  while (!WorkList.empty()) {
+    auto Vtx = WorkList.pop_back_val();
+    ++NumClassified;
+
+    auto &Bucket = Buckets[hashVertex(Vtx)];
+    const auto *It = llvm::find_if(Bucket, [&](vertex_t Candidate) {
+      return isEquivalentVertex(Vtx, Candidate);
+    });
+    if (It != Bucket.end()) {
+      Rep[Vtx] = *It;
+    } else {
+      Rep[Vtx] = Vtx;
+      Bucket.push_back(Vtx);
+    }
+
+    for (auto Pred : llvm::makeArrayRef(Preds).slice(
+             PredOffsets[Vtx], PredOffsets[Vtx + 1] - PredOffsets[Vtx])) {
+      if (--NumPendingSuccs[Pred] == 0) {
+        WorkList.push_back(Pred);
+      }
+    }
+  }
+
+  if (NumClassified != DagSize) {
+    PHASAR_LOG_LEVEL_CAT(DEBUG, "GraphTraits",
+                         "> The graph is cyclic; fall back to iterative "
+                         "minimization");
+    return detail::minimizeGraphIteratively(G);
+  }
+
+  llvm::IntEqClasses Equiv(DagSize);
+  for (auto Vtx : traits_t::vertices(G)) {
+    if (Rep[Vtx] != Vtx) {
+      Equiv.join(Vtx, Rep[Vtx]);
+    }
+  }
+
   Equiv.compress();
 
   PHASAR_LOG_LEVEL_CAT(DEBUG, "GraphTraits",
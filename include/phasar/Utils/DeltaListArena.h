@@ -0,0 +1,208 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_DELTALISTARENA_H
+#define PHASAR_UTILS_DELTALISTARENA_H
+
+#include "llvm/ADT/iterator_range.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace psr {
+
+/// Stores many small, append-only lists of 32-bit ids in one chunked arena.
+///
+/// Each list is a chain of fixed-size chunks. Within a list, each id is
+/// stored as zig-zag varint-encoded delta to its predecessor (the first one
+/// relative to the list's base), so lists of nearby ids need about one or two
+/// bytes per entry instead of a pointer-sized slot.
+///
+/// A list is referenced by a small List handle that the user embeds into its
+/// own data structures. Appending to a list does not invalidate iterators of
+/// other lists, but moving the arena does.
+class DeltaListArena {
+public:
+  static constexpr uint32_t NoChunk = ~uint32_t(0);
+  static constexpr size_t ChunkSize = 32;
+
+  struct List {
+    uint32_t FirstChunk = NoChunk;
+    uint32_t LastChunk = NoChunk;
+    /// The value that the first delta refers to
+    uint32_t Base = 0;
+    /// The last appended value
+    uint32_t Last = 0;
+    uint32_t Size = 0;
+
+    List() noexcept = default;
+    explicit List(uint32_t Base) noexcept : Base(Base), Last(Base) {}
+
+    [[nodiscard]] bool empty() const noexcept { return Size == 0; }
+    [[nodiscard]] size_t size() const noexcept { return Size; }
+  };
+
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = uint32_t;
+    using difference_type = ptrdiff_t;
+    using pointer = const uint32_t *;
+    using reference = uint32_t;
+
+    const_iterator() noexcept = default;
+
+    [[nodiscard]] uint32_t operator*() const noexcept {
+      assert(Remaining != 0 && "Dereferencing the end iterator");
+      return Curr;
+    }
+
+    const_iterator &operator++() noexcept {
+      assert(Remaining != 0 && "Incrementing the end iterator");
+      if (--Remaining != 0) {
+        decodeNext();
+      }
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      auto Ret = *this;
+      ++*this;
+      return Ret;
+    }
+
+    [[nodiscard]] friend bool operator==(const const_iterator &LHS,
+                                         const const_iterator &RHS) noexcept {
+      return LHS.Remaining == RHS.Remaining &&
+             (LHS.Remaining == 0 ||
+              (LHS.ChunkIdx == RHS.ChunkIdx && LHS.Offset == RHS.Offset));
+    }
+    [[nodiscard]] friend bool operator!=(const const_iterator &LHS,
+                                         const const_iterator &RHS) noexcept {
+      return !(LHS == RHS);
+    }
+
+  private:
+    friend DeltaListArena;
+
+    const_iterator(const DeltaListArena *Arena, const List &L) noexcept
+        : Arena(Arena), ChunkIdx(L.FirstChunk), Curr(L.Base),
+          Remaining(L.Size) {
+      if (Remaining != 0) {
+        decodeNext();
+      }
+    }
+
+    void decodeNext() noexcept {
+      const auto *Chnk = &Arena->Chunks[ChunkIdx];
+      if (Offset == Chnk->Used) {
+        ChunkIdx = Chnk->Next;
+        Offset = 0;
+        Chnk = &Arena->Chunks[ChunkIdx];
+      }
+      Curr += DeltaListArena::decode(Chnk->Data, Offset);
+    }
+
+    const DeltaListArena *Arena{};
+    uint32_t ChunkIdx = NoChunk;
+    uint32_t Offset = 0;
+    uint32_t Curr = 0;
+    uint32_t Remaining = 0;
+  };
+
+  /// Appends Val to the list L
+  void append(List &L, uint32_t Val) {
+    uint8_t Buf[MaxEncodedSize];
+    auto Len = encode(Val - L.Last, Buf);
+
+    if (L.LastChunk == NoChunk ||
+        Chunks[L.LastChunk].Used + Len > Chunk::Capacity) {
+      auto NewChunk = uint32_t(Chunks.size());
+      assert(NewChunk != NoChunk && "DeltaListArena exhausted");
+      Chunks.emplace_back();
+      if (L.LastChunk == NoChunk) {
+        L.FirstChunk = NewChunk;
+      } else {
+        Chunks[L.LastChunk].Next = NewChunk;
+      }
+      L.LastChunk = NewChunk;
+    }
+
+    auto &Chnk = Chunks[L.LastChunk];
+    for (size_t I = 0; I != Len; ++I) {
+      Chnk.Data[Chnk.Used++] = Buf[I];
+    }
+    L.Last = Val;
+    ++L.Size;
+  }
+
+  [[nodiscard]] const_iterator begin(const List &L) const noexcept {
+    return {this, L};
+  }
+  [[nodiscard]] const_iterator end(const List & /*L*/) const noexcept {
+    return {};
+  }
+  [[nodiscard]] llvm::iterator_range<const_iterator>
+  entries(const List &L) const noexcept {
+    return {begin(L), end(L)};
+  }
+
+  /// Number of bytes reserved by the chunks of this arena
+  [[nodiscard]] size_t getAllocatedBytes() const noexcept {
+    return Chunks.capacity() * sizeof(Chunk);
+  }
+  [[nodiscard]] size_t getNumChunks() const noexcept { return Chunks.size(); }
+
+  void clear() noexcept { Chunks.clear(); }
+
+private:
+  static constexpr size_t MaxEncodedSize = 5;
+
+  struct Chunk {
+    static constexpr size_t Capacity =
+        ChunkSize - sizeof(uint32_t) - sizeof(uint8_t);
+
+    uint32_t Next = NoChunk;
+    uint8_t Used = 0;
+    uint8_t Data[Capacity]{};
+  };
+  static_assert(sizeof(Chunk) == ChunkSize);
+
+  /// Zig-zag varint encoding of the delta, interpreted as two's complement
+  static size_t encode(uint32_t Delta, uint8_t *Buf) noexcept {
+    auto ZigZag = (Delta << 1) ^ uint32_t(-(Delta >> 31));
+    size_t Len = 0;
+    while (ZigZag >= 0x80) {
+      Buf[Len++] = uint8_t(ZigZag | 0x80);
+      ZigZag >>= 7;
+    }
+    Buf[Len++] = uint8_t(ZigZag);
+    return Len;
+  }
+
+  static uint32_t decode(const uint8_t *Data, uint32_t &Offset) noexcept {
+    uint32_t ZigZag = 0;
+    for (uint32_t Shift = 0;; Shift += 7) {
+      auto Byte = Data[Offset++];
+      ZigZag |= uint32_t(Byte & 0x7f) << Shift;
+      if (!(Byte & 0x80)) {
+        break;
+      }
+    }
+    return (ZigZag >> 1) ^ uint32_t(-(ZigZag & 1));
+  }
+
+  std::vector<Chunk> Chunks;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_DELTALISTARENA_H
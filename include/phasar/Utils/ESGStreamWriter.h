@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_ESGSTREAMWRITER_H
+#define PHASAR_UTILS_ESGSTREAMWRITER_H
+
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace llvm::json {
+class OStream;
+} // namespace llvm::json
+
+namespace psr {
+
+enum class ESGExportFormat {
+  /// Graphviz DOT; labels are inlined into the node- and edge attributes
+  Dot,
+  /// A JSON object {"label": ..., "records": [...]}, where each record is
+  /// one of
+  ///   {"kind": "string", "id": <id>, "value": <string>}
+  ///   {"kind": "node", "id": <id>, "function": <string-id>,
+  ///    "stmt": <string-id>, "fact": <string-id>}
+  ///   {"kind": "edge", "from": <node-id>, "to": <node-id>,
+  ///    "interproc": <bool>[, "ef": <string-id>]}
+  Json,
+  /// Compact binary format for offline viewers. See ESGStreamWriter.
+  Binary,
+};
+
+/// Writes an exploded super-graph (ESG) incrementally to an output stream.
+///
+/// Nothing but the string table is buffered: nodes and edges are written as
+/// soon as they are added, so exporting the ESG of a large program does not
+/// need to materialize the graph in memory. Strings (function names,
+/// statement- and fact labels, edge-function labels) are interned and
+/// referred to by integer ids. Each string is written once before its first
+/// use (see StringTableWriter).
+///
+/// The binary format starts with the magic bytes "PSRESG", followed by a
+/// version byte (currently 1) and the graph label as string payload. After
+/// that, a sequence of records follows, each starting with a one-byte tag:
+///   'S' <payload>                 next string (ids are assigned in order)
+///   'N' <fun> <stmt> <fact>       next node (ids are assigned in order)
+///   'E' <from> <to> <kind> <ef+1> edge; kind 0 = intra-, 1 = interproc.;
+///                                 ef+1 = 0 means no edge-function label
+///   'Z'                           end of graph
+/// All numbers are ULEB128 encoded; a string payload is its ULEB128 encoded
+/// length followed by the raw bytes.
+class ESGStreamWriter {
+public:
+  static constexpr uint32_t NoString = ~uint32_t(0);
+
+  /// Starts a new graph and writes its header to OS
+  ESGStreamWriter(llvm::raw_ostream &OS, ESGExportFormat Format,
+                  llvm::StringRef Label = "");
+  ESGStreamWriter(const ESGStreamWriter &) = delete;
+  ESGStreamWriter &operator=(const ESGStreamWriter &) = delete;
+  /// Calls finish(), if not done already
+  ~ESGStreamWriter();
+
+  /// Returns the id of Str. Writes the string to the output, if it has not
+  /// been seen before.
+  [[nodiscard]] uint32_t getStringId(llvm::StringRef Str);
+
+  /// Writes a new node and returns its id. The ids are assigned in
+  /// increasing order, starting from zero.
+  uint32_t addNode(uint32_t FunctionStrId, uint32_t StmtStrId,
+                   uint32_t FactStrId);
+
+  /// Writes an edge between the nodes From and To that must have been added
+  /// before.
+  void addEdge(uint32_t From, uint32_t To, bool IsInterProcedural,
+               uint32_t EdgeFnStrId = NoString);
+
+  /// Writes the trailer of the graph. No nodes or edges may be added
+  /// afterwards.
+  void finish();
+
+  [[nodiscard]] size_t getNumNodes() const noexcept { return NumNodes; }
+  [[nodiscard]] size_t getNumEdges() const noexcept { return NumEdges; }
+  [[nodiscard]] size_t getNumStrings() const noexcept {
+    return Strings.size();
+  }
+
+private:
+  llvm::raw_ostream &OS;
+  ESGExportFormat Format;
+  StringTableWriter Strings;
+  /// Only used for ESGExportFormat::Json
+  std::unique_ptr<llvm::json::OStream> JOS;
+  uint32_t NumNodes = 0;
+  size_t NumEdges = 0;
+  bool Finished = false;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_ESGSTREAMWRITER_H
@@ -0,0 +1,238 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_SMALLFLATSET_H
+#define PHASAR_UTILS_SMALLFLATSET_H
+
+#include "llvm/ADT/SmallVector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace psr {
+
+/// A sorted set of values that is stored in a contiguous small-vector.
+///
+/// Up to N elements are stored inline without any heap-allocation. Lookups on
+/// small sets use a branch-free linear scan that compilers can vectorize for
+/// pointer- and integer-sized elements; larger sets fall back to binary
+/// search. Insertion and removal are linear in the size of the set, so this
+/// container is meant for the small fact-sets that flow functions typically
+/// produce and not as a general replacement for std::set.
+///
+/// The interface mirrors the parts of std::set that are used by the flow
+/// functions and the IFDS/IDE solvers, so SmallFlatSet can be used as
+/// Container of a FlowFunction or IDETabulationProblem. Like std::set, the
+/// elements are iterated in ascending order w.r.t. Compare.
+///
+/// Note: Unlike std::set, all iterators and references are invalidated by
+/// insertion and removal.
+template <typename T, unsigned N = 4, typename Compare = std::less<T>>
+class SmallFlatSet {
+  using VectorTy = llvm::SmallVector<T, N>;
+
+public:
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = const T &;
+  using const_reference = const T &;
+  using pointer = const T *;
+  using const_pointer = const T *;
+  using iterator = typename VectorTy::const_iterator;
+  using const_iterator = typename VectorTy::const_iterator;
+  using reverse_iterator = typename VectorTy::const_reverse_iterator;
+  using const_reverse_iterator = typename VectorTy::const_reverse_iterator;
+
+  /// Up to this size, lookups use a linear scan instead of binary search
+  static constexpr size_t LinearSearchThreshold = 32;
+
+  SmallFlatSet() noexcept(std::is_nothrow_default_constructible_v<Compare>) =
+      default;
+  explicit SmallFlatSet(Compare Comp) noexcept(
+      std::is_nothrow_move_constructible_v<Compare>)
+      : Comp(std::move(Comp)) {}
+
+  template <typename InputIt>
+  SmallFlatSet(InputIt First, InputIt Last, Compare Comp = Compare())
+      : Comp(std::move(Comp)) {
+    insert(First, Last);
+  }
+
+  SmallFlatSet(std::initializer_list<T> IList, Compare Comp = Compare())
+      : SmallFlatSet(IList.begin(), IList.end(), std::move(Comp)) {}
+
+  [[nodiscard]] iterator begin() const noexcept { return Elems.begin(); }
+  [[nodiscard]] iterator end() const noexcept { return Elems.end(); }
+  [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+  [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+  [[nodiscard]] reverse_iterator rbegin() const noexcept {
+    return Elems.rbegin();
+  }
+  [[nodiscard]] reverse_iterator rend() const noexcept { return Elems.rend(); }
+
+  [[nodiscard]] bool empty() const noexcept { return Elems.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return Elems.size(); }
+  [[nodiscard]] size_t capacity() const noexcept { return Elems.capacity(); }
+
+  /// Whether this set currently stores its elements inline
+  [[nodiscard]] bool isSmall() const noexcept { return Elems.capacity() <= N; }
+
+  [[nodiscard]] key_compare key_comp() const { return Comp; }
+  [[nodiscard]] value_compare value_comp() const { return Comp; }
+
+  void reserve(size_t Capacity) { Elems.reserve(Capacity); }
+  void clear() noexcept { Elems.clear(); }
+
+  /// Returns the first element that is not less than Val
+  [[nodiscard]] iterator lower_bound(const T &Val) const {
+    return begin() + lowerBoundIndex(Val);
+  }
+
+  [[nodiscard]] iterator find(const T &Val) const {
+    auto It = lower_bound(Val);
+    if (It != end() && !Comp(Val, *It)) {
+      return It;
+    }
+    return end();
+  }
+
+  [[nodiscard]] size_t count(const T &Val) const { return contains(Val); }
+  [[nodiscard]] bool contains(const T &Val) const {
+    return find(Val) != end();
+  }
+
+  std::pair<iterator, bool> insert(const T &Val) { return emplaceImpl(Val); }
+  std::pair<iterator, bool> insert(T &&Val) {
+    return emplaceImpl(std::move(Val));
+  }
+
+  /// Inserts Val ignoring the Hint. Makes this set usable with std::inserter.
+  iterator insert(const_iterator /*Hint*/, const T &Val) {
+    return insert(Val).first;
+  }
+  iterator insert(const_iterator /*Hint*/, T &&Val) {
+    return insert(std::move(Val)).first;
+  }
+
+  template <typename InputIt> void insert(InputIt First, InputIt Last) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<
+                                        InputIt>::iterator_category>) {
+      auto NumNew = size_t(std::distance(First, Last));
+      if (NumNew <= 1) {
+        for (; First != Last; ++First) {
+          insert(*First);
+        }
+        return;
+      }
+
+      // Append everything at once and restore the invariant afterwards, so
+      // we do not shift the elements for every insertion
+      auto OldSize = Elems.size();
+      Elems.append(First, Last);
+      auto Mid = Elems.begin() + OldSize;
+      std::sort(Mid, Elems.end(), Comp);
+      std::inplace_merge(Elems.begin(), Mid, Elems.end(), Comp);
+      Elems.erase(std::unique(Elems.begin(), Elems.end(),
+                              [this](const T &LHS, const T &RHS) {
+                                return !Comp(LHS, RHS);
+                              }),
+                  Elems.end());
+    } else {
+      for (; First != Last; ++First) {
+        insert(*First);
+      }
+    }
+  }
+
+  void insert(std::initializer_list<T> IList) {
+    insert(IList.begin(), IList.end());
+  }
+
+  template <typename... ArgsT>
+  std::pair<iterator, bool> emplace(ArgsT &&...Args) {
+    return emplaceImpl(T(std::forward<ArgsT>(Args)...));
+  }
+
+  iterator erase(const_iterator Pos) { return Elems.erase(Pos); }
+  iterator erase(const_iterator First, const_iterator Last) {
+    return Elems.erase(First, Last);
+  }
+  size_t erase(const T &Val) {
+    auto It = find(Val);
+    if (It == end()) {
+      return 0;
+    }
+    Elems.erase(It);
+    return 1;
+  }
+
+  void swap(SmallFlatSet &Other) noexcept {
+    using std::swap;
+    swap(Elems, Other.Elems);
+    swap(Comp, Other.Comp);
+  }
+  friend void swap(SmallFlatSet &LHS, SmallFlatSet &RHS) noexcept {
+    LHS.swap(RHS);
+  }
+
+  [[nodiscard]] friend bool operator==(const SmallFlatSet &LHS,
+                                       const SmallFlatSet &RHS) {
+    return LHS.Elems == RHS.Elems;
+  }
+  [[nodiscard]] friend bool operator!=(const SmallFlatSet &LHS,
+                                       const SmallFlatSet &RHS) {
+    return !(LHS == RHS);
+  }
+  [[nodiscard]] friend bool operator<(const SmallFlatSet &LHS,
+                                      const SmallFlatSet &RHS) {
+    return std::lexicographical_compare(LHS.begin(), LHS.end(), RHS.begin(),
+                                        RHS.end(), LHS.Comp);
+  }
+
+private:
+  [[nodiscard]] size_t lowerBoundIndex(const T &Val) const {
+    if (Elems.size() <= LinearSearchThreshold) {
+      // As the elements are sorted, the number of elements less than Val is
+      // the index of the lower bound. Counting without early exit keeps the
+      // loop free of branches.
+      size_t Idx = 0;
+      for (const auto &Elem : Elems) {
+        Idx += size_t(Comp(Elem, Val));
+      }
+      return Idx;
+    }
+    return std::lower_bound(Elems.begin(), Elems.end(), Val, Comp) -
+           Elems.begin();
+  }
+
+  template <typename U> std::pair<iterator, bool> emplaceImpl(U &&Val) {
+    auto Idx = lowerBoundIndex(Val);
+    if (Idx != Elems.size() && !Comp(Val, Elems[Idx])) {
+      return {begin() + Idx, false};
+    }
+    return {Elems.insert(Elems.begin() + Idx, std::forward<U>(Val)), true};
+  }
+
+  VectorTy Elems;
+  Compare Comp{};
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_SMALLFLATSET_H
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_SPILLFILE_H
+#define PHASAR_UTILS_SPILLFILE_H
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace psr {
+
+/// An append-only temporary file, to which data can be evicted from memory.
+/// The data is read back by mapping the respective segment of the file into
+/// memory. The file is deleted, when the SpillFile is destroyed.
+///
+/// Segments are never reused, so the file only grows.
+class SpillFile {
+public:
+  struct Segment {
+    uint64_t Offset = 0;
+    uint64_t Size = 0;
+  };
+
+  /// Creates a new spill file in Dir or in the system's temporary directory,
+  /// if Dir is empty.
+  [[nodiscard]] static llvm::ErrorOr<SpillFile> create(llvm::StringRef Dir);
+
+  SpillFile(SpillFile &&Other) noexcept;
+  SpillFile &operator=(SpillFile &&Other) = delete;
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  ~SpillFile();
+
+  /// Appends Data to the file
+  [[nodiscard]] llvm::ErrorOr<Segment> write(llvm::StringRef Data);
+
+  /// Maps a segment that has previously been returned by write() into memory
+  [[nodiscard]] llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
+  read(Segment Seg) const;
+
+  [[nodiscard]] uint64_t size() const noexcept { return Size; }
+  [[nodiscard]] llvm::StringRef getPath() const noexcept { return Path; }
+
+private:
+  SpillFile(int FD, llvm::SmallString<128> Path);
+
+  int FD = -1;
+  llvm::SmallString<128> Path;
+  std::unique_ptr<llvm::raw_fd_ostream> OS;
+  uint64_t Size = 0;
+};
+
+struct MemoryBudgetConfig {
+  /// Spill the jump functions and end summaries of cold functions to disk,
+  /// when the heap usage exceeds this many bytes
+  size_t Limit = 0;
+  /// Once spilling, spill until the heap usage drops below this fraction of
+  /// the Limit
+  double LowWatermark = 0.8;
+  /// The directory for the spill file. Empty for the system's temporary
+  /// directory.
+  std::string SpillDir;
+  /// How often to check the heap usage. A function counts as cold, if it has
+  /// not been used since the previous check.
+  std::chrono::milliseconds CheckInterval = std::chrono::milliseconds{100};
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_SPILLFILE_H
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_STRINGTABLE_H
+#define PHASAR_UTILS_STRINGTABLE_H
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// Interns strings for the record-based binary formats (checkpoints, ESG
+/// export, columnar results).
+///
+/// These formats refer to strings by ids that are assigned in order of first
+/// use. A string is written as a record of its own with the tag 'S' before its
+/// first use; the payload is the ULEB128 encoded length of the string followed
+/// by the raw bytes.
+class StringTableWriter {
+public:
+  static constexpr char RecordTag = 'S';
+
+  /// Returns the id of Str and whether Str has not been seen before. Does not
+  /// write anything.
+  [[nodiscard]] std::pair<uint32_t, bool> insert(llvm::StringRef Str);
+
+  /// Returns the id of Str. Writes a string record to OS, if Str has not been
+  /// seen before.
+  [[nodiscard]] uint32_t getStringId(llvm::StringRef Str,
+                                     llvm::raw_ostream &OS) {
+    auto [Id, Inserted] = insert(Str);
+    if (Inserted) {
+      writeRecord(Str, OS);
+    }
+    return Id;
+  }
+
+  [[nodiscard]] llvm::StringRef getString(uint32_t Id) const {
+    assert(Id < Strings.size() && "Invalid string-id");
+    return Strings[Id];
+  }
+
+  [[nodiscard]] bool contains(uint64_t Id) const noexcept {
+    return Id < Strings.size();
+  }
+  [[nodiscard]] size_t size() const noexcept { return Strings.size(); }
+
+  /// Writes a string record, i.e., the tag followed by the payload
+  static void writeRecord(llvm::StringRef Str, llvm::raw_ostream &OS);
+  /// Writes the payload of a string record without the tag
+  static void writeString(llvm::StringRef Str, llvm::raw_ostream &OS);
+
+private:
+  llvm::StringMap<uint32_t> StringIds;
+  /// Points into the keys of StringIds
+  std::vector<llvm::StringRef> Strings;
+};
+
+/// Collects the strings of a buffer written with the StringTableWriter. The
+/// strings point into the buffer, so it must outlive the reader.
+class StringTableReader {
+public:
+  /// Reads the payload of a string record, i.e., everything after the tag, and
+  /// assigns the string the next id. Errors are reported through Cur.
+  void readRecord(llvm::DataExtractor &Data, llvm::DataExtractor::Cursor &Cur) {
+    Strings.push_back(readString(Data, Cur));
+  }
+
+  /// Reads the payload of a string record. Errors are reported through Cur.
+  [[nodiscard]] static llvm::StringRef
+  readString(llvm::DataExtractor &Data, llvm::DataExtractor::Cursor &Cur);
+
+  [[nodiscard]] llvm::StringRef getString(uint64_t Id) const {
+    assert(Id < Strings.size() && "Invalid string-id");
+    return Strings[Id];
+  }
+
+  [[nodiscard]] bool contains(uint64_t Id) const noexcept {
+    return Id < Strings.size();
+  }
+  [[nodiscard]] size_t size() const noexcept { return Strings.size(); }
+
+private:
+  std::vector<llvm::StringRef> Strings;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_STRINGTABLE_H
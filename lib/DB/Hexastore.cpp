@@ -11,101 +11,252 @@
 
 #include "phasar/DB/Queries.h"
 
-#include "boost/format.hpp"
 #include "sqlite3.h"
 
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
 namespace psr {
 
-Hexastore::Hexastore(const std::string &Filename) {
-  sqlite3_open(Filename.c_str(), &HSInternalDB);
-  const std::string &Query = INIT;
-  char *Err;
-  sqlite3_exec(HSInternalDB, Query.c_str(), callback, nullptr, &Err);
+HSCursor::HSCursor(HSCursor &&Other) noexcept
+    : Stmt(std::exchange(Other.Stmt, nullptr)),
+      InUse(std::exchange(Other.InUse, nullptr)),
+      Current(std::move(Other.Current)) {}
+
+HSCursor &HSCursor::operator=(HSCursor &&Other) noexcept {
+  if (this != &Other) {
+    release();
+    Stmt = std::exchange(Other.Stmt, nullptr);
+    InUse = std::exchange(Other.InUse, nullptr);
+    Current = std::move(Other.Current);
+  }
+  return *this;
+}
+
+HSCursor::~HSCursor() { release(); }
+
+void HSCursor::release() noexcept {
+  if (!Stmt) {
+    return;
+  }
+  if (!InUse) {
+    sqlite3_finalize(Stmt);
+  } else {
+    // Make the cached statement available for the next query
+    sqlite3_reset(Stmt);
+    sqlite3_clear_bindings(Stmt);
+    *InUse = false;
+  }
+  Stmt = nullptr;
+  InUse = nullptr;
+}
+
+bool HSCursor::next() {
+  if (!Stmt) {
+    return false;
+  }
+
+  auto Rc = sqlite3_step(Stmt);
+  if (Rc != SQLITE_ROW) {
+    if (Rc != SQLITE_DONE) {
+      llvm::outs() << sqlite3_errmsg(sqlite3_db_handle(Stmt)) << '\n';
+    }
+    release();
+    return false;
+  }
+
+  auto getColumn = [this](int Col, std::string &Into) {
+    const auto *Text = sqlite3_column_text(Stmt, Col);
+    Into.assign(Text ? reinterpret_cast<const char *>(Text) : "",
+                sqlite3_column_bytes(Stmt, Col));
+  };
+  getColumn(0, Current.Subject);
+  getColumn(1, Current.Predicate);
+  getColumn(2, Current.Object);
+  return true;
+}
+
+Hexastore::Hexastore(const std::string &FileName, bool EnableWAL) {
+  sqlite3_open(FileName.c_str(), &HSInternalDB);
+  if (EnableWAL) {
+    exec("PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;");
+  }
+  exec(INIT.c_str());
+
+  // Prepare all statements once, instead of compiling the SQL for every
+  // single put() or get()
+  const std::string *InsertQueries[] = {&SPOInsert, &SOPInsert, &PSOInsert,
+                                        &POSInsert, &OSPInsert, &OPSInsert};
+  for (size_t I = 0; I < InsertStmts.size(); ++I) {
+    const char *Tail = InsertQueries[I]->c_str();
+    while (*Tail) {
+      auto *Stmt = prepare(Tail, &Tail);
+      if (!Stmt) {
+        break;
+      }
+      InsertStmts[I].push_back(Stmt);
+    }
+  }
+
+  /// Indexed by the bit-mask of the fixed elements of the query, see query()
+  const std::string *SearchQueries[] = {&SearchXXX, &SearchXXO, &SearchXPX,
+                                        &SearchXPO, &SearchSXX, &SearchSXO,
+                                        &SearchSPX, &SearchSPO};
+  for (size_t I = 0; I < SearchStmts.size(); ++I) {
+    SearchStmts[I] = prepare(SearchQueries[I]->c_str());
+  }
+
+  BeginStmt = prepare("BEGIN TRANSACTION;");
+  CommitStmt = prepare("COMMIT;");
+}
+
+Hexastore::~Hexastore() {
+  endBulkLoad();
+
+  for (const auto &Stmts : InsertStmts) {
+    for (auto *Stmt : Stmts) {
+      sqlite3_finalize(Stmt);
+    }
+  }
+  for (auto *Stmt : SearchStmts) {
+    sqlite3_finalize(Stmt);
+  }
+  sqlite3_finalize(BeginStmt);
+  sqlite3_finalize(CommitStmt);
+
+  sqlite3_close(HSInternalDB);
+}
+
+void Hexastore::exec(const char *Query) {
+  char *Err = nullptr;
+  sqlite3_exec(HSInternalDB, Query, nullptr, nullptr, &Err);
   if (Err != nullptr) {
     llvm::outs() << Err << "\n\n";
+    sqlite3_free(Err);
   }
 }
 
-Hexastore::~Hexastore() { sqlite3_close(HSInternalDB); }
+sqlite3_stmt *Hexastore::prepare(const char *Query, const char **Tail) {
+  sqlite3_stmt *Stmt = nullptr;
+  if (sqlite3_prepare_v2(HSInternalDB, Query, -1, &Stmt, Tail) != SQLITE_OK) {
+    llvm::outs() << sqlite3_errmsg(HSInternalDB) << '\n';
+    return nullptr;
+  }
+  return Stmt;
+}
 
-int Hexastore::callback(void * /*NotUsed*/, int Argc, char **Argv,
-                        char **AzColName) {
-  for (int Idx = 0; Idx < Argc; ++Idx) {
-    llvm::outs() << AzColName[Idx] << " " << (Argv[Idx] ? Argv[Idx] : "NULL")
-                 << '\n';
+void Hexastore::step(sqlite3_stmt *Stmt) {
+  if (!Stmt) {
+    return;
+  }
+  auto Rc = sqlite3_step(Stmt);
+  if (Rc != SQLITE_DONE && Rc != SQLITE_ROW) {
+    llvm::outs() << sqlite3_errmsg(HSInternalDB) << '\n';
   }
-  return 0;
+  sqlite3_reset(Stmt);
 }
 
 void Hexastore::put(const std::array<std::string, 3> &Edge) {
-  doPut(SPOInsert, Edge);
-  doPut(SOPInsert, Edge);
-  doPut(PSOInsert, Edge);
-  doPut(POSInsert, Edge);
-  doPut(OSPInsert, Edge);
-  doPut(OPSInsert, Edge);
+  if (!isInBulkLoad()) {
+    // Insert all six permutations within one transaction instead of one
+    // implicit transaction per statement
+    step(BeginStmt);
+  }
+
+  for (const auto &Stmts : InsertStmts) {
+    doPut(Stmts, Edge);
+  }
+
+  if (!isInBulkLoad()) {
+    step(CommitStmt);
+  } else if (++NumPendingInBatch == BulkBatchSize) {
+    step(CommitStmt);
+    step(BeginStmt);
+    NumPendingInBatch = 0;
+  }
 }
 
-void Hexastore::doPut(const std::string &Query,
-                      std::array<std::string, 3> Edge) {
-  std::string CompiledQuery =
-      str(boost::format(Query) % Edge[0] % Edge[1] % Edge[2]);
-  char *Err;
-  sqlite3_exec(HSInternalDB, CompiledQuery.c_str(), callback, nullptr, &Err);
-  if (Err != nullptr) {
-    llvm::outs() << Err;
+void Hexastore::doPut(llvm::ArrayRef<sqlite3_stmt *> Stmts,
+                      const std::array<std::string, 3> &Edge) {
+  for (auto *Stmt : Stmts) {
+    // The parameters are numbered ?1, ?2, ?3, so this is the highest number
+    // that is used in Stmt
+    auto NumParams = std::min(sqlite3_bind_parameter_count(Stmt), 3);
+    for (int I = 0; I < NumParams; ++I) {
+      sqlite3_bind_text(Stmt, I + 1, Edge[I].data(), int(Edge[I].size()),
+                        SQLITE_STATIC);
+    }
+    step(Stmt);
+  }
+}
+
+void Hexastore::putAll(llvm::ArrayRef<std::array<std::string, 3>> Edges) {
+  bool WasInBulkLoad = isInBulkLoad();
+  if (!WasInBulkLoad) {
+    beginBulkLoad();
+  }
+
+  for (const auto &Edge : Edges) {
+    put(Edge);
+  }
+
+  if (!WasInBulkLoad) {
+    endBulkLoad();
+  }
+}
+
+void Hexastore::beginBulkLoad(size_t BatchSize) {
+  assert(!isInBulkLoad() && "The bulk-load mode is already active");
+  BulkBatchSize = std::max<size_t>(BatchSize, 1);
+  NumPendingInBatch = 0;
+  step(BeginStmt);
+}
+
+void Hexastore::endBulkLoad() {
+  if (!isInBulkLoad()) {
+    return;
   }
+  step(CommitStmt);
+  BulkBatchSize = 0;
+  NumPendingInBatch = 0;
+}
+
+HSCursor Hexastore::query(const std::array<std::string, 3> &EdgeQuery) {
+  unsigned Kind = (unsigned(EdgeQuery[0] != "?") << 2) |
+                  (unsigned(EdgeQuery[1] != "?") << 1) |
+                  unsigned(EdgeQuery[2] != "?");
+
+  auto *Stmt = SearchStmts[Kind];
+  bool *InUse = &SearchStmtInUse[Kind];
+  if (Stmt && *InUse) {
+    // Another cursor of the same kind is still active
+    Stmt = prepare(sqlite3_sql(Stmt));
+    InUse = nullptr;
+  }
+  if (!Stmt) {
+    return {nullptr, nullptr};
+  }
+  if (InUse) {
+    *InUse = true;
+  }
+
+  auto NumParams = std::min(sqlite3_bind_parameter_count(Stmt), 3);
+  for (int I = 0; I < NumParams; ++I) {
+    sqlite3_bind_text(Stmt, I + 1, EdgeQuery[I].data(),
+                      int(EdgeQuery[I].size()), SQLITE_TRANSIENT);
+  }
+  return {Stmt, InUse};
 }
 
 std::vector<HSResult> Hexastore::get(std::array<std::string, 3> EdgeQuery,
                                      size_t ResultSizeHint) {
   std::vector<HSResult> Result;
   Result.reserve(ResultSizeHint);
-  std::string QueryString;
-  if (EdgeQuery[0] == "?") {
-    if (EdgeQuery[1] == "?") {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchXXX;
-      } else {
-        QueryString = SearchXXO;
-      }
-    } else {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchXPX;
-      } else {
-        QueryString = SearchXPO;
-      }
-    }
-  } else {
-    if (EdgeQuery[1] == "?") {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchSXX;
-      } else {
-        QueryString = SearchSXO;
-      }
-    } else {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchSPX;
-      } else {
-        QueryString = SearchSPO;
-      }
-    }
-  }
-  std::string CompiledQuery = str(boost::format(QueryString) % EdgeQuery[0] %
-                                  EdgeQuery[1] % EdgeQuery[2]);
-  // this lambda will collect all of our results, since it is called on every
-  // row of the result set
-  auto SqliteCBResultCollector = [](void *CB, int /*Argc*/, char **Argv,
-                                    char ** /*AzColName*/) {
-    auto *Res = static_cast<std::vector<HSResult> *>(CB);
-    Res->emplace_back(Argv[0], Argv[1], Argv[2]);
-    return 0;
-  };
-  char *Err;
-  sqlite3_exec(HSInternalDB, CompiledQuery.c_str(), SqliteCBResultCollector,
-               &Result, &Err);
-  if (Err != nullptr) {
-    llvm::outs() << Err;
+
+  auto Cursor = query(EdgeQuery);
+  while (Cursor.next()) {
+    Result.push_back(Cursor.get());
   }
   return Result;
 }
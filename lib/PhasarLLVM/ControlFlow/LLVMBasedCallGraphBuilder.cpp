@@ -97,8 +97,16 @@ auto Builder::buildCallGraph(Soundness S) -> LLVMBasedCallGraph {
               Full);
   REG_COUNTER("CG CallSites", CGBuilder.viewCallGraph().getNumVertexCallSites(),
               Full);
+  REG_COUNTER("CG VCall Cache Hits",
+              Res->getVirtualCallTargetCacheStats().Hits, Full);
+  REG_COUNTER("CG VCall Cache Misses",
+              Res->getVirtualCallTargetCacheStats().Misses, Full);
   PHASAR_LOG_LEVEL_CAT(INFO, "LLVMBasedICFG",
                        "Call graph has been constructed");
+  PHASAR_LOG_LEVEL_CAT(
+      INFO, "LLVMBasedICFG",
+      "Virtual-call target cache hit rate: "
+          << Res->getVirtualCallTargetCacheStats().getHitRate());
   return CGBuilder.consumeCallGraph();
 }
 
@@ -66,17 +66,19 @@ auto CHAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
   const auto *ReceiverTy = getReceiverType(CallSite);
 
   // also insert all possible subtypes vtable entries
-  auto FallbackTys = TH->getSubTypes(ReceiverTy);
+  auto Targets = CHATargets.getOrCompute(ReceiverTy, VtableIndex, [&] {
+    VirtualCallTargetCache::TargetListTy Ret;
+    for (const auto *FallbackTy : TH->subTypesOf(ReceiverTy)) {
+      if (const auto *Target =
+              getNonPureVirtualVFTEntry(FallbackTy, VtableIndex)) {
+        Ret.push_back(Target);
+      }
+    }
+    return Ret;
+  });
 
   FunctionSetTy PossibleCallees;
-
-  for (const auto &FallbackTy : FallbackTys) {
-    const auto *Target =
-        getNonPureVirtualVFTEntry(FallbackTy, VtableIndex, CallSite);
-    if (Target) {
-      PossibleCallees.insert(Target);
-    }
-  }
+  addConsistentTargets(PossibleCallees, *Targets, CallSite);
   return PossibleCallees;
 }
 
@@ -158,8 +158,10 @@ void DTAResolver::otherInst(const llvm::Instruction *Inst) {
         psr::legacy::stripPointer(Dest)); // NOLINT
 
     if (SrcStructType && DestStructType &&
-        heuristicAntiConstructorVtablePos(BitCast)) {
-      TypeGraph.addLink(DestStructType, SrcStructType);
+        heuristicAntiConstructorVtablePos(BitCast) &&
+        TypeGraph.addLink(DestStructType, SrcStructType)) {
+      // The possible types of the receivers may have changed
+      DTATargets.clear();
     }
   }
 }
@@ -187,23 +189,25 @@ auto DTAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
 
   const auto *ReceiverType = getReceiverType(CallSite);
 
-  auto PossibleTypes = TypeGraph.getTypes(ReceiverType);
-
-  // WARNING We deactivated the check on allocated because it is
-  // unabled to get the types allocated in the used libraries
-  // auto allocated_types = IRDB.getAllocatedTypes();
-  // auto end_it = allocated_types.end();
-  for (const auto *PossibleType : PossibleTypes) {
-    if (const auto *PossibleTypeStruct =
-            llvm::dyn_cast<llvm::StructType>(PossibleType)) {
-      // if ( allocated_types.find(possible_type_struct) != end_it ) {
-      const auto *Target =
-          getNonPureVirtualVFTEntry(PossibleTypeStruct, VtableIndex, CallSite);
-      if (Target) {
-        PossibleCallTargets.insert(Target);
+  auto Targets = DTATargets.getOrCompute(ReceiverType, VtableIndex, [&] {
+    VirtualCallTargetCache::TargetListTy Ret;
+    // WARNING We deactivated the check on allocated because it is
+    // unabled to get the types allocated in the used libraries
+    // auto allocated_types = IRDB.getAllocatedTypes();
+    // auto end_it = allocated_types.end();
+    for (const auto *PossibleType : TypeGraph.getTypes(ReceiverType)) {
+      if (const auto *PossibleTypeStruct =
+              llvm::dyn_cast<llvm::StructType>(PossibleType)) {
+        // if ( allocated_types.find(possible_type_struct) != end_it ) {
+        if (const auto *Target =
+                getNonPureVirtualVFTEntry(PossibleTypeStruct, VtableIndex)) {
+          Ret.push_back(Target);
+        }
       }
     }
-  }
+    return Ret;
+  });
+  addConsistentTargets(PossibleCallTargets, *Targets, CallSite);
 
   if (PossibleCallTargets.empty()) {
     PossibleCallTargets = CHAResolver::resolveVirtualCall(CallSite);
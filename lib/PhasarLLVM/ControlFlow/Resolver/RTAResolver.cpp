@@ -67,23 +67,20 @@ auto RTAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
   const auto *ReceiverType = getReceiverType(CallSite);
 
   // also insert all possible subtypes vtable entries
-  auto ReachableTypes = TH->getSubTypes(ReceiverType);
-
-  // also insert all possible subtypes vtable entries
-
-  auto EndIt = ReachableTypes.end();
-  for (const auto *PossibleType : AllocatedStructTypes) {
-    if (const auto *PossibleTypeStruct =
-            llvm::dyn_cast<llvm::StructType>(PossibleType)) {
-      if (ReachableTypes.find(PossibleTypeStruct) != EndIt) {
-        const auto *Target = getNonPureVirtualVFTEntry(PossibleTypeStruct,
-                                                       VtableIndex, CallSite);
-        if (Target) {
-          PossibleCallTargets.insert(Target);
-        }
+  auto Targets = RTATargets.getOrCompute(ReceiverType, VtableIndex, [&] {
+    VirtualCallTargetCache::TargetListTy Ret;
+    for (const auto *PossibleType : AllocatedStructTypes) {
+      if (!TH->isSubType(ReceiverType, PossibleType)) {
+        continue;
+      }
+      if (const auto *Target =
+              getNonPureVirtualVFTEntry(PossibleType, VtableIndex)) {
+        Ret.push_back(Target);
       }
     }
-  }
+    return Ret;
+  });
+  addConsistentTargets(PossibleCallTargets, *Targets, CallSite);
 
   if (PossibleCallTargets.empty()) {
     return CHAResolver::resolveVirtualCall(CallSite);
@@ -137,19 +137,39 @@ Resolver::Resolver(const LLVMProjectIRDB *IRDB, const LLVMVFTableProvider *VTP)
 const llvm::Function *
 Resolver::getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx,
                                     const llvm::CallBase *CallSite) {
+  const auto *Target = getNonPureVirtualVFTEntry(T, Idx);
+  if (Target && isConsistentCall(CallSite, Target)) {
+    return Target;
+  }
+  return nullptr;
+}
+
+const llvm::Function *
+Resolver::getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx) {
   if (!VTP) {
     return nullptr;
   }
   if (const auto *VT = VTP->getVFTableOrNull(T)) {
     const auto *Target = VT->getFunction(Idx);
-    if (Target && Target->getName() != LLVMTypeHierarchy::PureVirtualCallName &&
-        isConsistentCall(CallSite, Target)) {
+    if (Target &&
+        Target->getName() != LLVMTypeHierarchy::PureVirtualCallName) {
       return Target;
     }
   }
   return nullptr;
 }
 
+void Resolver::addConsistentTargets(
+    FunctionSetTy &PossibleTargets,
+    llvm::ArrayRef<const llvm::Function *> Targets,
+    const llvm::CallBase *CallSite) {
+  for (const auto *Target : Targets) {
+    if (isConsistentCall(CallSite, Target)) {
+      PossibleTargets.insert(Target);
+    }
+  }
+}
+
 void Resolver::preCall(const llvm::Instruction *Inst) {}
 
 void Resolver::handlePossibleTargets(const llvm::CallBase *CallSite,
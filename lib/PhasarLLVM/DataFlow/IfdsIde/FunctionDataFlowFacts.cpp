@@ -0,0 +1,72 @@
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+
+#include "phasar/Utils/IO.h"
+#include "phasar/Utils/Logger.h"
+#include "phasar/Utils/NlohmannLogging.h"
+
+#include <limits>
+#include <optional>
+#include <string>
+
+using namespace psr;
+using namespace psr::library_summary;
+
+static std::optional<uint16_t> getParamIndex(const nlohmann::json &Json) {
+  if (!Json.is_number_unsigned() ||
+      Json.get<uint64_t>() > std::numeric_limits<uint16_t>::max()) {
+    return std::nullopt;
+  }
+  return Json.get<uint16_t>();
+}
+
+static FunctionDataFlowFacts getDataFromJson(const nlohmann::json &Json) {
+  FunctionDataFlowFacts ToReturn;
+
+  if (!Json.is_object()) {
+    PHASAR_LOG_LEVEL(WARNING, "Invalid library summary: " << Json);
+    return ToReturn;
+  }
+
+  for (const auto &[FunName, Flows] : Json.get<nlohmann::json::object_t>()) {
+    if (!Flows.is_array()) {
+      PHASAR_LOG_LEVEL(WARNING, "Invalid data-flows of function " << FunName
+                                                                  << ": "
+                                                                  << Flows);
+      continue;
+    }
+
+    for (const auto &Flow : Flows) {
+      auto From = Flow.is_object() && Flow.contains("from")
+                      ? getParamIndex(Flow["from"])
+                      : std::nullopt;
+      if (!From || !Flow.contains("to")) {
+        PHASAR_LOG_LEVEL(WARNING, "Invalid data-flow of function "
+                                      << FunName << ": " << Flow);
+        continue;
+      }
+
+      const auto &To = Flow["to"];
+      if (To.is_string() && To.get<std::string>() == "ret") {
+        ToReturn.addElement(FunName, *From, ReturnValue{});
+      } else if (auto ToParam = getParamIndex(To)) {
+        ToReturn.addElement(FunName, *From, Parameter{*ToParam});
+      } else {
+        PHASAR_LOG_LEVEL(WARNING, "Invalid data-flow target of function "
+                                      << FunName << ": " << To);
+      }
+    }
+  }
+
+  return ToReturn;
+}
+
+FunctionDataFlowFacts
+library_summary::readFunctionDataFlowFacts(const llvm::Twine &Path) {
+  return getDataFromJson(readJsonFile(Path));
+}
+
+FunctionDataFlowFacts
+library_summary::parseFunctionDataFlowFacts(llvm::StringRef JsonAsString) {
+  return getDataFromJson(
+      nlohmann::json::parse(JsonAsString.begin(), JsonAsString.end()));
+}
@@ -37,6 +37,15 @@ bool IFDSIDESolverConfig::emitESG() const {
 bool IFDSIDESolverConfig::computePersistedSummaries() const {
   return hasFlag(Options, SolverConfigOptions::ComputePersistedSummaries);
 }
+bool IFDSIDESolverConfig::memoizeEdgeFunctions() const {
+  return hasFlag(Options, SolverConfigOptions::MemoizeEdgeFunctions);
+}
+bool IFDSIDESolverConfig::poolEdgeFunctions() const {
+  return hasFlag(Options, SolverConfigOptions::PoolEdgeFunctions);
+}
+bool IFDSIDESolverConfig::sparse() const {
+  return hasFlag(Options, SolverConfigOptions::Sparse);
+}
 
 void IFDSIDESolverConfig::setFollowReturnsPastSeeds(bool Set) {
   setFlag(Options, SolverConfigOptions::FollowReturnsPastSeeds, Set);
@@ -56,6 +65,15 @@ void IFDSIDESolverConfig::setEmitESG(bool Set) {
 void IFDSIDESolverConfig::setComputePersistedSummaries(bool Set) {
   setFlag(Options, SolverConfigOptions::ComputePersistedSummaries, Set);
 }
+void IFDSIDESolverConfig::setMemoizeEdgeFunctions(bool Set) {
+  setFlag(Options, SolverConfigOptions::MemoizeEdgeFunctions, Set);
+}
+void IFDSIDESolverConfig::setPoolEdgeFunctions(bool Set) {
+  setFlag(Options, SolverConfigOptions::PoolEdgeFunctions, Set);
+}
+void IFDSIDESolverConfig::setSparse(bool Set) {
+  setFlag(Options, SolverConfigOptions::Sparse, Set);
+}
 
 void IFDSIDESolverConfig::setConfig(SolverConfigOptions Opt) { Options = Opt; }
 
@@ -68,7 +86,10 @@ ostream &operator<<(ostream &OS, const IFDSIDESolverConfig &SC) {
             << "\trecordEdges: " << SC.recordEdges() << "\n"
             << "\tcomputePersistedSummaries: " << SC.computePersistedSummaries()
             << "\n"
-            << "\temitESG: " << SC.emitESG();
+            << "\temitESG: " << SC.emitESG() << "\n"
+            << "\tmemoizeEdgeFunctions: " << SC.memoizeEdgeFunctions() << "\n"
+            << "\tpoolEdgeFunctions: " << SC.poolEdgeFunctions() << "\n"
+            << "\tsparse: " << SC.sparse();
 }
 
 } // namespace psr
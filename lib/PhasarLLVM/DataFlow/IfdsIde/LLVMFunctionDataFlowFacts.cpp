@@ -16,3 +16,22 @@ library_summary::readFromFDFF(const FunctionDataFlowFacts &Fdff,
   }
   return Llvmfdff;
 }
+
+LLVMFunctionDataFlowFacts
+library_summary::readFromSummaryTable(const LibrarySummaryTable &Table,
+                                      const LLVMProjectIRDB &Irdb) {
+  LLVMFunctionDataFlowFacts Llvmfdff;
+
+  for (const llvm::Function *Fun : Irdb.getAllFunctions()) {
+    auto Entries = Table.getEntriesForFunction(Fun->getName());
+    if (Entries.empty()) {
+      continue;
+    }
+
+    auto &Mapping = Llvmfdff.LLVMFdff[Fun];
+    for (const auto &Entry : Entries) {
+      Mapping[Entry.ParamIndex].push_back(Entry.Fact);
+    }
+  }
+  return Llvmfdff;
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMSolverCheckpointCodec.h"
+
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/Support/Casting.h"
+
+using namespace psr;
+
+static std::optional<std::string> encodeValue(const llvm::Value *V) {
+  if (V == nullptr) {
+    return std::nullopt;
+  }
+  // Functions have no metadata id
+  if (const auto *Fun = llvm::dyn_cast<llvm::Function>(V)) {
+    return ("@" + Fun->getName()).str();
+  }
+  auto Id = getMetaDataID(V);
+  if (Id == "-1") {
+    return std::nullopt;
+  }
+  return Id;
+}
+
+std::optional<std::string>
+LLVMCheckpointEntityCodec::encodeNode(const llvm::Instruction *Inst) const {
+  return encodeValue(Inst);
+}
+
+std::optional<const llvm::Instruction *>
+LLVMCheckpointEntityCodec::decodeNode(llvm::StringRef Str) const {
+  const auto *V = fromMetaDataId(*IRDB, Str);
+  if (const auto *Inst = llvm::dyn_cast_or_null<llvm::Instruction>(V)) {
+    return Inst;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string>
+LLVMCheckpointEntityCodec::encodeFact(const llvm::Value *Fact) const {
+  return encodeValue(Fact);
+}
+
+std::optional<const llvm::Value *>
+LLVMCheckpointEntityCodec::decodeFact(llvm::StringRef Str) const {
+  if (Str.consume_front("@")) {
+    return decodeFunction(Str);
+  }
+  if (const auto *V = fromMetaDataId(*IRDB, Str)) {
+    return V;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string>
+LLVMCheckpointEntityCodec::encodeFunction(const llvm::Function *Fun) const {
+  if (Fun == nullptr) {
+    return std::nullopt;
+  }
+  return Fun->getName().str();
+}
+
+std::optional<const llvm::Function *>
+LLVMCheckpointEntityCodec::decodeFunction(llvm::StringRef Str) const {
+  if (const auto *Fun = IRDB->getFunction(Str)) {
+    return Fun;
+  }
+  return std::nullopt;
+}
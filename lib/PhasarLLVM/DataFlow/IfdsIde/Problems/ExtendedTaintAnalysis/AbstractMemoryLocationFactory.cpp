@@ -60,19 +60,28 @@ AbstractMemoryLocationFactoryBase::Allocator::Allocator(
     return;
   }
 
+  // Only remember the initial capacity, if we actually allocated a custom-sized
+  // initial block. This is required to compute the size of that block on
+  // destruction.
+  this->InitialCapacity = InitialCapacity;
+
   const auto NumPointersPerInitialBlock =
       (MinNumPointersPerAML + 3) * InitialCapacity;
   Root = Block::create(nullptr, NumPointersPerInitialBlock);
   Pos = Root->getTrailingObjects<void *>();
   End = Pos + NumPointersPerInitialBlock;
+
+  ++NumBlocks;
+  NumAllocatedBytes += (1 + NumPointersPerInitialBlock) * sizeof(void *);
 }
 
 AbstractMemoryLocationFactoryBase::Allocator::~Allocator() {
-  auto *Rt = Root;
-  auto *Blck = Rt;
+  auto *Blck = Root;
   while (Blck) {
     auto *Nxt = Blck->Next;
-    Block::destroy(Blck, Blck == Rt
+    // The blocks are chained in reverse allocation order, so the (optional)
+    // custom-sized initial block is always the last one
+    Block::destroy(Blck, !Nxt && InitialCapacity
                              ? (MinNumPointersPerAML + 3) * InitialCapacity
                              : NumPointersPerBlock);
     Blck = Nxt;
@@ -84,10 +93,20 @@ AbstractMemoryLocationFactoryBase::Allocator::~Allocator() {
 
 AbstractMemoryLocationFactoryBase::Allocator::Allocator(
     Allocator &&Other) noexcept
-    : Root(Other.Root), Pos(Other.Pos), End(Other.End) {
+    : Root(Other.Root), Pos(Other.Pos), End(Other.End),
+      InitialCapacity(Other.InitialCapacity), NumBlocks(Other.NumBlocks),
+      NumAllocatedBytes(Other.NumAllocatedBytes),
+      NumUsedBytes(Other.NumUsedBytes), NumFreeBytes(Other.NumFreeBytes),
+      FreeLists(std::move(Other.FreeLists)) {
   Other.Root = nullptr;
   Other.Pos = nullptr;
   Other.End = nullptr;
+  Other.InitialCapacity = 0;
+  Other.NumBlocks = 0;
+  Other.NumAllocatedBytes = 0;
+  Other.NumUsedBytes = 0;
+  Other.NumFreeBytes = 0;
+  Other.FreeLists.clear();
 }
 
 auto AbstractMemoryLocationFactoryBase::Allocator::operator=(
@@ -107,6 +126,20 @@ AbstractMemoryLocationFactoryBase::Allocator::create(
   auto NumPointersRequired =
       AbstractMemoryLocationImpl::totalSizeToAlloc<ptrdiff_t>(Offsets.size()) /
       sizeof(void *);
+  NumUsedBytes += NumPointersRequired * sizeof(void *);
+
+  if (NumPointersRequired < FreeLists.size() &&
+      !FreeLists[NumPointersRequired].empty()) {
+    auto *Ret = reinterpret_cast<AbstractMemoryLocationImpl *>(
+        FreeLists[NumPointersRequired].back());
+    FreeLists[NumPointersRequired].pop_back();
+    NumFreeBytes -= NumPointersRequired * sizeof(void *);
+
+    __asan_unpoison_memory_region(Ret, NumPointersRequired * sizeof(void *));
+    new (Ret) AbstractMemoryLocationImpl(Baseptr, Offsets, Lifetime);
+    return Ret;
+  }
+
   auto *Rt = Root;
   auto *Curr = Pos;
 
@@ -114,6 +147,9 @@ AbstractMemoryLocationFactoryBase::Allocator::create(
     Root = Rt = Block::create(Rt, NumPointersPerBlock);
     Pos = Curr = Rt->getTrailingObjects<void *>();
     End = Curr + NumPointersPerBlock;
+
+    ++NumBlocks;
+    NumAllocatedBytes += (1 + NumPointersPerBlock) * sizeof(void *);
   }
 
   auto *Ret = reinterpret_cast<AbstractMemoryLocationImpl *>(Curr);
@@ -127,6 +163,25 @@ AbstractMemoryLocationFactoryBase::Allocator::create(
   return Ret;
 }
 
+void AbstractMemoryLocationFactoryBase::Allocator::destroy(
+    AbstractMemoryLocationImpl *AML) {
+  auto NumPointersRequired =
+      AbstractMemoryLocationImpl::totalSizeToAlloc<ptrdiff_t>(
+          AML->NumOffsets) /
+      sizeof(void *);
+
+  AML->~AbstractMemoryLocationImpl();
+  // Detect dangling references to reclaimed memory locations
+  __asan_poison_memory_region(AML, NumPointersRequired * sizeof(void *));
+
+  if (FreeLists.size() <= NumPointersRequired) {
+    FreeLists.resize(NumPointersRequired + 1);
+  }
+  FreeLists[NumPointersRequired].push_back(reinterpret_cast<void **>(AML));
+  NumUsedBytes -= NumPointersRequired * sizeof(void *);
+  NumFreeBytes += NumPointersRequired * sizeof(void *);
+}
+
 AbstractMemoryLocationFactoryBase::AbstractMemoryLocationFactoryBase(
     size_t InitialCapacity)
     : Owner(InitialCapacity) {
@@ -150,6 +205,79 @@ void AbstractMemoryLocationFactoryBase::setDataLayout(
   this->DL = &DL;
 }
 
+AbstractMemoryLocationStatistics
+AbstractMemoryLocationFactoryBase::getStatistics() const {
+  AbstractMemoryLocationStatistics Ret;
+  Ret.NumLocations = Pool.size();
+  Ret.NumCachedValues = Cache.size();
+  Ret.NumBlocks = Owner.NumBlocks;
+  Ret.NumAllocatedBytes = Owner.NumAllocatedBytes;
+  Ret.NumUsedBytes = Owner.NumUsedBytes;
+  Ret.NumFreeBytes = Owner.NumFreeBytes;
+  Ret.NumPoolHits = NumPoolHits;
+  Ret.NumPoolMisses = NumPoolMisses;
+  Ret.NumCacheHits = NumCacheHits;
+  Ret.NumCollections = NumCollections;
+  Ret.NumReclaimedLocations = NumReclaimedLocations;
+  return Ret;
+}
+
+void AbstractMemoryLocationFactoryBase::markLiveImpl(
+    const AbstractMemoryLocationImpl *AML) {
+  LiveMarks.insert(AML);
+}
+
+size_t AbstractMemoryLocationFactoryBase::collectGarbage(bool Full) {
+  // The young generation is only tracked after the first collection
+  Full |= NumCollections == 0;
+  ++NumCollections;
+
+  llvm::SmallVector<const AbstractMemoryLocationImpl *> Dead;
+  if (Full) {
+    for (const auto &AML : Pool) {
+      if (!LiveMarks.count(&AML)) {
+        Dead.push_back(&AML);
+      }
+    }
+  } else {
+    for (const auto *AML : YoungGeneration) {
+      if (!LiveMarks.count(AML)) {
+        Dead.push_back(AML);
+      }
+    }
+  }
+  YoungGeneration.clear();
+  LiveMarks.clear();
+
+  if (Dead.empty()) {
+    return 0;
+  }
+
+  llvm::DenseSet<const AbstractMemoryLocationImpl *> DeadSet(Dead.begin(),
+                                                              Dead.end());
+  for (auto It = Cache.begin(), End = Cache.end(); It != End;) {
+    // Erasing from a DenseMap does not invalidate the other iterators
+    auto Curr = It++;
+    if (DeadSet.count(Curr->second)) {
+      Cache.erase(Curr);
+    }
+  }
+
+  for (const auto *AML : Dead) {
+#ifdef XTAINT_DIAGNOSTICS
+    overApproximatedAMLs.erase(AML);
+#endif
+    auto *MutAML = const_cast<AbstractMemoryLocationImpl *>(AML);
+    Pool.RemoveNode(MutAML);
+    Owner.destroy(MutAML);
+  }
+
+  NumReclaimedLocations += Dead.size();
+  PHASAR_LOG_LEVEL(DEBUG, "Reclaimed " << Dead.size()
+                                       << " abstract memory locations");
+  return Dead.size();
+}
+
 const AbstractMemoryLocationImpl *
 AbstractMemoryLocationFactoryBase::getOrCreateImpl(
     const llvm::Value *V, llvm::ArrayRef<ptrdiff_t> Offs, unsigned BOUND) {
@@ -160,6 +288,12 @@ AbstractMemoryLocationFactoryBase::getOrCreateImpl(
   if (!Mem) {
     Mem = Owner.create(V, BOUND, Offs);
     Pool.InsertNode(Mem, Pos);
+    ++NumPoolMisses;
+    if (NumCollections) {
+      YoungGeneration.push_back(Mem);
+    }
+  } else {
+    ++NumPoolHits;
   }
   return Mem;
 }
@@ -176,6 +310,7 @@ AbstractMemoryLocationFactoryBase::createImpl(const llvm::Value *V,
                                               unsigned BOUND) {
   assert(DL);
   if (auto It = Cache.find(V); It != Cache.end()) {
+    ++NumCacheHits;
     return It->second;
   }
 
@@ -468,3 +603,24 @@ AbstractMemoryLocationFactoryBase::withTransferFromImpl(
   return Ret;
 }
 } // namespace psr::detail
+
+namespace psr {
+llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                              const AbstractMemoryLocationStatistics &Stats) {
+  OS << "AbstractMemoryLocations:\n";
+  OS << "  Unique Locations:\t\t" << Stats.NumLocations << '\n';
+  OS << "  Cached Values:\t\t" << Stats.NumCachedValues << '\n';
+  OS << "  Pool Hits:\t\t\t" << Stats.NumPoolHits << '\n';
+  OS << "  Pool Misses:\t\t\t" << Stats.NumPoolMisses << '\n';
+  OS << "  Value-Cache Hits:\t\t" << Stats.NumCacheHits << '\n';
+  OS << "  Arena:\n";
+  OS << "    #Blocks:\t\t\t" << Stats.NumBlocks << '\n';
+  OS << "    Allocated Bytes:\t\t" << Stats.NumAllocatedBytes << '\n';
+  OS << "    Used Bytes:\t\t\t" << Stats.NumUsedBytes << '\n';
+  OS << "    Free Bytes:\t\t\t" << Stats.NumFreeBytes << '\n';
+  OS << "  Garbage Collection:\n";
+  OS << "    #Collections:\t\t" << Stats.NumCollections << '\n';
+  OS << "    Reclaimed Locations:\t" << Stats.NumReclaimedLocations << '\n';
+  return OS;
+}
+} // namespace psr
@@ -20,13 +20,16 @@ namespace psr::XTaint {
 EdgeDomain
 KillIfSanitizedEdgeFunction::computeTarget(ByConstRef<l_t> Source) const {
   static_assert(IsEdgeFunction<KillIfSanitizedEdgeFunction>);
-  assert(BBO != nullptr);
+  static_assert(
+      psr::EdgeFunctionBase::IsSOOCandidate<KillIfSanitizedEdgeFunction>);
+  assert(Check != nullptr && Check->BBO != nullptr);
   if (const auto *Sani = Source.getSanitizer()) {
+    const auto *Load = Check->Load;
     if (!Load) {
       return Sanitized{};
     }
     if (Sani->getFunction() == Load->getFunction() &&
-        BBO->mustComeBefore(Sani, Load)) {
+        Check->BBO->mustComeBefore(Sani, Load)) {
       return Sanitized{};
     }
 
@@ -45,7 +48,7 @@ llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
 operator==(ByConstRef<KillIfSanitizedEdgeFunction> LHS,
            ByConstRef<KillIfSanitizedEdgeFunction> RHS) noexcept {
   // Assume, the Analysis to be the same
-  return LHS.Load == RHS.Load;
+  return LHS.getLoad() == RHS.getLoad();
 }
 
 } // namespace psr::XTaint
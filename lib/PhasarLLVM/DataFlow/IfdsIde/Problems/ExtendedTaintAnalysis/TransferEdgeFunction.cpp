@@ -19,14 +19,15 @@ namespace psr::XTaint {
 
 auto TransferEdgeFunction::computeTarget(ByConstRef<l_t> Source) const -> l_t {
   static_assert(IsEdgeFunction<TransferEdgeFunction>);
-  assert(BBO != nullptr);
+  static_assert(psr::EdgeFunctionBase::IsSOOCandidate<TransferEdgeFunction>);
+  assert(Check != nullptr && Check->BBO != nullptr);
   if (const auto *Sani = Source.getSanitizer()) {
-    if (!Load || BBO->mustComeBefore(Sani, Load)) {
-      return To;
+    if (!Check->Load || Check->BBO->mustComeBefore(Sani, Check->Load)) {
+      return Check->To;
     }
   }
   if (Source.isSanitized()) {
-    return To;
+    return Check->To;
   }
 
   return nullptr;
@@ -34,12 +35,12 @@ auto TransferEdgeFunction::computeTarget(ByConstRef<l_t> Source) const -> l_t {
 
 bool operator==(const TransferEdgeFunction &LHS,
                 const TransferEdgeFunction &RHS) noexcept {
-  return LHS.To == RHS.To;
+  return LHS.Check->To == RHS.Check->To;
 }
 
 llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
                               const TransferEdgeFunction &TRE) {
-  return OS << "Transfer[To: " << llvmIRToShortString(TRE.To) << "]";
+  return OS << "Transfer[To: " << llvmIRToShortString(TRE.Check->To) << "]";
 }
 
 } // namespace psr::XTaint
@@ -14,3 +14,13 @@ auto psr::XTaint::makeComposeEF(const EdgeFunction<EdgeDomain> &F,
     -> EdgeFunction<EdgeDomain> {
   return ComposeEdgeFunction{F, G};
 }
+
+auto psr::XTaint::SanitizerCheckPool::getOrCreate(const llvm::Instruction *Load,
+                                                 const llvm::Instruction *To)
+    -> const SanitizerCheck * {
+  auto &Ret = Cache[{Load, To}];
+  if (!Ret) {
+    Ret = &Storage.emplace_back(SanitizerCheck{BBO, Load, To});
+  }
+  return Ret;
+}
@@ -642,7 +642,7 @@ auto IDEExtendedTaintAnalysis::getCallEdgeFunction(
     // Kill sanitized facts that flow into the callee.
     if (equivalent(makeFlowFact(Arg.get()), SrcNode)) {
       return KillIfSanitizedEdgeFunction{
-          {}, &BBO, getApproxLoadFrom(Arg.get())};
+          {}, SaniChecks.getOrCreate(getApproxLoadFrom(Arg.get()))};
     }
   }
 
@@ -664,12 +664,14 @@ auto IDEExtendedTaintAnalysis::getReturnEdgeFunction(
   if (const auto *Ret = llvm::dyn_cast<llvm::ReturnInst>(ExitInst);
       Ret && equivalent(RetNode, makeFlowFact(CallSite))) {
     return TransferEdgeFunction{
-        {}, &BBO, getApproxLoadFrom(Ret->getReturnValue()), CallSite};
+        {},
+        SaniChecks.getOrCreate(getApproxLoadFrom(Ret->getReturnValue()),
+                               CallSite)};
   }
   // Pointer parameters that have a sanitizer on all paths are always sanitized
   // at the return-site, no matter where the sanitizer is
   // return EdgeFunctionPtrType(new KillIfSanitizedEdgeFunction(BBO, nullptr));
-  return TransferEdgeFunction{{}, &BBO, nullptr, CallSite};
+  return TransferEdgeFunction{{}, SaniChecks.getOrCreate(nullptr, CallSite)};
 }
 
 auto IDEExtendedTaintAnalysis::getCallToRetEdgeFunction(
@@ -9,49 +9,56 @@
 
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValueSet.h"
 
+#include "llvm/ADT/STLExtras.h"
+
+#include <algorithm>
+#include <iterator>
+
 namespace psr::glca {
 
 EdgeValueSet::EdgeValueSet() : Underlying({EdgeValue(nullptr)}) {}
 
 EdgeValueSet::EdgeValueSet(std::initializer_list<EdgeValue> Ilist)
-    : Underlying(Ilist) {}
-auto EdgeValueSet::begin() -> decltype(Underlying.begin()) {
-  return Underlying.begin();
-}
-auto EdgeValueSet::end() -> decltype(Underlying.end()) {
-  return Underlying.end();
-}
-auto EdgeValueSet::begin() const -> decltype(Underlying.begin()) {
+    : EdgeValueSet(Ilist.begin(), Ilist.end()) {}
+auto EdgeValueSet::begin() -> iterator { return Underlying.begin(); }
+auto EdgeValueSet::end() -> iterator { return Underlying.end(); }
+auto EdgeValueSet::begin() const -> const_iterator {
   return Underlying.begin();
 }
-auto EdgeValueSet::end() const -> decltype(Underlying.end()) {
-  return Underlying.end();
-}
+auto EdgeValueSet::end() const -> const_iterator { return Underlying.end(); }
 int EdgeValueSet::count(const EdgeValue &Ev) const {
-  return Underlying.count(Ev);
+  return find(Ev) != end();
 }
-auto EdgeValueSet::find(const EdgeValue &Ev) -> decltype(Underlying.find(Ev)) {
-  return Underlying.find(Ev);
+auto EdgeValueSet::find(const EdgeValue &Ev) -> iterator {
+  return std::find(Underlying.begin(), Underlying.end(), Ev);
 }
-auto EdgeValueSet::find(const EdgeValue &Ev) const
-    -> decltype(Underlying.find(Ev)) {
-  return Underlying.find(Ev);
+auto EdgeValueSet::find(const EdgeValue &Ev) const -> const_iterator {
+  return std::find(Underlying.begin(), Underlying.end(), Ev);
 }
 
 size_t EdgeValueSet::size() const { return Underlying.size(); }
-auto EdgeValueSet::insert(const EdgeValue &Ev)
-    -> decltype(Underlying.insert(Ev)) {
-  return Underlying.insert(Ev);
+auto EdgeValueSet::insert(const EdgeValue &Ev) -> std::pair<iterator, bool> {
+  if (auto It = find(Ev); It != end()) {
+    return {It, false};
+  }
+  Underlying.push_back(Ev);
+  return {std::prev(Underlying.end()), true};
 }
-auto EdgeValueSet::insert(EdgeValue &&Ev) -> decltype(Underlying.insert(Ev)) {
-  return Underlying.insert(Ev);
+auto EdgeValueSet::insert(EdgeValue &&Ev) -> std::pair<iterator, bool> {
+  if (auto It = find(Ev); It != end()) {
+    return {It, false};
+  }
+  Underlying.push_back(std::move(Ev));
+  return {std::prev(Underlying.end()), true};
 }
 bool EdgeValueSet::empty() const { return Underlying.empty(); }
 bool EdgeValueSet::operator==(const EdgeValueSet &Other) const {
-  return Underlying == Other.Underlying;
+  return size() == Other.size() &&
+         llvm::all_of(Underlying,
+                      [&Other](const auto &Ev) { return Other.count(Ev); });
 }
 bool EdgeValueSet::operator!=(const EdgeValueSet &Other) const {
-  return Underlying != Other.Underlying;
+  return !(*this == Other);
 }
 
 } // namespace psr::glca
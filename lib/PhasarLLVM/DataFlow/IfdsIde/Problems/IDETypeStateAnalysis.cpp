@@ -55,7 +55,7 @@ auto IDETypeStateAnalysisBase::getNormalFlowFunction(n_t Curr, n_t /*Succ*/)
   }
   if (const auto *Gep = llvm::dyn_cast<llvm::GetElementPtrInst>(Curr)) {
     if (hasMatchingType(Gep->getPointerOperand())) {
-      return lambdaFlow([=](d_t Source) -> std::set<d_t> {
+      return lambdaFlow([=](d_t Source) -> container_type {
         // if (Source == Gep->getPointerOperand()) {
         //  return {Source, Gep};
         //}
@@ -105,7 +105,7 @@ auto IDETypeStateAnalysisBase::getCallFlowFunction(n_t CallSite, f_t DestFun)
   // Otherwise, if we have an ordinary function call, we can just use the
   // standard mapping.
   if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(CallSite)) {
-    return mapFactsToCallee(Call, DestFun);
+    return mapFactsToCallee<d_t, container_type>(Call, DestFun);
   }
   llvm::report_fatal_error("callSite not a CallInst nor a InvokeInst");
 }
@@ -48,7 +48,8 @@ IFDSTaintAnalysis::IFDSTaintAnalysis(const LLVMProjectIRDB *IRDB,
                                      bool TaintMainArgs)
     : IFDSTabulationProblem(IRDB, std::move(EntryPoints), createZeroValue()),
       Config(Config), PT(PT), TaintMainArgs(TaintMainArgs),
-      Llvmfdff(library_summary::readFromFDFF(getLibCSummary(), *IRDB)) {
+      Llvmfdff(library_summary::readFromSummaryTable(getLibCSummaryTable(),
+                                                      *IRDB)) {
   assert(Config != nullptr);
   assert(PT);
 }
@@ -189,14 +190,12 @@ static IFDSTaintAnalysis::FlowFunctionPtrType transferAndKillFlow(d_t To,
     return FlowFunctionTemplates<d_t, container_type>::transferFlow(To, From);
   }
   return FlowFunctionTemplates<d_t, container_type>::lambdaFlow(
-      [To, From](d_t Source) -> container_type {
+      [To, From](d_t Source, llvm::SmallVectorImpl<d_t> &Targets) {
         if (Source == From) {
-          return {To};
+          Targets.push_back(To);
+        } else if (Source != To) {
+          Targets.push_back(Source);
         }
-        if (Source == To) {
-          return {};
-        }
-        return {Source};
       });
 }
 
@@ -208,57 +207,47 @@ transferAndKillTwoFlows(d_t To, d_t From1, d_t From2) {
   if (KillFrom1) {
     if (KillFrom2) {
       return FlowFunctionTemplates<d_t, container_type>::lambdaFlow(
-          [To, From1, From2](d_t Source) -> container_type {
+          [To, From1, From2](d_t Source, llvm::SmallVectorImpl<d_t> &Targets) {
             if (Source == From1 || Source == From2) {
-              return {To};
-            }
-            if (Source == To) {
-              return {};
+              Targets.push_back(To);
+            } else if (Source != To) {
+              Targets.push_back(Source);
             }
-            return {Source};
           });
     }
 
     return FlowFunctionTemplates<d_t, container_type>::lambdaFlow(
-        [To, From1, From2](d_t Source) -> container_type {
+        [To, From1, From2](d_t Source, llvm::SmallVectorImpl<d_t> &Targets) {
           if (Source == From1) {
-            return {To};
-          }
-          if (Source == From2) {
-            return {Source, To};
-          }
-          if (Source == To) {
-            return {};
+            Targets.push_back(To);
+          } else if (Source == From2) {
+            Targets.append({Source, To});
+          } else if (Source != To) {
+            Targets.push_back(Source);
           }
-          return {Source};
         });
   }
 
   if (KillFrom2) {
     return FlowFunctionTemplates<d_t, container_type>::lambdaFlow(
-        [To, From1, From2](d_t Source) -> container_type {
+        [To, From1, From2](d_t Source, llvm::SmallVectorImpl<d_t> &Targets) {
           if (Source == From1) {
-            return {Source, To};
+            Targets.append({Source, To});
+          } else if (Source == From2) {
+            Targets.push_back(To);
+          } else if (Source != To) {
+            Targets.push_back(Source);
           }
-          if (Source == From2) {
-            return {To};
-          }
-          if (Source == To) {
-            return {};
-          }
-          return {Source};
         });
   }
 
   return FlowFunctionTemplates<d_t, container_type>::lambdaFlow(
-      [To, From1, From2](d_t Source) -> container_type {
+      [To, From1, From2](d_t Source, llvm::SmallVectorImpl<d_t> &Targets) {
         if (Source == From1 || Source == From2) {
-          return {Source, To};
+          Targets.append({Source, To});
+        } else if (Source != To) {
+          Targets.push_back(Source);
         }
-        if (Source == To) {
-          return {};
-        }
-        return {Source};
       });
 }
 
@@ -275,15 +264,13 @@ auto IFDSTaintAnalysis::getNormalFlowFunction(n_t Curr,
     }
 
     return lambdaFlow(
-        [Store, Gen{std::move(Gen)}](d_t Source) -> container_type {
-          if (Store->getPointerOperand() == Source) {
-            return {};
-          }
+        [Store, Gen{std::move(Gen)}](d_t Source,
+                                     llvm::SmallVectorImpl<d_t> &Targets) {
           if (Store->getValueOperand() == Source) {
-            return Gen;
+            Targets.append(Gen.begin(), Gen.end());
+          } else if (Store->getPointerOperand() != Source) {
+            Targets.push_back(Source);
           }
-
-          return {Source};
         });
   }
   // If a tainted value is loaded, the loaded value is of course tainted
@@ -326,7 +313,7 @@ auto IFDSTaintAnalysis::getCallFlowFunction(n_t CallSite, f_t DestFun)
   }
 
   // Map the actual into the formal parameters
-  return mapFactsToCallee(CS, DestFun);
+  return mapFactsToCallee<d_t, container_type>(CS, DestFun);
 }
 
 auto IFDSTaintAnalysis::getRetFlowFunction(n_t CallSite, f_t /*CalleeFun*/,
@@ -336,7 +323,7 @@ auto IFDSTaintAnalysis::getRetFlowFunction(n_t CallSite, f_t /*CalleeFun*/,
   // We must check if the return value and formal parameter are tainted, if so
   // we must taint all user's of the function call. We are only interested in
   // formal parameters of pointer/reference type.
-  return mapFactsToCaller(
+  return mapFactsToCaller<d_t, container_type>(
       llvm::cast<llvm::CallBase>(CallSite), ExitStmt,
       [](d_t Formal, d_t Source) {
         return Formal == Source && Formal->getType()->isPointerTy();
@@ -359,9 +346,10 @@ auto IFDSTaintAnalysis::getCallToRetFlowFunction(n_t CallSite,
   bool HasDeclOnly = llvm::any_of(
       Callees, [](const auto *DestFun) { return DestFun->isDeclaration(); });
 
-  return mapFactsAlongsideCallSite(CS, [HasDeclOnly](d_t Arg) {
-    return HasDeclOnly || !Arg->getType()->isPointerTy();
-  });
+  return mapFactsAlongsideCallSite<d_t, container_type>(
+      CS, [HasDeclOnly](d_t Arg) {
+        return HasDeclOnly || !Arg->getType()->isPointerTy();
+      });
 }
 
 auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
@@ -410,7 +398,7 @@ auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
       const auto &DestFunFacts = Llvmfdff.getFactsForFunction(DestFun);
       return lambdaFlow([CallSite, DestFun,
                          &DestFunFacts](d_t Source) -> container_type {
-        std::set<d_t> Facts;
+        container_type Facts;
         const auto *CS = llvm::cast<llvm::CallBase>(CallSite);
         for (const auto &[Arg, DestParam] :
              llvm::zip(CS->args(), DestFun->args())) {
@@ -439,7 +427,8 @@ auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
   if (Gen.empty()) {
     if (!Leak.empty() || !Kill.empty()) {
       return lambdaFlow([Leak{std::move(Leak)}, Kill{std::move(Kill)}, this,
-                         CallSite](d_t Source) -> container_type {
+                         CallSite](d_t Source,
+                                   llvm::SmallVectorImpl<d_t> &Targets) {
         if (Leak.count(Source)) {
           if (Leaks[CallSite].insert(Source).second) {
             Printer->onResult(CallSite, Source,
@@ -447,11 +436,9 @@ auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
           }
         }
 
-        if (Kill.count(Source)) {
-          return {};
+        if (!Kill.count(Source)) {
+          Targets.push_back(Source);
         }
-
-        return {Source};
       });
     }
 
@@ -463,9 +450,11 @@ auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
 
   Gen.insert(LLVMZeroValue::getInstance());
   return lambdaFlow([Gen{std::move(Gen)}, Leak{std::move(Leak)}, this,
-                     CallSite](d_t Source) -> container_type {
+                     CallSite](d_t Source,
+                               llvm::SmallVectorImpl<d_t> &Targets) {
     if (LLVMZeroValue::isLLVMZeroValue(Source)) {
-      return Gen;
+      Targets.append(Gen.begin(), Gen.end());
+      return;
     }
 
     if (Leak.count(Source)) {
@@ -475,7 +464,7 @@ auto IFDSTaintAnalysis::getSummaryFlowFunction([[maybe_unused]] n_t CallSite,
       }
     }
 
-    return {Source};
+    Targets.push_back(Source);
   });
 }
 
@@ -513,6 +502,17 @@ bool IFDSTaintAnalysis::isZeroValue(d_t FlowFact) const noexcept {
   return LLVMZeroValue::isLLVMZeroValue(FlowFact);
 }
 
+bool IFDSTaintAnalysis::isRelevant(n_t Inst, d_t Fact) const {
+  // The normal flow functions never generate facts from zero and only
+  // transform facts that are used by Inst. Aliases are generated at the
+  // stores that use the tainted value. Inst itself is killed when it is
+  // re-executed, e.g., in a loop.
+  if (isZeroValue(Fact)) {
+    return false;
+  }
+  return Fact == Inst || llvm::is_contained(Inst->operand_values(), Fact);
+}
+
 void IFDSTaintAnalysis::emitTextReport(
     const SolverResults<n_t, d_t, BinaryDomain> & /*SR*/,
     llvm::raw_ostream &OS) {
@@ -19,6 +19,7 @@
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/Printer.h"
 
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/IR/AbstractCallSite.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instruction.h"
@@ -394,6 +395,22 @@ bool IFDSUninitializedVariables::isZeroValue(
   return LLVMZeroValue::isLLVMZeroValue(Fact);
 }
 
+bool IFDSUninitializedVariables::isRelevant(
+    IFDSUninitializedVariables::n_t Inst,
+    IFDSUninitializedVariables::d_t Fact) const {
+  // The normal flow functions generate facts at allocas (from zero) and at
+  // uses of undef (from any fact) and only transform facts used by Inst
+  if (llvm::any_of(Inst->operand_values(), [](const llvm::Value *Op) {
+        return llvm::isa<llvm::UndefValue>(Op);
+      })) {
+    return true;
+  }
+  if (isZeroValue(Fact)) {
+    return llvm::isa<llvm::AllocaInst>(Inst);
+  }
+  return llvm::is_contained(Inst->operand_values(), Fact);
+}
+
 void IFDSUninitializedVariables::emitTextReport(
     const SolverResults<IFDSUninitializedVariables::n_t,
                         IFDSUninitializedVariables::d_t, l_t> & /*Result*/,
@@ -3,9 +3,13 @@
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Demangle/Demangle.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <string>
 
 namespace psr {
 LLVMPathConstraints::LLVMPathConstraints(z3::context *Z3Ctx,
@@ -47,7 +51,7 @@ auto LLVMPathConstraints::internalGetConstraintAndVariablesFromEdge(
 std::optional<z3::expr>
 LLVMPathConstraints::getConstraintFromEdge(const llvm::Instruction *Curr,
                                            const llvm::Instruction *Succ) {
-  if (auto CV = internalGetConstraintAndVariablesFromEdge(Curr, Succ)) {
+  if (auto CV = getConstraintAndVariablesFromEdge(Curr, Succ)) {
     return CV->Constraint;
   }
 
@@ -57,15 +61,118 @@ LLVMPathConstraints::getConstraintFromEdge(const llvm::Instruction *Curr,
 auto LLVMPathConstraints::getConstraintAndVariablesFromEdge(
     const llvm::Instruction *Curr, const llvm::Instruction *Succ)
     -> std::optional<ConstraintAndVariables> {
+  ++Stats.NumEdgeQueries;
+  auto [It, Inserted] = EdgeConstraints.try_emplace({Curr, Succ});
+  if (!Inserted) {
+    ++Stats.NumEdgeCacheHits;
+    return It->second;
+  }
+
   auto CV = internalGetConstraintAndVariablesFromEdge(Curr, Succ);
   if (CV) {
     /// Deduplicate the Variables vector
     std::sort(CV->Variables.begin(), CV->Variables.end());
     CV->Variables.erase(std::unique(CV->Variables.begin(), CV->Variables.end()),
                         CV->Variables.end());
+    CV->Constraint = internFragment(CV->Constraint);
+  }
+
+  It->second = std::move(CV);
+  return It->second;
+}
+
+z3::expr LLVMPathConstraints::internFragment(const z3::expr &E) {
+  // Z3 already hash-conses the ASTs within a context, so the AST id
+  // identifies the fragment structurally.
+  auto [It, Inserted] = Fragments.try_emplace(E.id(), E);
+  if (Inserted) {
+    ++Stats.NumFragments;
+  } else {
+    ++Stats.NumFragmentHits;
+  }
+  return It->second;
+}
+
+z3::expr LLVMPathConstraints::getTrackingLiteral(const z3::expr &Fragment) {
+  auto It = TrackingLiterals.find(Fragment.id());
+  if (It != TrackingLiterals.end()) {
+    return It->second;
+  }
+
+  auto Lit = Z3Ctx->bool_const(
+      ("psr.core." + std::to_string(Fragment.id())).c_str());
+  FragmentOfLiteral.try_emplace(Lit.id(), Fragment.id());
+  return TrackingLiterals.try_emplace(Fragment.id(), std::move(Lit))
+      .first->second;
+}
+
+void LLVMPathConstraints::recordInfeasible(const z3::expr_vector &Core) {
+  llvm::SmallVector<unsigned, 4> CoreIds;
+  CoreIds.reserve(Core.size());
+  for (const auto &Lit : Core) {
+    auto It = FragmentOfLiteral.find(Lit.id());
+    assert(It != FragmentOfLiteral.end() &&
+           "The core must only consist of tracking literals");
+    CoreIds.push_back(It->second);
+  }
+  if (CoreIds.empty()) {
+    return;
   }
+  std::sort(CoreIds.begin(), CoreIds.end());
+  CoreIds.erase(std::unique(CoreIds.begin(), CoreIds.end()), CoreIds.end());
+
+  unsigned CoreIdx = InfeasibleCores.size();
+  for (auto Id : CoreIds) {
+    CoresByFragment[Id].push_back(CoreIdx);
+  }
+  InfeasibleCores.push_back(std::move(CoreIds));
+  ++Stats.NumInfeasibleCores;
+}
+
+bool LLVMPathConstraints::isKnownInfeasible(
+    const z3::expr &NewFragment, llvm::function_ref<bool(unsigned)> IsOnPath) {
+  auto It = CoresByFragment.find(NewFragment.id());
+  if (It == CoresByFragment.end()) {
+    return false;
+  }
+
+  for (auto CoreIdx : It->second) {
+    if (llvm::all_of(InfeasibleCores[CoreIdx], IsOnPath)) {
+      ++Stats.NumPrunedByCore;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::optional<bool>
+LLVMPathConstraints::getCachedVerdict(const z3::expr &Query) {
+  auto It = Verdicts.find(Query.id());
+  if (It == Verdicts.end()) {
+    return std::nullopt;
+  }
+  ++Stats.NumVerdictCacheHits;
+  return It->second.second;
+}
+
+void LLVMPathConstraints::cacheVerdict(const z3::expr &Query, bool Sat) {
+  if (Verdicts.size() >= MaxNumCachedVerdicts) {
+    Verdicts.clear();
+  }
+  Verdicts.try_emplace(Query.id(), Query, Sat);
+}
 
-  return CV;
+llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                              const LLVMPathConstraints::CacheStatistics &S) {
+  OS << "LLVMPathConstraints Cache:\n";
+  OS << "  Edge Queries:\t\t" << S.NumEdgeQueries << '\n';
+  OS << "  Edge Cache Hits:\t" << S.NumEdgeCacheHits << '\n';
+  OS << "  Fragments:\t\t" << S.NumFragments << '\n';
+  OS << "  Fragment Hits:\t" << S.NumFragmentHits << '\n';
+  OS << "  Unsat-Cores:\t\t" << S.NumInfeasibleCores << '\n';
+  OS << "  Pruned by Core:\t" << S.NumPrunedByCore << '\n';
+  OS << "  Verdict Cache Hits:\t" << S.NumVerdictCacheHits << '\n';
+  return OS;
 }
 
 // void LLVMPathConstraints::getConstraintsInPath(
@@ -3,124 +3,305 @@
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
 
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
 
 namespace psr {
+static bool isSatisfiable(z3::solver &Solver, const z3::expr &Query) {
+  Solver.push();
+  Solver.add(Query);
+  auto Res = Solver.check();
+  Solver.pop();
+  return Res != z3::check_result::unsat;
+}
+
+/// Checks the satisfiability of batches of queries that live in the main Z3
+/// context. Each worker owns a separate Z3 context and solver; the queries are
+/// translated into the worker's context before checking. Z3 contexts are not
+/// thread-safe, so all accesses to the main context from the workers are
+/// serialized.
+class Z3BasedPathSensitivityManagerBase::SolverThreads {
+public:
+  explicit SolverThreads(unsigned NumThreads)
+      : Pool(llvm::hardware_concurrency(NumThreads)) {
+    Workers.reserve(NumThreads);
+    for (unsigned I = 0; I < NumThreads; ++I) {
+      Workers.emplace_back(std::make_unique<Worker>());
+    }
+  }
+
+  [[nodiscard]] size_t getNumThreads() const noexcept {
+    return Workers.size();
+  }
+
+  /// Sets Sat[I] to false, iff Queries[I] is definitely unsatisfiable
+  void checkAll(llvm::ArrayRef<z3::expr> Queries,
+                llvm::MutableArrayRef<bool> Sat) {
+    assert(Queries.size() == Sat.size());
+
+    std::mutex MainCtxMtx;
+    size_t NumWorkers = std::min(Workers.size(), Queries.size());
+    for (size_t WorkerIdx = 0; WorkerIdx != NumWorkers; ++WorkerIdx) {
+      Pool.async([this, &MainCtxMtx, WorkerIdx, NumWorkers, Queries, Sat] {
+        auto &W = *Workers[WorkerIdx];
+        for (size_t I = WorkerIdx, End = Queries.size(); I < End;
+             I += NumWorkers) {
+          auto Query = [&] {
+            std::lock_guard Lck(MainCtxMtx);
+            return W.translate(Queries[I]);
+          }();
+          Sat[I] = isSatisfiable(W.Solver, Query);
+        }
+      });
+    }
+    Pool.wait();
+  }
+
+private:
+  struct Worker {
+    z3::context Ctx;
+    z3::solver Solver{Ctx};
+
+    [[nodiscard]] z3::expr translate(const z3::expr &E) {
+      return z3::expr(Ctx, Z3_translate(E.ctx(), E, Ctx));
+    }
+  };
+
+  llvm::SmallVector<std::unique_ptr<Worker>, 0> Workers;
+  /// Declared after the Workers, such that all threads are joined before the
+  /// workers' contexts are destroyed
+  llvm::ThreadPool Pool;
+};
+
+Z3BasedPathSensitivityManagerBase::Z3BasedPathSensitivityManagerBase() =
+    default;
+Z3BasedPathSensitivityManagerBase::~Z3BasedPathSensitivityManagerBase() =
+    default;
+Z3BasedPathSensitivityManagerBase::Z3BasedPathSensitivityManagerBase(
+    Z3BasedPathSensitivityManagerBase &&) noexcept = default;
+Z3BasedPathSensitivityManagerBase &
+Z3BasedPathSensitivityManagerBase::operator=(
+    Z3BasedPathSensitivityManagerBase &&) noexcept = default;
+
 z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
     graph_type &RevDAG, vertex_t Leaf,
     const Z3BasedPathSensitivityConfig &Config,
     LLVMPathConstraints &LPC) const {
+  auto &Z3Ctx = LPC.getContext();
 
-  struct FilterContext {
-    llvm::BitVector Visited{};
-    z3::expr True;
-    z3::expr False;
-    llvm::SmallVector<z3::expr, 0> NodeConstraints{};
-    size_t Ctr = 0;
-    z3::solver Solver;
+  const auto True = Z3Ctx.bool_val(true);
+  const auto False = Z3Ctx.bool_val(false);
+  auto NumVertices = graph_traits_t::size(RevDAG);
 
-    explicit FilterContext(z3::context &Z3Ctx)
-        : True(Z3Ctx.bool_val(true)), False(Z3Ctx.bool_val(false)),
-          Solver(Z3Ctx) {}
-  } Ctx(LPC.getContext());
-
-  Ctx.Visited.resize(graph_traits_t::size(RevDAG));
-  Ctx.NodeConstraints.resize(graph_traits_t::size(RevDAG), Ctx.True);
+  llvm::SmallVector<z3::expr, 0> NodeConstraints(NumVertices, True);
 
   size_t TotalNumEdges = 0;
   for (auto I : graph_traits_t::vertices(RevDAG)) {
     TotalNumEdges += graph_traits_t::outDegree(RevDAG, I);
   }
 
-  if (Config.AdditionalConstraint) {
-    Ctx.Solver.add(*Config.AdditionalConstraint);
-  }
-
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  auto doFilter = [&Ctx, &RevDAG, &LPC, Leaf](auto &doFilter,
-                                              vertex_t Vtx) -> z3::expr {
-    Ctx.Visited.set(Vtx);
-    z3::expr X = Ctx.True;
-    llvm::ArrayRef<n_t> PartialPath = graph_traits_t::node(RevDAG, Vtx);
-    assert(!PartialPath.empty());
+  // Group the vertices reachable from the roots by their height in the DAG.
+  // A vertex only depends on its successors, which all have a smaller height,
+  // so all vertices of the same height can be checked independently.
+  // Use an explicit stack, as the DAGs may get very deep.
+  llvm::SmallVector<uint32_t, 0> Height(NumVertices, 0);
+  llvm::SmallVector<llvm::SmallVector<vertex_t, 0>, 0> ByHeight;
+  {
+    llvm::BitVector Visited(NumVertices);
+    llvm::SmallVector<std::pair<vertex_t, size_t>, 0> Stack;
+    for (auto Rt : graph_traits_t::roots(RevDAG)) {
+      if (Visited.test(Rt)) {
+        continue;
+      }
+      Visited.set(Rt);
+      Stack.emplace_back(Rt, 0);
+
+      while (!Stack.empty()) {
+        auto &[Vtx, NextEdge] = Stack.back();
+        auto Edges = graph_traits_t::outEdges(RevDAG, Vtx);
+        if (NextEdge != Edges.size()) {
+          auto Adj = graph_traits_t::target(Edges[NextEdge++]);
+          if (!Visited.test(Adj)) {
+            Visited.set(Adj);
+            Stack.emplace_back(Adj, 0);
+          }
+          continue;
+        }
 
-    for (size_t I = PartialPath.size() - 1; I; --I) {
-      if (auto Constr =
-              LPC.getConstraintFromEdge(PartialPath[I], PartialPath[I - 1])) {
-        X = X && *Constr;
+        uint32_t H = 0;
+        for (auto Edge : Edges) {
+          H = std::max(H, Height[graph_traits_t::target(Edge)] + 1);
+        }
+        Height[Vtx] = H;
+        if (ByHeight.size() <= H) {
+          ByHeight.resize(H + 1);
+        }
+        ByHeight[H].push_back(Vtx);
+        Stack.pop_back();
       }
     }
+  }
 
-    llvm::SmallVector<z3::expr> Ys;
+  z3::solver Solver(Z3Ctx);
+  SolverThreads *Parallel = nullptr;
+  if (Config.NumSolverThreads > 1) {
+    if (!Threads || Threads->getNumThreads() != Config.NumSolverThreads) {
+      Threads = std::make_unique<SolverThreads>(Config.NumSolverThreads);
+    }
+    Parallel = Threads.get();
+  }
 
-    for (auto Iter = graph_traits_t::outEdges(RevDAG, Vtx).begin();
-         Iter != graph_traits_t::outEdges(RevDAG, Vtx).end();) {
-      // NOLINTNEXTLINE(readability-qualified-auto, llvm-qualified-auto)
-      auto It = Iter++;
-      auto Edge = *It;
-      auto Adj = graph_traits_t::target(Edge);
-      if (!Ctx.Visited.test(Adj)) {
-        doFilter(doFilter, Adj);
-      }
-      Ctx.Solver.push();
-      Ctx.Solver.add(X);
-      auto Y = Ctx.NodeConstraints[Adj];
-      const auto &AdjPP = graph_traits_t::node(RevDAG, Adj);
-      assert(!AdjPP.empty());
-      if (auto Constr =
-              LPC.getConstraintFromEdge(PartialPath.front(), AdjPP.back())) {
-        Y = Y && *Constr;
+  struct PendingEdge {
+    vertex_t Vtx;
+    vertex_t Adj;
+    z3::expr Y;
+    z3::expr Query;
+    bool Sat;
+  };
+  llvm::SmallVector<PendingEdge, 0> Pending;
+  llvm::SmallVector<z3::expr, 0> Queries;
+  llvm::SmallVector<size_t, 0> QueryToPending;
+  llvm::SmallVector<z3::expr, 0> Xs;
+  size_t NumRemovedEdges = 0;
+  size_t NumMemoHits = 0;
+
+  for (const auto &Level : ByHeight) {
+    Pending.clear();
+    Queries.clear();
+    QueryToPending.clear();
+    Xs.clear();
+
+    for (auto Vtx : Level) {
+      z3::expr X = True;
+      llvm::ArrayRef<n_t> PartialPath = graph_traits_t::node(RevDAG, Vtx);
+      assert(!PartialPath.empty());
+
+      for (size_t I = PartialPath.size() - 1; I; --I) {
+        if (auto Constr =
+                LPC.getConstraintFromEdge(PartialPath[I], PartialPath[I - 1])) {
+          X = X && *Constr;
+        }
       }
 
-      Ctx.Solver.add(Y);
+      for (auto Edge : graph_traits_t::outEdges(RevDAG, Vtx)) {
+        auto Adj = graph_traits_t::target(Edge);
+        auto Y = NodeConstraints[Adj];
+        const auto &AdjPP = graph_traits_t::node(RevDAG, Adj);
+        assert(!AdjPP.empty());
+        if (auto Constr =
+                LPC.getConstraintFromEdge(PartialPath.front(), AdjPP.back())) {
+          Y = Y && *Constr;
+        }
 
-      auto Sat = Ctx.Solver.check();
-      if (Sat == z3::check_result::unsat) {
-        Iter = graph_traits_t::removeEdge(RevDAG, Vtx, It);
-        Ctx.Ctr++;
-      } else {
-        Ys.push_back(std::move(Y));
+        // The verdicts are cached in the LPC, which may be shared with other
+        // configurations, so the query must contain the additional constraint
+        auto Query = Config.AdditionalConstraint
+                         ? X && Y && *Config.AdditionalConstraint
+                         : X && Y;
+        bool Sat = true;
+        if (auto Verdict = LPC.getCachedVerdict(Query)) {
+          Sat = *Verdict;
+          ++NumMemoHits;
+        } else {
+          Queries.push_back(Query);
+          QueryToPending.push_back(Pending.size());
+        }
+        Pending.push_back({Vtx, Adj, std::move(Y), std::move(Query), Sat});
       }
 
-      Ctx.Solver.pop();
-      // Idx++;
+      Xs.push_back(std::move(X));
     }
 
-    if (graph_traits_t::outDegree(RevDAG, Vtx) == 0) {
-      return Ctx.NodeConstraints[Vtx] = Vtx == Leaf ? X : Ctx.False;
+    llvm::SmallVector<bool, 0> Sat(Queries.size(), true);
+    if (Parallel && Queries.size() > 1) {
+      Parallel->checkAll(Queries, Sat);
+    } else {
+      for (size_t I = 0, End = Queries.size(); I != End; ++I) {
+        Sat[I] = isSatisfiable(Solver, Queries[I]);
+      }
     }
-    if (Ys.empty()) {
-      llvm_unreachable("Adj nonempty and Ys empty is unexpected");
+    for (size_t I = 0, End = Queries.size(); I != End; ++I) {
+      auto &PE = Pending[QueryToPending[I]];
+      PE.Sat = Sat[I];
+      LPC.cacheVerdict(PE.Query, Sat[I]);
     }
-    auto Y = Ys[0];
-    for (const auto &Constr : llvm::makeArrayRef(Ys).drop_front()) {
-      Y = Y || Constr;
+
+    // Now, apply the verdicts in the same order as the sequential traversal
+    llvm::ArrayRef<PendingEdge> RemainingPending = Pending;
+    for (size_t VtxIdx = 0, End = Level.size(); VtxIdx != End; ++VtxIdx) {
+      auto Vtx = Level[VtxIdx];
+      const auto *EdgesEnd =
+          llvm::find_if(RemainingPending,
+                        [Vtx](const PendingEdge &PE) { return PE.Vtx != Vtx; });
+      size_t NumEdgesOfVtx = EdgesEnd - RemainingPending.begin();
+      auto EdgesOfVtx = RemainingPending.take_front(NumEdgesOfVtx);
+      RemainingPending = RemainingPending.drop_front(NumEdgesOfVtx);
+
+      auto getVerdict = [EdgesOfVtx](vertex_t Adj) -> const PendingEdge & {
+        return *llvm::find_if(
+            EdgesOfVtx, [Adj](const PendingEdge &PE) { return PE.Adj == Adj; });
+      };
+
+      llvm::SmallVector<z3::expr> Ys;
+      for (auto Iter = graph_traits_t::outEdges(RevDAG, Vtx).begin();
+           Iter != graph_traits_t::outEdges(RevDAG, Vtx).end();) {
+        // NOLINTNEXTLINE(readability-qualified-auto, llvm-qualified-auto)
+        auto It = Iter++;
+        const auto &PE = getVerdict(graph_traits_t::target(*It));
+        if (!PE.Sat) {
+          Iter = graph_traits_t::removeEdge(RevDAG, Vtx, It);
+          ++NumRemovedEdges;
+        } else {
+          Ys.push_back(PE.Y);
+        }
+      }
+
+      const auto &X = Xs[VtxIdx];
+      if (graph_traits_t::outDegree(RevDAG, Vtx) == 0) {
+        NodeConstraints[Vtx] = Vtx == Leaf ? X : False;
+        continue;
+      }
+      if (Ys.empty()) {
+        llvm_unreachable("Adj nonempty and Ys empty is unexpected");
+      }
+      auto Y = Ys[0];
+      for (const auto &Constr : llvm::makeArrayRef(Ys).drop_front()) {
+        Y = Y || Constr;
+      }
+      NodeConstraints[Vtx] = (X && Y).simplify();
     }
-    return Ctx.NodeConstraints[Vtx] = (X && Y).simplify();
-  };
+  }
 
-  z3::expr Ret = LPC.getContext().bool_val(false);
+  z3::expr Ret = False;
 
   for (auto Iter = graph_traits_t::roots(RevDAG).begin();
        Iter != graph_traits_t::roots(RevDAG).end();) {
     // NOLINTNEXTLINE(readability-qualified-auto, llvm-qualified-auto)
     auto It = Iter++;
     auto Rt = *It;
-    auto Res = doFilter(doFilter, Rt);
-    Ret = Ret || Res;
+    Ret = Ret || NodeConstraints[Rt];
     if (Rt != Leaf && RevDAG.Adj[Rt].empty()) {
-      // llvm::errs() << "> Remove root " << Rt << "\n";
       Iter = graph_traits_t::removeRoot(RevDAG, It);
     }
   }
 
   PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager",
-                       "> Filtered out " << Ctx.Ctr << " edges from the DAG");
+                       "> Filtered out " << NumRemovedEdges
+                                         << " edges from the DAG");
   PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager",
-                       ">> " << (TotalNumEdges - Ctx.Ctr)
+                       ">> " << (TotalNumEdges - NumRemovedEdges)
                              << " edges remaining");
+  PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager",
+                       ">> " << NumMemoHits << " verdicts from the memo table");
 
   return Ret.simplify();
 }
@@ -324,13 +505,17 @@ public:
                        const z3::expr &AdditionalConstraint,
                        size_t *CompletedCtr) noexcept
       : LPC(LPC), Solver(LPC.getContext()), CompletedCtr(*CompletedCtr) {
-    Solver.add(AdditionalConstraint);
+    // The additional constraint is part of the unsat-cores as well, as the
+    // LPC may be shared with other configurations
+    pushFragment(LPC.internFragment(AdditionalConstraint));
     Solver.push();
     NumAtomsStack.push_back(0);
+    NumFragmentsStack.push_back(PathFragments.size());
   }
 
   void saveState() {
     NumAtomsStack.push_back(NumAtomsStack.back());
+    NumFragmentsStack.push_back(PathFragments.size());
     Solver.push();
   }
 
@@ -342,6 +527,16 @@ public:
     for (size_t I = 0; I < Diff; ++I) {
       SymbolicAtoms.pop_back();
     }
+    auto NumFragments = NumFragmentsStack.pop_back_val();
+    while (PathFragments.size() > NumFragments) {
+      PathLiterals.pop_back();
+      auto It = FragmentsOnPath.find(PathFragments.pop_back_val().id());
+      assert(It != FragmentsOnPath.end());
+      if (--It->second == 0) {
+        FragmentsOnPath.erase(It);
+      }
+    }
+    KnownInfeasible = false;
     NeedSolverInvocation = false;
     LocalAtoms.clear();
     Model = std::nullopt;
@@ -352,14 +547,26 @@ public:
     if (auto ConstrAndVariables =
             LPC.getConstraintAndVariablesFromEdge(Prev, Inst)) {
 
-      Solver.add(ConstrAndVariables->Constraint);
+      pushFragment(ConstrAndVariables->Constraint);
 
       LocalAtoms.append(ConstrAndVariables->Variables);
+
+      KnownInfeasible =
+          KnownInfeasible ||
+          LPC.isKnownInfeasible(ConstrAndVariables->Constraint,
+                                [this](unsigned Id) {
+                                  return FragmentsOnPath.count(Id);
+                                });
     }
   }
 
   [[nodiscard]] bool isValid() {
     ++IsValidCalls;
+    if (KnownInfeasible) {
+      // A previously recorded unsat-core is part of this path
+      ++RejectedCtr;
+      return false;
+    }
     if (LocalAtoms.empty() && !NeedSolverInvocation) {
       /// Nothing (new) to check
       return true;
@@ -371,7 +578,13 @@ public:
 
     NeedSolverInvocation = false;
 
-    auto Res = Solver.check();
+    // Check under the tracking literals of the fragments, such that an
+    // unsat-core is available without solving the path a second time
+    z3::expr_vector Assumptions(LPC.getContext());
+    for (const auto &Lit : PathLiterals) {
+      Assumptions.push_back(Lit);
+    }
+    auto Res = Solver.check(Assumptions);
     ++Ctr;
 #ifdef DYNAMIC_LOG
     if (Ctr % 10000 == 0) {
@@ -389,8 +602,9 @@ public:
     auto Ret = Res != z3::check_result::unsat;
     if (!Ret) {
       ++RejectedCtr;
+      LPC.recordInfeasible(Solver.unsat_core());
     } else {
-      Model = Solver.get_model();
+      Model = withoutTrackingLiterals(Solver.get_model());
     }
 
     return Ret;
@@ -403,14 +617,10 @@ public:
   }
 
   z3::expr getPathConstraints() {
-    auto Vec = Solver.assertions();
-    if (Vec.empty()) {
-      return LPC.getContext().bool_val(true);
-    }
-
-    auto Ret = Vec[0];
-    for (int I = 1, End = int(Vec.size()); I != End; ++I) {
-      Ret = Ret && Vec[I];
+    // The solver only knows the fragments guarded by their tracking literals
+    auto Ret = PathFragments.front();
+    for (const auto &Fragment : llvm::drop_begin(PathFragments)) {
+      Ret = Ret && Fragment;
     }
     return Ret.simplify();
   }
@@ -439,13 +649,45 @@ private:
     return NewSize - OldSize != NumLocalAtoms;
   }
 
+  /// The tracking literals are an implementation detail of the filter, so
+  /// hide them from the model that is reported with the path. The
+  /// LLVMPathConstraints only create constants, no functions.
+  [[nodiscard]] z3::model withoutTrackingLiterals(const z3::model &M) const {
+    assert(M.num_funcs() == 0);
+    z3::model Ret(LPC.getContext());
+    for (unsigned I = 0, End = M.num_consts(); I != End; ++I) {
+      auto Decl = M.get_const_decl(I);
+      if (LPC.isTrackingLiteral(Decl())) {
+        continue;
+      }
+      auto Val = M.get_const_interp(Decl);
+      Ret.add_const_interp(Decl, Val);
+    }
+    return Ret;
+  }
+
+  void pushFragment(z3::expr Fragment) {
+    ++FragmentsOnPath[Fragment.id()];
+    auto Lit = LPC.getTrackingLiteral(Fragment);
+    Solver.add(z3::implies(Lit, Fragment));
+    PathLiterals.push_back(std::move(Lit));
+    PathFragments.push_back(std::move(Fragment));
+  }
+
   LLVMPathConstraints &LPC;
   z3::solver Solver;
   llvm::SmallSetVector<const llvm::Value *, 8> SymbolicAtoms;
   llvm::SmallVector<unsigned> NumAtomsStack;
   llvm::SmallVector<const llvm::Value *> LocalAtoms;
   std::optional<z3::model> Model;
+  /// The interned constraint fragments on the current path
+  llvm::SmallVector<z3::expr, 0> PathFragments;
+  /// The tracking literals of the PathFragments
+  llvm::SmallVector<z3::expr, 0> PathLiterals;
+  llvm::SmallDenseMap<unsigned, unsigned> FragmentsOnPath;
+  llvm::SmallVector<size_t> NumFragmentsStack;
   bool NeedSolverInvocation = false;
+  bool KnownInfeasible = false;
 
   size_t Ctr = 0;
   size_t RejectedCtr = 0;
@@ -491,20 +733,23 @@ auto Z3BasedPathSensitivityManagerBase::filterAndFlattenRevDag(
 
   n_t Prev = nullptr;
 
-  auto doFilter = [FinalInst, &Prev, &Filters, &RevDAG, &CurrPath, &Ret,
-                   &CompletedCtr, MaxNumPaths{Config.NumPathsThreshold},
-                   Leaf](auto &doFilter, vertex_t Vtx) {
-    auto CurrPathSave = CurrPath.size();
-    scope_exit RestoreCurrPath = [&CurrPath, CurrPathSave] {
-      assert(CurrPathSave <= CurrPath.size());
-      CurrPath.resize(CurrPathSave);
-    };
-
-    const auto *PrevSave = Prev;
-    scope_exit RestorePrev = [PrevSave, &Prev] { Prev = PrevSave; };
-
+  /// Use an explicit stack instead of recursion, as the DAGs may get very
+  /// deep.
+  struct Frame {
+    vertex_t Vtx;
+    size_t CurrPathSave;
+    n_t PrevSave;
+    size_t NextEdge;
+  };
+  llvm::SmallVector<Frame, 0> Stack;
+
+  /// Pushes a new frame for Vtx and returns whether its successors should be
+  /// visited
+  auto enter = [FinalInst, &Prev, &Filters, &RevDAG, &CurrPath, &Ret,
+                &CompletedCtr, &Stack, MaxNumPaths{Config.NumPathsThreshold},
+                Leaf](vertex_t Vtx) {
+    Stack.push_back({Vtx, CurrPath.size(), Prev, 0});
     Filters.saveState();
-    scope_exit RestoreFilters = [&Filters] { Filters.restoreState(); };
 
     for (const auto *Inst : llvm::reverse(graph_traits_t::node(RevDAG, Vtx))) {
       CurrPath.push_back(Inst);
@@ -519,8 +764,6 @@ auto Z3BasedPathSensitivityManagerBase::filterAndFlattenRevDag(
     }
 
     if (Vtx == Leaf) {
-      // llvm::errs() << "> Reached Leaf!\n";
-
       assert(!CurrPath.empty() && "Reported paths must not be empty!");
 
       /// Reached the end
@@ -533,32 +776,51 @@ auto Z3BasedPathSensitivityManagerBase::filterAndFlattenRevDag(
         ++CompletedCtr;
       }
 
-      return;
+      return false;
     }
     if (graph_traits_t::outDegree(RevDAG, Vtx) == 0) {
       llvm::report_fatal_error("Non-leaf node has no successors!");
     }
 
     if (CompletedCtr >= MaxNumPaths) {
-      return;
-    }
-    if (!Filters.isValid()) {
-      return;
-    }
-    /// TODO: Verify that we have no concurrent modification here and the
-    /// iterator is never dangling!
-    for (auto Edge : graph_traits_t::outEdges(RevDAG, Vtx)) {
-      doFilter(doFilter, graph_traits_t::target(Edge));
+      return false;
     }
+    return Filters.isValid();
+  };
+
+  auto leave = [&Filters, &CurrPath, &Prev, &Stack] {
+    auto Top = Stack.pop_back_val();
+    Filters.restoreState();
+    Prev = Top.PrevSave;
+    assert(Top.CurrPathSave <= CurrPath.size());
+    CurrPath.resize(Top.CurrPathSave);
   };
 
   for (auto Rt : graph_traits_t::roots(RevDAG)) {
-    doFilter(doFilter, Rt);
+    if (!enter(Rt)) {
+      leave();
+      continue;
+    }
+
+    while (!Stack.empty()) {
+      auto &Top = Stack.back();
+      auto Edges = graph_traits_t::outEdges(RevDAG, Top.Vtx);
+      if (Top.NextEdge == Edges.size()) {
+        leave();
+        continue;
+      }
+
+      auto Adj = graph_traits_t::target(Edges[Top.NextEdge++]);
+      if (!enter(Adj)) {
+        leave();
+      }
+    }
   }
 
   PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager",
                        "Num Solver invocations: "
                            << std::get<1>(Filters).getNumSolverInvocations());
+  PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager", LPC.getStatistics());
 
   return Ret;
 }
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace psr {
 HelperAnalyses::HelperAnalyses(std::string IRFile,
@@ -111,4 +112,12 @@ LLVMBasedCFG &HelperAnalyses::getCFG() {
   return *CFG;
 }
 
+void HelperAnalyses::freeze() {
+  auto &IRDB = getProjectIRDB();
+  std::ignore = getTypeHierarchy();
+  std::ignore = getICFG();
+  std::ignore = getCFG();
+  getAliasInfo().freeze(&IRDB);
+}
+
 } // namespace psr
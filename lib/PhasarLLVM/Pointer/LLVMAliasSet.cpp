@@ -46,6 +46,8 @@
 #include <iomanip>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -556,10 +558,10 @@ AliasResult LLVMAliasSet::alias(const llvm::Value *V1, const llvm::Value *V2,
   if (!isInterestingPointer(V1) || !isInterestingPointer(V2)) {
     return AliasResult::NoAlias;
   }
-  computeValuesAliasSet(V1);
-  computeValuesAliasSet(V2);
-  return AliasSets[V1]->count(V2) ? AliasResult::MayAlias
-                                  : AliasResult::NoAlias;
+  // Computing V2's alias set may extend the one of V1
+  std::ignore = getOrComputeAliasSet(V2);
+  return getOrComputeAliasSet(V1)->count(V2) ? AliasResult::MayAlias
+                                             : AliasResult::NoAlias;
 }
 
 auto LLVMAliasSet::getEmptyAliasSet() -> BoxedPtr<AliasSetTy> {
@@ -577,11 +579,31 @@ auto LLVMAliasSet::getAliasSet(const llvm::Value *V,
     return getEmptyAliasSet();
   }
   // compute V's points-to set
-  computeValuesAliasSet(V);
-  if (auto It = AliasSets.find(V); It != AliasSets.end()) {
-    return It->second;
+  return getOrComputeAliasSet(V);
+}
+
+auto LLVMAliasSet::getOrComputeAliasSet(const llvm::Value *V)
+    -> BoxedPtr<AliasSetTy> {
+  if (!Frozen) {
+    computeValuesAliasSet(V);
+    return AliasSets[V];
+  }
+
+  {
+    std::shared_lock Lck(FrozenMtx);
+    if (auto It = AliasSets.find(V); It != AliasSets.end()) {
+      return It->second;
+    }
+  }
+
+  // All functions and globals are analyzed, so V cannot alias anything else.
+  // Only add a fresh singleton set and never touch the sets that other threads
+  // may be reading
+  std::lock_guard Lck(FrozenMtx);
+  if (isInterestingPointer(V)) {
+    addSingletonAliasSet(V);
+    return AliasSets[V];
   }
-  // if we still can't find its value return an empty set
   return getEmptyAliasSet();
 }
 
@@ -595,9 +617,7 @@ auto LLVMAliasSet::getReachableAllocationSites(
   if (!isInterestingPointer(V)) {
     return AllocSites;
   }
-  computeValuesAliasSet(V);
-
-  const auto PTS = AliasSets[V];
+  const auto PTS = getOrComputeAliasSet(V);
   // consider the full inter-procedural points-to/alias information
   if (!IntraProcOnly) {
     for (const auto *P : *PTS) {
@@ -629,7 +649,7 @@ bool LLVMAliasSet::isInReachableAllocationSites(
   if (!isInterestingPointer(V)) {
     return false;
   }
-  computeValuesAliasSet(V);
+  const auto PTS = getOrComputeAliasSet(V);
 
   bool PVIsReachableAllocationSiteType = false;
   if (IntraProcOnly) {
@@ -643,14 +663,32 @@ bool LLVMAliasSet::isInReachableAllocationSites(
   }
 
   if (PVIsReachableAllocationSiteType) {
-    const auto PTS = AliasSets[V];
     return PTS->count(PotentialValue);
   }
 
   return false;
 }
 
+void LLVMAliasSet::freeze(LLVMProjectIRDB *IRDB) {
+  assert(IRDB != nullptr);
+  if (Frozen) {
+    return;
+  }
+
+  for (auto &F : *IRDB->getModule()) {
+    if (!F.isDeclaration()) {
+      computeFunctionsAliasSet(&F);
+    }
+  }
+  // The alias sets of globals are extended by their users lazily
+  for (const auto &G : IRDB->getModule()->global_objects()) {
+    computeValuesAliasSet(&G);
+  }
+  Frozen = true;
+}
+
 void LLVMAliasSet::mergeWith(const LLVMAliasSet &OtherPTI) {
+  assert(!Frozen && "Cannot modify frozen alias information");
 
   // merge analyzed functions
   AnalyzedFunctions.insert(OtherPTI.AnalyzedFunctions.begin(),
@@ -689,6 +727,7 @@ void LLVMAliasSet::introduceAlias(const llvm::Value *V1, const llvm::Value *V2,
   if (!isInterestingPointer(V1) || !isInterestingPointer(V2)) {
     return;
   }
+  assert(!Frozen && "Cannot modify frozen alias information");
   // before introducing additional aliases make sure we initially computed
   // the aliases for V1 and V2
   computeValuesAliasSet(V1);
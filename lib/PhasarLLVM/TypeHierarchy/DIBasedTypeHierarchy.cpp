@@ -18,6 +18,7 @@
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallBitVector.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/Demangle/Demangle.h"
@@ -31,6 +32,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <string>
@@ -91,16 +93,11 @@ buildVTables(const llvm::DebugInfoFinder &DIF,
   return VT;
 }
 
-struct TypeGraph {
-  llvm::SmallBitVector Roots;
-  llvm::SmallVector<llvm::SmallVector<uint32_t>> DerivedTypesOf;
-};
-
-static TypeGraph
+/// Collects the direct sub-types of each type
+static std::vector<llvm::SmallVector<uint32_t>>
 buildTypeGraph(llvm::ArrayRef<const llvm::DICompositeType *> VertexTypes,
                const llvm::DenseMap<ClassType, size_t> &TypeToVertex) {
-  TypeGraph TG{llvm::SmallBitVector(VertexTypes.size(), true), {}};
-  TG.DerivedTypesOf.resize(VertexTypes.size());
+  std::vector<llvm::SmallVector<uint32_t>> DerivedTypesOf(VertexTypes.size());
 
   for (const auto *Composite : VertexTypes) {
     auto DerivedIdx = TypeToVertex.lookup(Composite);
@@ -118,49 +115,64 @@ buildTypeGraph(llvm::ArrayRef<const llvm::DICompositeType *> VertexTypes,
         auto BaseIdx = TypeToVertex.lookup(Base);
         assert(BaseIdx != 0 || VertexTypes[0] == Base);
 
-        TG.DerivedTypesOf[BaseIdx].push_back(DerivedIdx);
-        TG.Roots.reset(DerivedIdx);
+        DerivedTypesOf[BaseIdx].push_back(DerivedIdx);
       }
     }
   }
 
-  return TG;
+  return DerivedTypesOf;
+}
+
+static CompressedTransitiveClosure buildSubTypeClosure(
+    llvm::ArrayRef<llvm::SmallVector<uint32_t>> DerivedTypesOf) {
+  std::vector<std::pair<uint32_t, uint32_t>> Edges;
+  for (uint32_t BaseIdx = 0, End = DerivedTypesOf.size(); BaseIdx != End;
+       ++BaseIdx) {
+    for (auto DerivedIdx : DerivedTypesOf[BaseIdx]) {
+      Edges.emplace_back(BaseIdx, DerivedIdx);
+    }
+  }
+
+  return CompressedTransitiveClosure(DerivedTypesOf.size(), Edges);
 }
 
-static void buildTypeHierarchy(
-    const TypeGraph &TG,
-    llvm::ArrayRef<const llvm::DICompositeType *> VertexTypes,
+/// Linearizes the inheritance graph as-if constructed by L2R pre-order
+/// traversal from the roots. The range of each type starts with the type
+/// itself, followed by the ranges of its direct sub-types.
+static void linearizeTypeHierarchy(
+    llvm::ArrayRef<llvm::SmallVector<uint32_t>> DerivedTypesOf,
     std::vector<std::pair<uint32_t, uint32_t>> &TransitiveDerivedIndex,
-    std::vector<ClassType> &Hierarchy) {
-  TransitiveDerivedIndex.resize(VertexTypes.size());
+    std::vector<uint32_t> &Hierarchy) {
+  TransitiveDerivedIndex.resize(DerivedTypesOf.size());
 
-  llvm::SmallBitVector Seen(VertexTypes.size());
+  llvm::SmallBitVector Roots(DerivedTypesOf.size(), true);
+  for (const auto &Derived : DerivedTypesOf) {
+    for (auto DerivedIdx : Derived) {
+      Roots.reset(DerivedIdx);
+    }
+  }
 
   llvm::SmallVector<int32_t> WorkList;
 
-  for (uint32_t Rt : TG.Roots.set_bits()) {
+  for (uint32_t Rt : Roots.set_bits()) {
     WorkList.emplace_back(Rt);
 
     while (!WorkList.empty()) {
       auto Curr = WorkList.pop_back_val();
 
       if (Curr < 0) {
-        // Pop N elements
         auto TypeIdx = ~Curr;
         TransitiveDerivedIndex[TypeIdx].second = Hierarchy.size();
         continue;
       }
 
-      if (!Seen.test(Curr)) {
-        TransitiveDerivedIndex[Curr].first = Hierarchy.size();
-      } else {
-        Seen.set(Curr);
-      }
-      Hierarchy.push_back(VertexTypes[Curr]);
-      // llvm::errs() << " -- push " << VertexTypes[Curr]->getName() << '\n';
+      // Types with multiple bases are visited once per base; all visits
+      // produce the same range
+      TransitiveDerivedIndex[Curr].first = Hierarchy.size();
+      Hierarchy.push_back(Curr);
       WorkList.push_back(~Curr);
-      WorkList.append(TG.DerivedTypesOf[Curr].begin(),
-                      TG.DerivedTypesOf[Curr].end());
+      WorkList.append(DerivedTypesOf[Curr].rbegin(),
+                      DerivedTypesOf[Curr].rend());
     }
   }
 }
@@ -213,10 +225,10 @@ DIBasedTypeHierarchy::DIBasedTypeHierarchy(const LLVMProjectIRDB &IRDB) {
   }
 
   // -- Build a type-graph
-  auto TG = buildTypeGraph(VertexTypes, TypeToVertex);
+  DerivedTypesOf = buildTypeGraph(VertexTypes, TypeToVertex);
 
   // -- Build the transitive closure
-  buildTypeHierarchy(TG, VertexTypes, TransitiveDerivedIndex, Hierarchy);
+  SubTypeClosure = buildSubTypeClosure(DerivedTypesOf);
 }
 
 static const llvm::DICompositeType *
@@ -243,20 +255,9 @@ stringToDICompositeType(const llvm::DebugInfoFinder &DIF,
   llvm::report_fatal_error("DIType doesn't exist: " + DITypeName);
 }
 
-static const llvm::DIType *stringToDIType(const llvm::DebugInfoFinder &DIF,
-                                          llvm::StringRef DITypeName) {
-  for (const auto *Type : DIF.types()) {
-    if (Type->getName() == DITypeName) {
-      return Type;
-    }
-  }
-
-  llvm::report_fatal_error("DIType doesn't exist " + DITypeName);
-}
-
 DIBasedTypeHierarchy::DIBasedTypeHierarchy(
-    const LLVMProjectIRDB *IRDB, const DIBasedTypeHierarchyData &SerializedData)
-    : TransitiveDerivedIndex(SerializedData.TransitiveDerivedIndex) {
+    const LLVMProjectIRDB *IRDB,
+    const DIBasedTypeHierarchyData &SerializedData) {
 
   llvm::DebugInfoFinder DIF;
   const auto *Module = IRDB->getModule();
@@ -274,11 +275,39 @@ DIBasedTypeHierarchy::DIBasedTypeHierarchy(
     ++Idx;
   }
 
-  Hierarchy.reserve(SerializedData.Hierarchy.size());
-  for (const auto &Curr : SerializedData.Hierarchy) {
-    Hierarchy.push_back(stringToDIType(DIF, Curr));
+  // The Hierarchy names the types by DIType::getName()
+  llvm::StringMap<uint32_t> VertexOfName;
+  for (uint32_t TyIdx = 0, TyEnd = VertexTypes.size(); TyIdx != TyEnd;
+       ++TyIdx) {
+    VertexOfName.try_emplace(VertexTypes[TyIdx]->getName(), TyIdx);
   }
 
+  // The range of each type in the Hierarchy starts with the type itself,
+  // followed by the ranges of its direct sub-types
+  const auto &Index = SerializedData.TransitiveDerivedIndex;
+  const auto &Hier = SerializedData.Hierarchy;
+  DerivedTypesOf.resize(VertexTypes.size());
+  for (uint32_t TyIdx = 0, TyEnd = std::min(Index.size(), VertexTypes.size());
+       TyIdx != TyEnd; ++TyIdx) {
+    auto [Start, End] = Index[TyIdx];
+    End = std::min<uint32_t>(End, Hier.size());
+    for (auto Pos = Start + 1; Pos < End;) {
+      auto It = VertexOfName.find(Hier[Pos]);
+      if (It == VertexOfName.end()) {
+        PHASAR_LOG_LEVEL(WARNING, "Unknown serialized sub-type: " << Hier[Pos]);
+        ++Pos;
+        continue;
+      }
+
+      auto SubTyIdx = It->second;
+      DerivedTypesOf[TyIdx].push_back(SubTyIdx);
+      auto [SubStart, SubEnd] =
+          SubTyIdx < Index.size() ? Index[SubTyIdx] : std::pair(0U, 0U);
+      Pos += std::max(SubEnd - SubStart, 1U);
+    }
+  }
+  SubTypeClosure = buildSubTypeClosure(DerivedTypesOf);
+
   for (const auto &Curr : SerializedData.VTables) {
     std::vector<const llvm::Function *> CurrVTable;
 
@@ -295,18 +324,16 @@ DIBasedTypeHierarchy::DIBasedTypeHierarchy(
 }
 
 auto DIBasedTypeHierarchy::subTypesOf(size_t TypeIdx) const noexcept
-    -> llvm::iterator_range<const ClassType *> {
-  const auto *Data = Hierarchy.data();
-  auto [Start, End] = TransitiveDerivedIndex[TypeIdx];
-  return {std::next(Data, Start), std::next(Data, End)};
+    -> SubTypeRange {
+  return SubTypeClosure.reachableFrom(TypeIdx, llvm::makeArrayRef(VertexTypes));
 }
 
 auto DIBasedTypeHierarchy::subTypesOf(ClassType Ty) const noexcept
-    -> llvm::iterator_range<const ClassType *> {
+    -> SubTypeRange {
   auto It = TypeToVertex.find(Ty);
   if (It == TypeToVertex.end()) {
-    const auto *Data = Hierarchy.data();
-    return {Data, Data};
+    return CompressedTransitiveClosure::emptyRange<
+        const llvm::DICompositeType *>();
   }
 
   return subTypesOf(It->second);
@@ -318,8 +345,10 @@ void DIBasedTypeHierarchy::print(llvm::raw_ostream &OS) const {
     size_t TyIdx = 0;
     for (const auto *Ty : VertexTypes) {
       OS << Ty->getName() << " --> ";
-      for (const auto *SubTy : llvm::drop_begin(subTypesOf(TyIdx))) {
-        OS << SubTy->getName() << ' ';
+      for (const auto *SubTy : subTypesOf(TyIdx)) {
+        if (SubTy != Ty) {
+          OS << SubTy->getName() << ' ';
+        }
       }
       ++TyIdx;
       OS << '\n';
@@ -356,11 +385,13 @@ DIBasedTypeHierarchyData DIBasedTypeHierarchy::getTypeHierarchyData() const {
     Data.VertexTypes.push_back(getTypeName(Curr).str());
   }
 
-  Data.TransitiveDerivedIndex = TransitiveDerivedIndex;
+  std::vector<uint32_t> Hierarchy;
+  linearizeTypeHierarchy(DerivedTypesOf, Data.TransitiveDerivedIndex,
+                         Hierarchy);
 
   Data.Hierarchy.reserve(Hierarchy.size());
-  for (const auto &Curr : Hierarchy) {
-    Data.Hierarchy.push_back(Curr->getName().str());
+  for (auto TyIdx : Hierarchy) {
+    Data.Hierarchy.push_back(VertexTypes[TyIdx]->getName().str());
   }
 
   for (const auto &Curr : VTables) {
@@ -37,7 +37,6 @@
 #include "llvm/Support/Format.h"
 
 #include "boost/graph/graphviz.hpp"
-#include "boost/graph/transitive_closure.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -64,7 +63,7 @@ private:
 
 LLVMTypeHierarchy::VertexProperties::VertexProperties(
     const llvm::StructType *Type)
-    : Type(Type), ReachableTypes({Type}) {}
+    : Type(Type) {}
 
 std::string LLVMTypeHierarchy::VertexProperties::getTypeName() const {
   return Type->getStructName().str();
@@ -121,15 +120,16 @@ LLVMTypeHierarchy::LLVMTypeHierarchy(
     auto Vtx = TypeVertexMap.at(SrcType);
     for (const auto &CurrEdge : SerElement.getValue()) {
       const auto *DestType = NameToStructType[CurrEdge];
-      if (!SrcType) {
+      if (!DestType) {
         continue;
       }
       auto DestVtx = TypeVertexMap.at(DestType);
 
-      TypeGraph[Vtx].ReachableTypes.insert(DestType);
       boost::add_edge(Vtx, DestVtx, TypeGraph);
     }
   }
+
+  buildSubTypeClosure();
 }
 
 LLVMTypeHierarchy::LLVMTypeHierarchy(const llvm::Module &M) {
@@ -201,17 +201,25 @@ bool LLVMTypeHierarchy::isStruct(llvm::StringRef TypeName) {
 }
 
 void LLVMTypeHierarchy::buildLLVMTypeHierarchy(const llvm::Module &M) {
-  // build the hierarchy for the module
+  // build the hierarchy for the module; this also caches the reachable types
   constructHierarchy(M);
-  // cache the reachable types
-  bidigraph_t TC;
-  boost::transitive_closure(TypeGraph, TC);
+}
+
+void LLVMTypeHierarchy::buildSubTypeClosure() {
+  auto NumVertices = boost::num_vertices(TypeGraph);
+  VertexTypes.resize(NumVertices);
   for (auto V : boost::make_iterator_range(boost::vertices(TypeGraph))) {
-    for (auto OE : boost::make_iterator_range(boost::out_edges(V, TC))) {
-      auto Target = boost::target(OE, TC);
-      TypeGraph[V].ReachableTypes.insert(TypeGraph[Target].Type);
-    }
+    VertexTypes[V] = TypeGraph[V].Type;
+  }
+
+  std::vector<std::pair<uint32_t, uint32_t>> Edges;
+  Edges.reserve(boost::num_edges(TypeGraph));
+  for (auto E : boost::make_iterator_range(boost::edges(TypeGraph))) {
+    Edges.emplace_back(boost::source(E, TypeGraph),
+                       boost::target(E, TypeGraph));
   }
+
+  SubTypeClosure = CompressedTransitiveClosure(NumVertices, Edges);
 }
 
 std::vector<const llvm::StructType *>
@@ -317,16 +325,23 @@ void LLVMTypeHierarchy::constructHierarchy(const llvm::Module &M) {
                       TypeGraph);
     }
   }
+
+  buildSubTypeClosure();
 }
 
 std::set<const llvm::StructType *>
 LLVMTypeHierarchy::getSubTypes(const llvm::StructType *Type) const {
-  if (TypeVertexMap.count(Type)) {
-    if (auto It = TypeVertexMap.find(Type); It != TypeVertexMap.end()) {
-      return TypeGraph[It->second].ReachableTypes;
-    }
+  auto SubTypes = subTypesOf(Type);
+  return {SubTypes.begin(), SubTypes.end()};
+}
+
+auto LLVMTypeHierarchy::subTypesOf(const llvm::StructType *Type) const noexcept
+    -> SubTypeRange {
+  if (auto It = TypeVertexMap.find(Type); It != TypeVertexMap.end()) {
+    return SubTypeClosure.reachableFrom(It->second,
+                                        llvm::makeArrayRef(VertexTypes));
   }
-  return {};
+  return CompressedTransitiveClosure::emptyRange<const llvm::StructType *>();
 }
 
 const llvm::StructType *
@@ -462,7 +477,7 @@ void LLVMTypeHierarchy::printAsJson(llvm::raw_ostream &OS) const {
   for (auto Vtx : boost::make_iterator_range(boost::vertices(TypeGraph))) {
     //  iterate all out edges of vertex vi_v
     auto &SerTypes = Data.TypeGraph[TypeGraph[Vtx].getTypeName()];
-    for (const auto &CurrReachable : TypeGraph[Vtx].ReachableTypes) {
+    for (const auto *CurrReachable : subTypesOf(TypeGraph[Vtx].Type)) {
       SerTypes.push_back(CurrReachable->getName().str());
     }
   }
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/Checkpoint.h"
+
+#include "phasar/Utils/Logger.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/LEB128.h"
+#include "llvm/Support/Process.h"
+
+#include <cassert>
+
+using namespace psr;
+
+CheckpointEncoder::CheckpointEncoder(llvm::StringRef Magic, uint8_t Version)
+    : OS(Buffer) {
+  OS << Magic;
+  OS << char(Version);
+}
+
+uint32_t CheckpointEncoder::getStringId(llvm::StringRef Str) {
+  return Strings.getStringId(Str, OS);
+}
+
+void CheckpointEncoder::writeTag(char Tag) {
+  assert(Tag != StringTableWriter::RecordTag && Tag != '\0' &&
+         "Reserved record tag");
+  OS << Tag;
+}
+
+void CheckpointEncoder::writeNumber(uint64_t Num) {
+  llvm::encodeULEB128(Num, OS);
+}
+
+void CheckpointEncoder::writeBytes(llvm::StringRef Bytes) {
+  writeNumber(Bytes.size());
+  OS << Bytes;
+}
+
+std::string CheckpointEncoder::take() && {
+  OS.flush();
+  return std::move(Buffer);
+}
+
+CheckpointDecoder::CheckpointDecoder(llvm::StringRef Buffer) noexcept
+    : Data(Buffer, /*IsLittleEndian=*/true, /*AddressSize=*/8), Cur(0) {}
+
+CheckpointDecoder::~CheckpointDecoder() {
+  // The error of the cursor must be consumed before it is destroyed
+  llvm::consumeError(Cur.takeError());
+}
+
+llvm::ErrorOr<CheckpointDecoder>
+CheckpointDecoder::create(llvm::StringRef Buffer, llvm::StringRef Magic,
+                          uint8_t Version) {
+  if (!Buffer.consume_front(Magic) || Buffer.empty() ||
+      uint8_t(Buffer.front()) != Version) {
+    return std::make_error_code(std::errc::illegal_byte_sequence);
+  }
+  return CheckpointDecoder(Buffer.drop_front());
+}
+
+char CheckpointDecoder::nextTag() {
+  while (!hasError() && !Data.eof(Cur)) {
+    auto Tag = char(Data.getU8(Cur));
+    if (Tag != StringTableWriter::RecordTag) {
+      return Tag;
+    }
+    Strings.readRecord(Data, Cur);
+  }
+  return '\0';
+}
+
+uint64_t CheckpointDecoder::readNumber() { return Data.getULEB128(Cur); }
+
+llvm::StringRef CheckpointDecoder::readBytes() {
+  auto Size = readNumber();
+  return Data.getBytes(Cur, Size);
+}
+
+llvm::StringRef CheckpointDecoder::getString(uint64_t Id) {
+  if (hasError() || !Strings.contains(Id)) {
+    Failed = true;
+    return {};
+  }
+  return Strings.getString(Id);
+}
+
+std::error_code psr::writeCheckpointFile(llvm::StringRef Path,
+                                         llvm::StringRef Buffer) {
+  llvm::SmallString<256> TmpPath(Path);
+  TmpPath += ".tmp";
+  {
+    std::error_code EC;
+    llvm::raw_fd_ostream OS(TmpPath, EC);
+    if (EC) {
+      return EC;
+    }
+    OS << Buffer;
+    OS.close();
+    if (OS.has_error()) {
+      EC = OS.error();
+      OS.clear_error();
+      return EC;
+    }
+  }
+  return llvm::sys::fs::rename(TmpPath, Path);
+}
+
+PeriodicCheckpointer::PeriodicCheckpointer(CheckpointConfig Config)
+    : Config(std::move(Config)),
+      LastCheckpoint(std::chrono::steady_clock::now()),
+      LastMemoryUsage(llvm::sys::Process::GetMallocUsage()) {}
+
+PeriodicCheckpointer::~PeriodicCheckpointer() { wait(); }
+
+bool PeriodicCheckpointer::isDue(
+    std::chrono::steady_clock::time_point Now) const {
+  if (Now - LastCheckpoint >= Config.Interval) {
+    return true;
+  }
+  return Config.MemoryGrowthThreshold != 0 &&
+         llvm::sys::Process::GetMallocUsage() >=
+             LastMemoryUsage + Config.MemoryGrowthThreshold;
+}
+
+void PeriodicCheckpointer::write(std::string Buffer) {
+  wait();
+  ++NumCheckpoints;
+  LastCheckpoint = std::chrono::steady_clock::now();
+  LastMemoryUsage = llvm::sys::Process::GetMallocUsage();
+
+  Writer = std::thread([this, Buffer = std::move(Buffer)] {
+    LastError = writeCheckpointFile(Config.Path, Buffer);
+  });
+}
+
+void PeriodicCheckpointer::postpone() {
+  LastCheckpoint = std::chrono::steady_clock::now();
+  LastMemoryUsage = llvm::sys::Process::GetMallocUsage();
+}
+
+void PeriodicCheckpointer::wait() {
+  if (!Writer.joinable()) {
+    return;
+  }
+  Writer.join();
+  if (LastError) {
+    PHASAR_LOG_LEVEL(ERROR, "Cannot write checkpoint to '"
+                                << Config.Path
+                                << "': " << LastError.message());
+  } else {
+    PHASAR_LOG_LEVEL(INFO, "Wrote checkpoint #" << NumCheckpoints << " to '"
+                                                << Config.Path << '\'');
+  }
+}
@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/ColumnarResults.h"
+
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/LEB128.h"
+
+#include <cassert>
+#include <optional>
+#include <system_error>
+
+using namespace psr;
+
+static constexpr llvm::StringLiteral BinaryMagic = "PSRRES";
+static constexpr uint8_t BinaryVersion = 1;
+
+ColumnarResultsWriter::ColumnarResultsWriter(llvm::raw_ostream &OS) : OS(OS) {
+  OS << BinaryMagic;
+  OS << char(BinaryVersion);
+}
+
+ColumnarResultsWriter::~ColumnarResultsWriter() { finish(); }
+
+uint32_t ColumnarResultsWriter::getStringId(llvm::StringRef Str) {
+  return Strings.getStringId(Str, OS);
+}
+
+void ColumnarResultsWriter::addRow(uint32_t StmtStrId,
+                                   llvm::ArrayRef<uint32_t> FactStrIds,
+                                   llvm::ArrayRef<uint32_t> ValueStrIds) {
+  assert(!Finished && "Cannot add rows to finished results");
+  assert(FactStrIds.size() == ValueStrIds.size() &&
+         "Each fact needs exactly one value");
+  assert(Strings.contains(StmtStrId) && "Invalid string-id");
+
+  ++NumRows;
+  NumResults += FactStrIds.size();
+
+  OS << 'R';
+  llvm::encodeULEB128(StmtStrId, OS);
+  llvm::encodeULEB128(FactStrIds.size(), OS);
+  for (auto Fact : FactStrIds) {
+    assert(Strings.contains(Fact) && "Invalid string-id");
+    llvm::encodeULEB128(Fact, OS);
+  }
+  for (auto Value : ValueStrIds) {
+    assert(Strings.contains(Value) && "Invalid string-id");
+    llvm::encodeULEB128(Value, OS);
+  }
+}
+
+void ColumnarResultsWriter::finish() {
+  if (Finished) {
+    return;
+  }
+  Finished = true;
+  OS << 'Z';
+  OS.flush();
+}
+
+llvm::ErrorOr<ColumnarResultsReader>
+ColumnarResultsReader::create(llvm::StringRef Buffer) {
+  auto Invalid = std::make_error_code(std::errc::illegal_byte_sequence);
+  if (!Buffer.consume_front(BinaryMagic) || Buffer.empty() ||
+      uint8_t(Buffer.front()) != BinaryVersion) {
+    return Invalid;
+  }
+  Buffer = Buffer.drop_front();
+
+  ColumnarResultsReader Ret(Buffer);
+  llvm::DataExtractor Data(Buffer, /*IsLittleEndian=*/true,
+                           /*AddressSize=*/8);
+  llvm::DataExtractor::Cursor Cur(0);
+  // The error of the cursor must be consumed before it is destroyed
+  auto Fail = [&Cur, Invalid] {
+    llvm::consumeError(Cur.takeError());
+    return Invalid;
+  };
+
+  auto ReadStringId = [&]() -> std::optional<uint32_t> {
+    auto Id = Data.getULEB128(Cur);
+    if (!Cur || !Ret.Strings.contains(Id)) {
+      return std::nullopt;
+    }
+    return uint32_t(Id);
+  };
+
+  bool Complete = false;
+  while (Cur && !Complete) {
+    switch (char(Data.getU8(Cur))) {
+    case StringTableWriter::RecordTag:
+      Ret.Strings.readRecord(Data, Cur);
+      break;
+    case 'R': {
+      auto Stmt = ReadStringId();
+      auto NumResults = Data.getULEB128(Cur);
+      if (!Stmt || !Cur) {
+        return Fail();
+      }
+
+      Row R{*Stmt, uint32_t(NumResults), Cur.tell(), 0};
+      for (uint64_t I = 0; I != NumResults; ++I) {
+        if (!ReadStringId()) {
+          return Fail();
+        }
+      }
+      R.ValuesOffset = Cur.tell();
+      for (uint64_t I = 0; I != NumResults; ++I) {
+        if (!ReadStringId()) {
+          return Fail();
+        }
+      }
+
+      Ret.RowsOfStmt[Ret.Strings.getString(*Stmt)].push_back(
+          uint32_t(Ret.Rows.size()));
+      Ret.Rows.push_back(R);
+      Ret.NumResults += NumResults;
+      break;
+    }
+    case 'Z':
+      Complete = true;
+      break;
+    default:
+      return Fail();
+    }
+  }
+
+  if (!Cur || !Complete) {
+    return Fail();
+  }
+  return Ret;
+}
+
+bool ColumnarResultsReader::containsStmt(llvm::StringRef Stmt) const {
+  return RowsOfStmt.count(Stmt);
+}
+
+void ColumnarResultsReader::foreachResultIn(const Row &R,
+                                            ResultHandlerTy Handler) const {
+  // The columns have been validated by create()
+  llvm::StringRef Stmt = Strings.getString(R.StmtStrId);
+  const auto *Facts = Buffer.bytes_begin() + R.FactsOffset;
+  const auto *Values = Buffer.bytes_begin() + R.ValuesOffset;
+  for (uint32_t I = 0; I != R.NumResults; ++I) {
+    unsigned FactLen = 0;
+    unsigned ValueLen = 0;
+    auto Fact = llvm::decodeULEB128(Facts, &FactLen);
+    auto Value = llvm::decodeULEB128(Values, &ValueLen);
+    Facts += FactLen;
+    Values += ValueLen;
+    Handler(Stmt, Strings.getString(Fact), Strings.getString(Value));
+  }
+}
+
+void ColumnarResultsReader::foreachResultAt(llvm::StringRef Stmt,
+                                            ResultHandlerTy Handler) const {
+  auto It = RowsOfStmt.find(Stmt);
+  if (It == RowsOfStmt.end()) {
+    return;
+  }
+  for (auto RowIdx : It->second) {
+    foreachResultIn(Rows[RowIdx], Handler);
+  }
+}
+
+void ColumnarResultsReader::foreachResult(ResultHandlerTy Handler) const {
+  for (const auto &R : Rows) {
+    foreachResultIn(R, Handler);
+  }
+}
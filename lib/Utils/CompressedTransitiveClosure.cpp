@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/CompressedTransitiveClosure.h"
+
+#include "llvm/ADT/SmallVector.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+using namespace psr;
+
+static constexpr uint32_t NotVisited = std::numeric_limits<uint32_t>::max();
+
+CompressedTransitiveClosure::CompressedTransitiveClosure(
+    size_t NumNodes, llvm::ArrayRef<std::pair<uint32_t, uint32_t>> Edges) {
+  assert(NumNodes < NotVisited);
+
+  // -- Build the successor lists in CSR form, ignoring self-loops
+  std::vector<uint32_t> SuccOffsets(NumNodes + 1);
+  std::vector<bool> HasPred(NumNodes);
+  for (auto [From, To] : Edges) {
+    assert(From < NumNodes && To < NumNodes);
+    if (From != To) {
+      ++SuccOffsets[From + 1];
+      HasPred[To] = true;
+    }
+  }
+  std::partial_sum(SuccOffsets.begin(), SuccOffsets.end(),
+                   SuccOffsets.begin());
+  std::vector<uint32_t> Succs(SuccOffsets.back());
+  {
+    auto Fill = SuccOffsets;
+    for (auto [From, To] : Edges) {
+      if (From != To) {
+        Succs[Fill[From]++] = To;
+      }
+    }
+  }
+  auto SuccsOf = [&](uint32_t Node) {
+    return llvm::makeArrayRef(Succs).slice(
+        SuccOffsets[Node], SuccOffsets[Node + 1] - SuccOffsets[Node]);
+  };
+
+  // -- Number the nodes in pre-order of a DFS spanning forest. The spanning
+  // subtree of a node covers the pre-order numbers [PreOrderNum, LastInTree].
+  PreOrderNum.assign(NumNodes, NotVisited);
+  NodeAt.reserve(NumNodes);
+  std::vector<uint32_t> LastInTree(NumNodes);
+  std::vector<uint32_t> FinishOrder;
+  FinishOrder.reserve(NumNodes);
+
+  // (Node, index of the next successor to visit)
+  llvm::SmallVector<std::pair<uint32_t, uint32_t>> WorkList;
+  auto Visit = [&](uint32_t Root) {
+    PreOrderNum[Root] = NodeAt.size();
+    NodeAt.push_back(Root);
+    WorkList.emplace_back(Root, 0);
+
+    while (!WorkList.empty()) {
+      auto &[Node, NextSucc] = WorkList.back();
+      auto NodeSuccs = SuccsOf(Node);
+      if (NextSucc == NodeSuccs.size()) {
+        LastInTree[Node] = NodeAt.size() - 1;
+        FinishOrder.push_back(Node);
+        WorkList.pop_back();
+        continue;
+      }
+
+      auto Succ = NodeSuccs[NextSucc++];
+      if (PreOrderNum[Succ] == NotVisited) {
+        PreOrderNum[Succ] = NodeAt.size();
+        NodeAt.push_back(Succ);
+        // Invalidates Node and NextSucc
+        WorkList.emplace_back(Succ, 0);
+      }
+    }
+  };
+
+  // Start at the roots, s.t. the spanning trees are as large as possible. The
+  // second loop only matters for graphs with cycles.
+  for (uint32_t Node = 0; Node != NumNodes; ++Node) {
+    if (!HasPred[Node]) {
+      Visit(Node);
+    }
+  }
+  for (uint32_t Node = 0; Node != NumNodes; ++Node) {
+    if (PreOrderNum[Node] == NotVisited) {
+      Visit(Node);
+    }
+  }
+
+  // -- Compute the intervals bottom-up. In a DAG all successors of a node are
+  // finished before the node itself
+  std::vector<llvm::SmallVector<Interval, 1>> NodeIntervals(NumNodes);
+  llvm::SmallVector<Interval> Scratch;
+  for (auto Node : FinishOrder) {
+    Scratch.clear();
+    Scratch.emplace_back(PreOrderNum[Node], LastInTree[Node]);
+    for (auto Succ : SuccsOf(Node)) {
+      const auto &SuccIvs = NodeIntervals[Succ];
+      assert(!SuccIvs.empty() && "The graph must be acyclic");
+      // Tree-children are already covered by the tree interval
+      if (SuccIvs.size() == 1 && SuccIvs.front().first >= PreOrderNum[Node] &&
+          SuccIvs.front().second <= LastInTree[Node]) {
+        continue;
+      }
+      Scratch.append(SuccIvs.begin(), SuccIvs.end());
+    }
+
+    auto &Ivs = NodeIntervals[Node];
+    if (Scratch.size() == 1) {
+      Ivs.push_back(Scratch.front());
+      continue;
+    }
+
+    // Coalesce overlapping and adjacent intervals
+    std::sort(Scratch.begin(), Scratch.end());
+    Ivs.push_back(Scratch.front());
+    for (const auto &Iv : llvm::drop_begin(Scratch)) {
+      if (Iv.first <= Ivs.back().second + 1) {
+        Ivs.back().second = std::max(Ivs.back().second, Iv.second);
+      } else {
+        Ivs.push_back(Iv);
+      }
+    }
+  }
+
+  // -- Flatten the intervals
+  IntervalOffsets.reserve(NumNodes + 1);
+  IntervalOffsets.push_back(0);
+  size_t NumIntervals = 0;
+  for (const auto &Ivs : NodeIntervals) {
+    NumIntervals += Ivs.size();
+    IntervalOffsets.push_back(NumIntervals);
+  }
+  Intervals.reserve(NumIntervals);
+  for (const auto &Ivs : NodeIntervals) {
+    Intervals.insert(Intervals.end(), Ivs.begin(), Ivs.end());
+  }
+}
+
+bool CompressedTransitiveClosure::reaches(uint32_t From,
+                                          uint32_t To) const noexcept {
+  assert(To < size());
+  auto Ivs = intervals(From);
+  auto ToNum = PreOrderNum[To];
+  // The first interval that starts after ToNum
+  const auto *It = std::upper_bound(
+      Ivs.begin(), Ivs.end(), ToNum,
+      [](uint32_t Num, const Interval &Iv) { return Num < Iv.first; });
+  return It != Ivs.begin() && ToNum <= std::prev(It)->second;
+}
+
+size_t
+CompressedTransitiveClosure::numReachable(uint32_t From) const noexcept {
+  size_t Ret = 0;
+  for (auto [First, Last] : intervals(From)) {
+    Ret += Last - First + 1;
+  }
+  return Ret;
+}
@@ -0,0 +1,181 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/ESGStreamWriter.h"
+
+#include "llvm/Support/GraphWriter.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/LEB128.h"
+
+#include <cassert>
+
+using namespace psr;
+
+static constexpr llvm::StringLiteral BinaryMagic = "PSRESG";
+static constexpr uint8_t BinaryVersion = 1;
+
+ESGStreamWriter::ESGStreamWriter(llvm::raw_ostream &OS, ESGExportFormat Format,
+                                 llvm::StringRef Label)
+    : OS(OS), Format(Format) {
+  switch (Format) {
+  case ESGExportFormat::Dot:
+    OS << "digraph ESG {\n";
+    OS << "  label=\"" << llvm::DOT::EscapeString(Label.str()) << "\"\n";
+    OS << "  node [shape=box, style=rounded, fontsize=11]\n";
+    OS << "  edge [fontsize=11, arrowsize=0.7]\n";
+    break;
+  case ESGExportFormat::Json:
+    JOS = std::make_unique<llvm::json::OStream>(OS);
+    JOS->objectBegin();
+    JOS->attribute("label", Label);
+    JOS->attributeBegin("records");
+    JOS->arrayBegin();
+    break;
+  case ESGExportFormat::Binary:
+    OS << BinaryMagic;
+    OS << char(BinaryVersion);
+    StringTableWriter::writeString(Label, OS);
+    break;
+  }
+}
+
+ESGStreamWriter::~ESGStreamWriter() { finish(); }
+
+uint32_t ESGStreamWriter::getStringId(llvm::StringRef Str) {
+  auto [Id, Inserted] = Strings.insert(Str);
+  if (!Inserted) {
+    return Id;
+  }
+
+  switch (Format) {
+  case ESGExportFormat::Dot:
+    // Strings are inlined into the labels
+    break;
+  case ESGExportFormat::Json:
+    JOS->object([&] {
+      JOS->attribute("kind", "string");
+      JOS->attribute("id", Id);
+      JOS->attribute("value", Str);
+    });
+    break;
+  case ESGExportFormat::Binary:
+    StringTableWriter::writeRecord(Str, OS);
+    break;
+  }
+  return Id;
+}
+
+uint32_t ESGStreamWriter::addNode(uint32_t FunctionStrId, uint32_t StmtStrId,
+                                  uint32_t FactStrId) {
+  assert(!Finished && "Cannot add nodes to a finished graph");
+  assert(Strings.contains(FunctionStrId) && Strings.contains(StmtStrId) &&
+         Strings.contains(FactStrId) && "Invalid string-id");
+
+  auto Id = NumNodes++;
+  switch (Format) {
+  case ESGExportFormat::Dot:
+    OS << "  n" << Id << " [label=\""
+       << llvm::DOT::EscapeString(Strings.getString(FactStrId).str()) << "\\n@ "
+       << llvm::DOT::EscapeString(Strings.getString(StmtStrId).str()) << "\\n("
+       << llvm::DOT::EscapeString(Strings.getString(FunctionStrId).str())
+       << ")\"]\n";
+    break;
+  case ESGExportFormat::Json:
+    JOS->object([&] {
+      JOS->attribute("kind", "node");
+      JOS->attribute("id", Id);
+      JOS->attribute("function", FunctionStrId);
+      JOS->attribute("stmt", StmtStrId);
+      JOS->attribute("fact", FactStrId);
+    });
+    break;
+  case ESGExportFormat::Binary:
+    OS << 'N';
+    llvm::encodeULEB128(FunctionStrId, OS);
+    llvm::encodeULEB128(StmtStrId, OS);
+    llvm::encodeULEB128(FactStrId, OS);
+    break;
+  }
+  return Id;
+}
+
+void ESGStreamWriter::addEdge(uint32_t From, uint32_t To,
+                              bool IsInterProcedural, uint32_t EdgeFnStrId) {
+  assert(!Finished && "Cannot add edges to a finished graph");
+  assert(From < NumNodes && To < NumNodes && "Invalid node-id");
+  assert((EdgeFnStrId == NoString || Strings.contains(EdgeFnStrId)) &&
+         "Invalid string-id");
+
+  ++NumEdges;
+  switch (Format) {
+  case ESGExportFormat::Dot:
+    OS << "  n" << From << " -> n" << To;
+    if (IsInterProcedural || EdgeFnStrId != NoString) {
+      OS << " [";
+      if (IsInterProcedural) {
+        OS << "style=dashed, weight=0.1";
+        if (EdgeFnStrId != NoString) {
+          OS << ", ";
+        }
+      }
+      if (EdgeFnStrId != NoString) {
+        OS << "label=\""
+           << llvm::DOT::EscapeString(Strings.getString(EdgeFnStrId).str())
+           << '"';
+      }
+      OS << ']';
+    }
+    OS << '\n';
+    break;
+  case ESGExportFormat::Json:
+    JOS->object([&] {
+      JOS->attribute("kind", "edge");
+      JOS->attribute("from", From);
+      JOS->attribute("to", To);
+      JOS->attribute("interproc", IsInterProcedural);
+      if (EdgeFnStrId != NoString) {
+        JOS->attribute("ef", EdgeFnStrId);
+      }
+    });
+    break;
+  case ESGExportFormat::Binary:
+    OS << 'E';
+    llvm::encodeULEB128(From, OS);
+    llvm::encodeULEB128(To, OS);
+    llvm::encodeULEB128(unsigned(IsInterProcedural), OS);
+    // Shift by one, such that NoString is encoded as 0
+    llvm::encodeULEB128(EdgeFnStrId == NoString ? 0 : uint64_t(EdgeFnStrId) + 1,
+                        OS);
+    break;
+  }
+}
+
+void ESGStreamWriter::finish() {
+  if (Finished) {
+    return;
+  }
+  Finished = true;
+
+  switch (Format) {
+  case ESGExportFormat::Dot:
+    OS << "}\n";
+    break;
+  case ESGExportFormat::Json:
+    JOS->arrayEnd();
+    JOS->attributeEnd();
+    JOS->objectEnd();
+    JOS->flush();
+    JOS.reset();
+    break;
+  case ESGExportFormat::Binary:
+    OS << 'Z';
+    break;
+  }
+  OS.flush();
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionPool.h"
+
+#include "llvm/Support/raw_ostream.h"
+
+#include <cassert>
+
+namespace psr {
+
+EdgeFunctionPool::~EdgeFunctionPool() {
+  assert(getStatistics().NumLive == 0 &&
+         "Destroying an EdgeFunctionPool that is still in use");
+}
+
+EdgeFunctionPoolStatistics EdgeFunctionPool::getStatistics() const noexcept {
+  auto NumRemoteFrees = this->NumRemoteFrees.load(std::memory_order_relaxed);
+  return {
+      NumAllocations,
+      NumReused,
+      NumOversized,
+      NumAllocations + NumOversized - NumFrees - NumRemoteFrees,
+      NumRemoteFrees,
+      Slabs.getTotalMemory(),
+  };
+}
+
+llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                              const EdgeFunctionPoolStatistics &S) {
+  OS << "EdgeFunctionPool:\n";
+  OS << "  Pooled Allocations:\t" << S.NumAllocations << '\n';
+  OS << "  Reused Blocks:\t\t" << S.NumReused << '\n';
+  OS << "  Oversized Allocations:\t" << S.NumOversized << '\n';
+  OS << "  Live Blocks:\t\t" << S.NumLive << '\n';
+  OS << "  Remote Frees:\t\t" << S.NumRemoteFrees << '\n';
+  OS << "  Allocated Bytes:\t\t" << S.NumAllocatedBytes << '\n';
+  return OS;
+}
+
+} // namespace psr
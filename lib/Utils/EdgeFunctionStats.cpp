@@ -8,7 +8,8 @@ llvm::raw_ostream &psr::operator<<(llvm::raw_ostream &OS,
   static constexpr auto EFKind = {"Normal", "Call", "Return", "CallToReturn",
                                   "Summary"};
   static constexpr auto AllocKind = {
-      "SmallObjectOptimized", "DefaultHeapAllocated", "CustomHeapAllocated"};
+      "SmallObjectOptimized", "DefaultHeapAllocated", "CustomHeapAllocated",
+      "PoolAllocated"};
 
   OS << "Cached Edge Functions:\n";
 
@@ -45,5 +46,18 @@ llvm::raw_ostream &psr::operator<<(llvm::raw_ostream &OS,
   OS << "    Avg Unique Depth:\t\t" << llvm::format("%g\n", S.AvgUniqueJFDepth);
   OS << "    Avg JF Object Depth:\t" << llvm::format("%g\n", S.AvgJFObjDepth);
 
+  if (S.MemoComposeHits + S.MemoComposeMisses + S.MemoJoinHits +
+      S.MemoJoinMisses) {
+    OS << "Memoization:\n";
+    OS << "  Compose Hits:\t\t\t" << S.MemoComposeHits << '\n';
+    OS << "  Compose Misses:\t\t" << S.MemoComposeMisses << '\n';
+    OS << "  Compose Hit Rate:\t\t"
+       << llvm::format("%g\n", S.getMemoComposeHitRate());
+    OS << "  Join Hits:\t\t\t" << S.MemoJoinHits << '\n';
+    OS << "  Join Misses:\t\t\t" << S.MemoJoinMisses << '\n';
+    OS << "  Join Hit Rate:\t\t"
+       << llvm::format("%g\n", S.getMemoJoinHitRate());
+  }
+
   return OS;
 }
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/SpillFile.h"
+
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
+
+#include <tuple>
+#include <utility>
+
+using namespace psr;
+
+SpillFile::SpillFile(int FD, llvm::SmallString<128> Path)
+    : FD(FD), Path(std::move(Path)),
+      OS(std::make_unique<llvm::raw_fd_ostream>(FD, /*shouldClose=*/false)) {}
+
+SpillFile::SpillFile(SpillFile &&Other) noexcept
+    : FD(std::exchange(Other.FD, -1)), Path(std::move(Other.Path)),
+      OS(std::move(Other.OS)), Size(Other.Size) {}
+
+SpillFile::~SpillFile() {
+  if (FD < 0) {
+    return;
+  }
+  OS.reset();
+  std::ignore = llvm::sys::Process::SafelyCloseFileDescriptor(FD);
+  std::ignore = llvm::sys::fs::remove(Path);
+}
+
+llvm::ErrorOr<SpillFile> SpillFile::create(llvm::StringRef Dir) {
+  int FD = -1;
+  llvm::SmallString<128> Path;
+  std::error_code EC;
+  if (Dir.empty()) {
+    EC = llvm::sys::fs::createTemporaryFile("phasar-spill", "bin", FD, Path);
+  } else {
+    llvm::SmallString<128> Model(Dir);
+    llvm::sys::path::append(Model, "phasar-spill-%%%%%%.bin");
+    EC = llvm::sys::fs::createUniqueFile(Model, FD, Path);
+  }
+  if (EC) {
+    return EC;
+  }
+  return SpillFile(FD, std::move(Path));
+}
+
+llvm::ErrorOr<SpillFile::Segment> SpillFile::write(llvm::StringRef Data) {
+  // After a failed write, the file may contain parts of the data, so the
+  // offsets are taken from the stream
+  Segment Seg{OS->tell(), Data.size()};
+  OS->write(Data.data(), Data.size());
+  // The data must be on disk before it can be mapped back
+  OS->flush();
+  Size = OS->tell();
+  if (OS->has_error()) {
+    auto EC = OS->error();
+    OS->clear_error();
+    return EC;
+  }
+  return Seg;
+}
+
+llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
+SpillFile::read(Segment Seg) const {
+  return llvm::MemoryBuffer::getOpenFileSlice(
+      llvm::sys::fs::convertFDToNativeFile(FD), Path, Seg.Size,
+      int64_t(Seg.Offset));
+}
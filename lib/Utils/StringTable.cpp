@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/Support/LEB128.h"
+
+using namespace psr;
+
+std::pair<uint32_t, bool> StringTableWriter::insert(llvm::StringRef Str) {
+  auto [It, Inserted] = StringIds.try_emplace(Str, Strings.size());
+  if (Inserted) {
+    Strings.push_back(It->first());
+  }
+  return {It->second, Inserted};
+}
+
+void StringTableWriter::writeRecord(llvm::StringRef Str,
+                                    llvm::raw_ostream &OS) {
+  OS << RecordTag;
+  writeString(Str, OS);
+}
+
+void StringTableWriter::writeString(llvm::StringRef Str,
+                                    llvm::raw_ostream &OS) {
+  llvm::encodeULEB128(Str.size(), OS);
+  OS << Str;
+}
+
+llvm::StringRef
+StringTableReader::readString(llvm::DataExtractor &Data,
+                              llvm::DataExtractor::Cursor &Cur) {
+  auto Len = Data.getULEB128(Cur);
+  return Data.getBytes(Cur, Len);
+}
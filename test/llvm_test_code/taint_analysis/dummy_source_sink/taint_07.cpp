@@ -0,0 +1,16 @@
+extern int source();     // dummy source
+extern void sink(int p); // dummy sink
+
+int main(int argc, char **argv) {
+  int Tainted = source();
+  int Value = 0;
+  int Sum = 0;
+  for (int I = 0; I < argc; ++I) {
+    int Current = Value;
+    Sum += Current;
+    sink(Current);
+    Value = Tainted;
+  }
+  sink(Sum);
+  return 0;
+}
@@ -15,6 +15,12 @@
 
 #include "AnalysisControllerInternal.h"
 
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace psr {
 
 void AnalysisController::emitRequestedHelperAnalysisResults() {
@@ -112,61 +118,146 @@ static void executeVariational(AnalysisController & /*Data*/) {
       "AnalysisStrategy 'variational' not supported, yet!");
 }
 
-static void executeWholeProgram(AnalysisController &Data) {
+static void executeDataFlowAnalysis(AnalysisController &Data,
+                                    DataFlowAnalysisType DataFlowAnalysis) {
+  using namespace controller;
+  switch (DataFlowAnalysis) {
+  case DataFlowAnalysisType::None:
+    return;
+  case DataFlowAnalysisType::IFDSUninitializedVariables:
+    executeIFDSUninitVar(Data);
+    return;
+  case DataFlowAnalysisType::IFDSConstAnalysis:
+    executeIFDSConst(Data);
+    return;
+  case DataFlowAnalysisType::IFDSTaintAnalysis:
+    executeIFDSTaint(Data);
+    return;
+  case DataFlowAnalysisType::IDEExtendedTaintAnalysis:
+    executeIDEXTaint(Data);
+    return;
+  case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis:
+    executeIDEOpenSSLTS(Data);
+    return;
+  case DataFlowAnalysisType::IDECSTDIOTypeStateAnalysis:
+    executeIDECSTDIOTS(Data);
+    return;
+  case DataFlowAnalysisType::IFDSTypeAnalysis:
+    executeIFDSType(Data);
+    return;
+  case DataFlowAnalysisType::IFDSSolverTest:
+    executeIFDSSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::IDELinearConstantAnalysis:
+    executeIDELinearConst(Data);
+    return;
+  case DataFlowAnalysisType::IDESolverTest:
+    executeIDESolverTest(Data);
+    return;
+  case DataFlowAnalysisType::IDEInstInteractionAnalysis:
+    executeIDEIIA(Data);
+    return;
+  case DataFlowAnalysisType::IntraMonoFullConstantPropagation:
+    executeIntraMonoFullConstant(Data);
+    return;
+  case DataFlowAnalysisType::IntraMonoSolverTest:
+    executeIntraMonoSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::InterMonoSolverTest:
+    executeInterMonoSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::InterMonoTaintAnalysis:
+    executeInterMonoTaint(Data);
+    return;
+  }
+
+  llvm_unreachable("All possible DataFlowAnalysisType variants should be "
+                   "handled in the switch above!");
+}
+
+/// Runs each analysis on its own thread. The helper analyses are frozen
+/// before, so the analyses can share them without synchronization. Each
+/// analysis writes its results into its own sub-directory of the
+/// ResultDirectory; without a ResultDirectory, the results are printed to
+/// stdout one analysis after another.
+static void executeWholeProgramParallel(AnalysisController &Data) {
+  // Construct all helper analyses now, such that no thread needs to modify
+  // them later
+  Data.HA->freeze();
+
+  struct AnalysisRun {
+    AnalysisController Data;
+    DataFlowAnalysisType DataFlowAnalysis{};
+    std::string Output;
+    std::exception_ptr Error;
+  };
+
+  std::vector<AnalysisRun> Runs;
+  Runs.reserve(Data.DataFlowAnalyses.size());
   for (auto DataFlowAnalysis : Data.DataFlowAnalyses) {
-    using namespace controller;
-    switch (DataFlowAnalysis) {
-    case DataFlowAnalysisType::None:
-      continue;
-    case DataFlowAnalysisType::IFDSUninitializedVariables:
-      executeIFDSUninitVar(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSConstAnalysis:
-      executeIFDSConst(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSTaintAnalysis:
-      executeIFDSTaint(Data);
-      continue;
-    case DataFlowAnalysisType::IDEExtendedTaintAnalysis:
-      executeIDEXTaint(Data);
-      continue;
-    case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis:
-      executeIDEOpenSSLTS(Data);
-      continue;
-    case DataFlowAnalysisType::IDECSTDIOTypeStateAnalysis:
-      executeIDECSTDIOTS(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSTypeAnalysis:
-      executeIFDSType(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSSolverTest:
-      executeIFDSSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::IDELinearConstantAnalysis:
-      executeIDELinearConst(Data);
-      continue;
-    case DataFlowAnalysisType::IDESolverTest:
-      executeIDESolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::IDEInstInteractionAnalysis:
-      executeIDEIIA(Data);
-      continue;
-    case DataFlowAnalysisType::IntraMonoFullConstantPropagation:
-      executeIntraMonoFullConstant(Data);
-      continue;
-    case DataFlowAnalysisType::IntraMonoSolverTest:
-      executeIntraMonoSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::InterMonoSolverTest:
-      executeInterMonoSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::InterMonoTaintAnalysis:
-      executeInterMonoTaint(Data);
+    if (DataFlowAnalysis == DataFlowAnalysisType::None) {
       continue;
     }
+    auto &Run = Runs.emplace_back();
+    Run.Data = Data;
+    Run.Data.DataFlowAnalyses = {DataFlowAnalysis};
+    Run.DataFlowAnalysis = DataFlowAnalysis;
+    if (!Data.ResultDirectory.empty()) {
+      Run.Data.ResultDirectory /= toString(DataFlowAnalysis);
+      std::filesystem::create_directory(Run.Data.ResultDirectory);
+    }
+  }
 
-    llvm_unreachable("All possible DataFlowAnalysisType variants should be "
-                     "handled in the switch above!");
+  std::vector<std::thread> Threads;
+  Threads.reserve(Runs.size());
+  for (auto &Run : Runs) {
+    Threads.emplace_back([&Run] {
+      llvm::raw_string_ostream OS(Run.Output);
+      Run.Data.ResultStream = &OS;
+      try {
+        std::optional<Timer> MeasureTime;
+        if (Run.Data.EmitterOptions &
+            AnalysisControllerEmitterOptions::EmitStatisticsAsText) {
+          MeasureTime.emplace([&OS](auto Elapsed) {
+            OS << "Total elapsed: " << hms{Elapsed} << '\n';
+          });
+        }
+        executeDataFlowAnalysis(Run.Data, Run.DataFlowAnalysis);
+      } catch (...) {
+        Run.Error = std::current_exception();
+      }
+      Run.Data.ResultStream = nullptr;
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  for (auto &Run : Runs) {
+    if (Run.Error) {
+      std::rethrow_exception(Run.Error);
+    }
+
+    if (Data.ResultDirectory.empty()) {
+      Data.getResultStream() << "=== " << Run.DataFlowAnalysis << " ===\n"
+                             << Run.Output;
+    } else if (!Run.Output.empty()) {
+      if (auto OFS = openFileStream(Run.Data.ResultDirectory.string() +
+                                    "/psr-statistics.txt")) {
+        *OFS << Run.Output;
+      }
+    }
+  }
+}
+
+static void executeWholeProgram(AnalysisController &Data) {
+  if (Data.ParallelAnalyses) {
+    executeWholeProgramParallel(Data);
+    return;
+  }
+
+  for (auto DataFlowAnalysis : Data.DataFlowAnalyses) {
+    executeDataFlowAnalysis(Data, DataFlowAnalysis);
   }
 }
 
@@ -15,11 +15,45 @@
 #include "phasar/PhasarLLVM/HelperAnalyses.h"
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
 
+#include "llvm/Support/raw_ostream.h"
+
 #include "AnalysisControllerEmitterOptions.h"
 
+#include "llvm/ADT/DenseMap.h"
+
 #include <filesystem>
+#include <string>
+#include <vector>
+
+namespace llvm {
+class Instruction;
+} // namespace llvm
+
 namespace psr {
 
+/// The data-flow facts that hold at each instruction, converted to strings,
+/// s.t. they can still be queried after the solver has been destroyed
+struct PrintedAnalysisResults {
+  struct Entry {
+    std::string Fact;
+    /// The PhASAR id of the fact, if it is an LLVM value
+    std::string FactId;
+    std::string Value;
+  };
+
+  llvm::DenseMap<const llvm::Instruction *, std::vector<Entry>> ResultsAt;
+  /// Only IFDS/IDE analyses fill the ResultsAt
+  bool Available = false;
+
+  [[nodiscard]] size_t getNumEntries() const noexcept {
+    size_t Ret = 0;
+    for (const auto &[Inst, Entries] : ResultsAt) {
+      Ret += Entries.size();
+    }
+    return Ret;
+  }
+};
+
 struct AnalysisController {
   HelperAnalyses *HA{};
   std::vector<DataFlowAnalysisType> DataFlowAnalyses;
@@ -31,6 +65,18 @@ struct AnalysisController {
   IFDSIDESolverConfig SolverConfig{};
   std::string ProjectID = "default-phasar-project";
   std::filesystem::path ResultDirectory;
+  /// Run the DataFlowAnalyses on separate threads, sharing the frozen helper
+  /// analyses
+  bool ParallelAnalyses = false;
+  /// Where to write results to that do not go into the ResultDirectory;
+  /// defaults to stdout
+  llvm::raw_ostream *ResultStream = nullptr;
+  /// If set, the results of the DataFlowAnalyses are stored here after solving
+  PrintedAnalysisResults *ResultsSink = nullptr;
+
+  [[nodiscard]] llvm::raw_ostream &getResultStream() const {
+    return ResultStream ? *ResultStream : llvm::outs();
+  }
 
   static constexpr bool
   needsToEmitPTA(AnalysisControllerEmitterOptions EmitterOptions) {
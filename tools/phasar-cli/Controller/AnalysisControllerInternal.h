@@ -25,6 +25,7 @@
 
 namespace psr {
 template <typename T, typename U> class IDESolver;
+template <typename T, typename U> class IFDSSolver;
 } // namespace psr
 
 namespace psr::controller {
@@ -63,10 +64,18 @@ static void statsEmitter(llvm::raw_ostream & /*OS*/, const T & /*Solver*/) {}
 template <typename T, typename U>
 static void statsEmitter(llvm::raw_ostream &OS, const IDESolver<T, U> &Solver);
 
+template <typename T>
+static void collectResults(AnalysisController & /*Data*/, T & /*Solver*/) {}
+template <typename T, typename U>
+static void collectResults(AnalysisController &Data, IDESolver<T, U> &Solver);
+template <typename T, typename U>
+static void collectResults(AnalysisController &Data, IFDSSolver<T, U> &Solver);
+
 template <typename T>
 static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
   auto EmitterOptions = Data.EmitterOptions;
   const auto &ResultDirectory = Data.ResultDirectory;
+  auto &OS = Data.getResultStream();
 
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitTextReport) {
     if (!ResultDirectory.empty()) {
@@ -75,7 +84,7 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.emitTextReport(*OFS);
       }
     } else {
-      Solver.emitTextReport(llvm::outs());
+      Solver.emitTextReport(OS);
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitGraphicalReport) {
@@ -85,7 +94,7 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.emitGraphicalReport(*OFS);
       }
     } else {
-      Solver.emitGraphicalReport(llvm::outs());
+      Solver.emitGraphicalReport(OS);
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitRawResults) {
@@ -95,15 +104,18 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.dumpResults(*OFS);
       }
     } else {
-      Solver.dumpResults(llvm::outs());
+      Solver.dumpResults(OS);
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitESGAsDot) {
-    llvm::outs() << "Front-end support for 'EmitESGAsDot' to be implemented\n";
+    OS << "Front-end support for 'EmitESGAsDot' to be implemented\n";
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitStatisticsAsText) {
 
-    statsEmitter(llvm::outs(), Solver);
+    statsEmitter(OS, Solver);
+  }
+  if (Data.ResultsSink) {
+    collectResults(Data, Solver);
   }
 }
 
@@ -12,9 +12,15 @@
 
 #include "phasar/DataFlow/IfdsIde/Solver/IDESolver.h"
 #include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+#include "phasar/Utils/Printer.h"
+
+#include "llvm/ADT/STLExtras.h"
 
 #include "AnalysisControllerInternal.h"
 
+#include <type_traits>
+
 namespace psr::controller {
 
 template <typename T, typename U>
@@ -23,6 +29,42 @@ static void statsEmitter(llvm::raw_ostream &OS, const IDESolver<T, U> &Solver) {
   Solver.printEdgeFunctionStatistics(OS);
 }
 
+template <typename T, typename U>
+static void collectResults(AnalysisController &Data, IDESolver<T, U> &Solver) {
+  using d_t = typename IDESolver<T, U>::d_t;
+  auto &Sink = *Data.ResultsSink;
+  auto Results = Solver.getSolverResults();
+
+  Sink.ResultsAt.clear();
+  for (const auto *Inst : Data.HA->getProjectIRDB().getAllInstructions()) {
+    auto FactsAt = Results.resultsAt(Inst, /*StripZero*/ true);
+    if (FactsAt.empty()) {
+      continue;
+    }
+
+    auto &Entries = Sink.ResultsAt[Inst];
+    Entries.reserve(FactsAt.size());
+    for (const auto &[Fact, Value] : FactsAt) {
+      auto &Entry = Entries.emplace_back();
+      Entry.Fact = DToString(Fact);
+      if constexpr (std::is_convertible_v<d_t, const llvm::Value *>) {
+        Entry.FactId = getMetaDataID(Fact);
+      }
+      Entry.Value = LToString(Value);
+    }
+    llvm::sort(Entries, [](const auto &LHS, const auto &RHS) {
+      return LHS.Fact < RHS.Fact;
+    });
+  }
+  Sink.Available = true;
+}
+
+template <typename T, typename U>
+static void collectResults(AnalysisController &Data, IFDSSolver<T, U> &Solver) {
+  collectResults(Data,
+                 static_cast<IDESolver<WithBinaryValueDomain<T>, U> &>(Solver));
+}
+
 template <typename SolverTy, typename ProblemTy, typename... ArgTys>
 static void executeIfdsIdeAnalysis(AnalysisController &Data, ArgTys &&...Args) {
   auto Problem =
@@ -32,8 +74,8 @@ static void executeIfdsIdeAnalysis(AnalysisController &Data, ArgTys &&...Args) {
     std::optional<Timer> MeasureTime;
     if (Data.EmitterOptions &
         AnalysisControllerEmitterOptions::EmitStatisticsAsText) {
-      MeasureTime.emplace([](auto Elapsed) {
-        llvm::outs() << "Elapsed: " << hms{Elapsed} << '\n';
+      MeasureTime.emplace([&OS = Data.getResultStream()](auto Elapsed) {
+        OS << "Elapsed: " << hms{Elapsed} << '\n';
       });
     }
 
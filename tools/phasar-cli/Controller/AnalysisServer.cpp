@@ -0,0 +1,336 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "AnalysisServer.h"
+
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Process.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+using namespace psr;
+
+namespace {
+
+// The error codes defined by JSON-RPC 2.0
+enum class ErrorCode : int {
+  ParseError = -32700,
+  InvalidRequest = -32600,
+  MethodNotFound = -32601,
+  InvalidParams = -32602,
+  InternalError = -32603,
+};
+
+class RequestError : public std::runtime_error {
+public:
+  RequestError(ErrorCode Code, const std::string &Message)
+      : std::runtime_error(Message), Code(Code) {}
+
+  [[nodiscard]] ErrorCode getCode() const noexcept { return Code; }
+
+private:
+  ErrorCode Code;
+};
+
+nlohmann::json makeError(ErrorCode Code, const std::string &Message) {
+  return {{"code", int(Code)}, {"message", Message}};
+}
+
+double toMillis(std::chrono::nanoseconds Duration) {
+  return std::chrono::duration<double, std::milli>(Duration).count();
+}
+
+/// Redirects stdout to stderr while alive, s.t. analyses that print to stdout
+/// directly cannot corrupt the responses
+class StdoutToStderrGuard {
+public:
+  StdoutToStderrGuard() {
+    flushStdout();
+    SavedStdout = ::dup(STDOUT_FILENO);
+    if (SavedStdout != -1 && ::dup2(STDERR_FILENO, STDOUT_FILENO) == -1) {
+      ::close(SavedStdout);
+      SavedStdout = -1;
+    }
+  }
+
+  StdoutToStderrGuard(const StdoutToStderrGuard &) = delete;
+  StdoutToStderrGuard &operator=(const StdoutToStderrGuard &) = delete;
+
+  ~StdoutToStderrGuard() {
+    flushStdout();
+    if (SavedStdout != -1) {
+      ::dup2(SavedStdout, STDOUT_FILENO);
+      ::close(SavedStdout);
+    }
+  }
+
+private:
+  static void flushStdout() {
+    llvm::outs().flush();
+    std::cout.flush();
+    std::fflush(stdout);
+  }
+
+  int SavedStdout = -1;
+};
+
+std::string getInstructionId(const nlohmann::json &Params) {
+  const auto &Id = Params.at("instruction");
+  if (Id.is_number_unsigned()) {
+    return std::to_string(Id.get<size_t>());
+  }
+  return Id.get<std::string>();
+}
+
+} // namespace
+
+AnalysisServer::AnalysisServer(AnalysisController &Data)
+    : Data(Data), StartTime(std::chrono::steady_clock::now()) {}
+
+void AnalysisServer::serve(std::istream &IS, llvm::raw_ostream &OS) {
+  std::string Line;
+  while (!Shutdown && std::getline(IS, Line)) {
+    if (llvm::StringRef(Line).trim().empty()) {
+      continue;
+    }
+
+    auto Response = handleRequest(Line);
+    // Notifications do not get a response
+    if (!Response.is_null()) {
+      // The IR may contain strings that are not valid UTF-8
+      OS << Response.dump(-1, ' ', false,
+                          nlohmann::json::error_handler_t::replace)
+         << '\n';
+      OS.flush();
+    }
+  }
+}
+
+nlohmann::json AnalysisServer::handleRequest(llvm::StringRef Request) {
+  auto Start = std::chrono::steady_clock::now();
+  auto MallocBefore = llvm::sys::Process::GetMallocUsage();
+  ++NumRequests;
+
+  nlohmann::json Response = {{"jsonrpc", "2.0"}, {"id", nullptr}};
+  bool IsNotification = false;
+  try {
+    auto Req = nlohmann::json::parse(Request.begin(), Request.end());
+    if (!Req.is_object() || !Req.contains("method") ||
+        !Req["method"].is_string()) {
+      throw RequestError(ErrorCode::InvalidRequest,
+                         "A request must be an object with a method");
+    }
+    IsNotification = !Req.contains("id");
+    if (!IsNotification) {
+      Response["id"] = Req["id"];
+    }
+
+    auto Result = dispatch(Req["method"].get<std::string>(),
+                           Req.value("params", nlohmann::json::object()));
+
+    auto Elapsed = std::chrono::steady_clock::now() - Start;
+    auto MallocAfter = llvm::sys::Process::GetMallocUsage();
+    Result["stats"] = {
+        {"latencyMs", toMillis(Elapsed)},
+        {"mallocBytes", MallocAfter},
+        {"mallocDeltaBytes", int64_t(MallocAfter) - int64_t(MallocBefore)},
+    };
+    Response["result"] = std::move(Result);
+  } catch (const nlohmann::json::parse_error &Err) {
+    Response["error"] = makeError(ErrorCode::ParseError, Err.what());
+  } catch (const RequestError &Err) {
+    Response["error"] = makeError(Err.getCode(), Err.what());
+  } catch (const nlohmann::json::exception &Err) {
+    // Missing or mistyped parameters
+    Response["error"] = makeError(ErrorCode::InvalidParams, Err.what());
+  } catch (const std::exception &Err) {
+    Response["error"] = makeError(ErrorCode::InternalError, Err.what());
+  }
+
+  auto Elapsed = std::chrono::steady_clock::now() - Start;
+  TotalLatency += Elapsed;
+  MaxLatency = std::max<std::chrono::nanoseconds>(MaxLatency, Elapsed);
+  if (Response.contains("error")) {
+    ++NumFailedRequests;
+  } else if (IsNotification) {
+    return nullptr;
+  }
+  return Response;
+}
+
+nlohmann::json AnalysisServer::dispatch(const std::string &Method,
+                                        const nlohmann::json &Params) {
+  if (Method == "runAnalysis") {
+    return runAnalysis(Params);
+  }
+  if (Method == "getResults") {
+    return getResults(Params);
+  }
+  if (Method == "hasFact") {
+    return hasFact(Params);
+  }
+  if (Method == "getStats") {
+    return getStats();
+  }
+  if (Method == "shutdown") {
+    Shutdown = true;
+    return nlohmann::json::object();
+  }
+  throw RequestError(ErrorCode::MethodNotFound, "Unknown method: " + Method);
+}
+
+const PrintedAnalysisResults &
+AnalysisServer::getOrRunAnalysis(const nlohmann::json &Params, bool *WasCached,
+                                 std::string *Output) {
+  auto Name = Params.at("analysis").get<std::string>();
+  auto DataFlowAnalysis = toDataFlowAnalysisType(Name);
+  if (DataFlowAnalysis == DataFlowAnalysisType::None) {
+    throw RequestError(ErrorCode::InvalidParams,
+                       "Unknown data-flow analysis: " + Name);
+  }
+
+  auto Config = Params.value("config", std::string());
+  if (Config.empty() && !Data.AnalysisConfigs.empty()) {
+    Config = Data.AnalysisConfigs.front();
+  }
+  if (!Config.empty() && !std::filesystem::is_regular_file(Config)) {
+    throw RequestError(ErrorCode::InvalidParams,
+                       "Analysis configuration '" + Config +
+                           "' does not exist");
+  }
+
+  auto [It, Inserted] = Cache.try_emplace({DataFlowAnalysis, Config});
+  bool Rerun = Params.value("rerun", false);
+  if (WasCached) {
+    *WasCached = !Inserted && !Rerun;
+  }
+  if (!Inserted && !Rerun) {
+    return It->second;
+  }
+
+  It->second = PrintedAnalysisResults();
+  auto Run = Data;
+  Run.DataFlowAnalyses = {DataFlowAnalysis};
+  Run.AnalysisConfigs = {Config};
+  Run.ParallelAnalyses = false;
+  Run.ResultsSink = &It->second;
+
+  // stdout is reserved for the responses
+  std::string Buffer;
+  llvm::raw_string_ostream OS(Buffer);
+  Run.ResultStream = &OS;
+  try {
+    StdoutToStderrGuard Guard;
+    Run.run();
+  } catch (...) {
+    Cache.erase(It);
+    throw;
+  }
+
+  if (Output) {
+    *Output = std::move(Buffer);
+  }
+  return It->second;
+}
+
+const std::vector<PrintedAnalysisResults::Entry> &
+AnalysisServer::resultsAt(const PrintedAnalysisResults &Results,
+                          const nlohmann::json &Params) const {
+  if (!Results.Available) {
+    throw RequestError(ErrorCode::InvalidParams,
+                       "The results of this analysis cannot be queried; only "
+                       "IFDS and IDE analyses are supported");
+  }
+
+  auto Id = getInstructionId(Params);
+  size_t NumericId{};
+  if (llvm::StringRef(Id).getAsInteger(10, NumericId)) {
+    throw RequestError(ErrorCode::InvalidParams,
+                       "Invalid instruction id: " + Id);
+  }
+  const auto *Inst = Data.HA->getProjectIRDB().getInstruction(NumericId);
+  if (!Inst) {
+    throw RequestError(ErrorCode::InvalidParams,
+                       "No instruction with id " + Id);
+  }
+
+  static const std::vector<PrintedAnalysisResults::Entry> Empty;
+  auto It = Results.ResultsAt.find(Inst);
+  return It != Results.ResultsAt.end() ? It->second : Empty;
+}
+
+nlohmann::json AnalysisServer::runAnalysis(const nlohmann::json &Params) {
+  bool WasCached = false;
+  std::string Output;
+  const auto &Results = getOrRunAnalysis(Params, &WasCached, &Output);
+  return {
+      {"analysis", Params.at("analysis")},
+      {"cached", WasCached},
+      {"queryable", Results.Available},
+      {"numResults", Results.getNumEntries()},
+      {"output", std::move(Output)},
+  };
+}
+
+nlohmann::json AnalysisServer::getResults(const nlohmann::json &Params) {
+  const auto &Entries = resultsAt(getOrRunAnalysis(Params), Params);
+
+  auto Facts = nlohmann::json::array();
+  for (const auto &Entry : Entries) {
+    nlohmann::json Fact = {{"fact", Entry.Fact}, {"value", Entry.Value}};
+    if (!Entry.FactId.empty()) {
+      Fact["id"] = Entry.FactId;
+    }
+    Facts.push_back(std::move(Fact));
+  }
+  return {{"instruction", getInstructionId(Params)}, {"facts", Facts}};
+}
+
+nlohmann::json AnalysisServer::hasFact(const nlohmann::json &Params) {
+  const auto &Entries = resultsAt(getOrRunAnalysis(Params), Params);
+  auto Fact = Params.at("fact").get<std::string>();
+
+  for (const auto &Entry : Entries) {
+    if (Entry.Fact == Fact || (!Entry.FactId.empty() && Entry.FactId == Fact)) {
+      return {{"holds", true}, {"value", Entry.Value}};
+    }
+  }
+  return {{"holds", false}};
+}
+
+nlohmann::json AnalysisServer::getStats() const {
+  auto Cached = nlohmann::json::array();
+  for (const auto &[Key, Results] : Cache) {
+    Cached.push_back({
+        {"analysis", toString(Key.first)},
+        {"config", Key.second},
+        {"numResults", Results.getNumEntries()},
+    });
+  }
+
+  return {
+      {"requests", NumRequests},
+      {"failedRequests", NumFailedRequests},
+      {"avgLatencyMs",
+       NumRequests ? toMillis(TotalLatency) / double(NumRequests) : 0.0},
+      {"maxLatencyMs", toMillis(MaxLatency)},
+      {"uptimeMs", toMillis(std::chrono::steady_clock::now() - StartTime)},
+      {"cachedAnalyses", std::move(Cached)},
+  };
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_CONTROLLER_ANALYSISSERVER_H
+#define PHASAR_CONTROLLER_ANALYSISSERVER_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "nlohmann/json.hpp"
+
+#include "AnalysisController.h"
+
+#include <chrono>
+#include <istream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// Keeps the helper analyses and the results of previously run data-flow
+/// analyses resident and answers requests against them.
+///
+/// Requests are JSON-RPC 2.0 messages, one per line. The supported methods
+/// are:
+///
+///  - runAnalysis {analysis, config?, rerun?}: Runs the data-flow analysis
+///    (e.g. "ifds-taint") unless its results are already cached and returns its
+///    textual output
+///  - getResults {analysis, config?, instruction}: The facts, together with
+///    their edge values, that hold at the instruction with the given PhASAR id
+///  - hasFact {analysis, config?, instruction, fact}: Whether the fact, given
+///    either as its PhASAR id or in its printed form, holds at the instruction
+///  - getStats {}: Statistics over all requests so far
+///  - shutdown {}: Stops serving
+///
+/// Every result carries a "stats" object with the latency of the request and
+/// the heap usage afterwards.
+class AnalysisServer {
+public:
+  /// Data provides the helper analyses and the options for running analyses
+  explicit AnalysisServer(AnalysisController &Data);
+
+  /// Answers requests from IS on OS until IS is exhausted or a shutdown
+  /// request has been received
+  void serve(std::istream &IS, llvm::raw_ostream &OS);
+
+  /// Handles a single request and returns the response
+  [[nodiscard]] nlohmann::json handleRequest(llvm::StringRef Request);
+
+  [[nodiscard]] bool isShutdown() const noexcept { return Shutdown; }
+
+private:
+  nlohmann::json dispatch(const std::string &Method,
+                          const nlohmann::json &Params);
+
+  nlohmann::json runAnalysis(const nlohmann::json &Params);
+  nlohmann::json getResults(const nlohmann::json &Params);
+  nlohmann::json hasFact(const nlohmann::json &Params);
+  nlohmann::json getStats() const;
+
+  /// Runs the requested analysis if it is not cached, yet
+  const PrintedAnalysisResults &getOrRunAnalysis(const nlohmann::json &Params,
+                                                 bool *WasCached = nullptr,
+                                                 std::string *Output = nullptr);
+  const std::vector<PrintedAnalysisResults::Entry> &
+  resultsAt(const PrintedAnalysisResults &Results,
+            const nlohmann::json &Params) const;
+
+  AnalysisController &Data;
+  /// (analysis, config) -> results
+  std::map<std::pair<DataFlowAnalysisType, std::string>,
+           PrintedAnalysisResults>
+      Cache;
+
+  size_t NumRequests = 0;
+  size_t NumFailedRequests = 0;
+  std::chrono::nanoseconds TotalLatency{};
+  std::chrono::nanoseconds MaxLatency{};
+  std::chrono::steady_clock::time_point StartTime;
+  bool Shutdown = false;
+};
+
+} // namespace psr
+
+#endif // PHASAR_CONTROLLER_ANALYSISSERVER_H
@@ -25,11 +25,14 @@
 
 #include "Controller/AnalysisController.h"
 #include "Controller/AnalysisControllerEmitterOptions.h"
+#include "Controller/AnalysisServer.h"
 
 #include <cstdlib>
 #include <filesystem>
 #include <initializer_list>
+#include <iostream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 using namespace psr;
@@ -212,6 +215,13 @@ PSR_OPTION_FLAG(EmitPTAAsJsonOpt, "emit-pta-as-json",
                 "Emit the points-to information as json");
 PSR_OPTION_FLAG(EmitStatsAsJsonOpt, "emit-statistics-as-json",
                 "Emit the statistics information as json");
+PSR_OPTION_FLAG(ParallelAnalysesOpt, "parallel-analyses",
+                "Run the selected data-flow analyses concurrently on separate "
+                "threads; the results of each analysis are written to a "
+                "separate sub-directory of the output directory");
+PSR_OPTION_FLAG(ServerOpt, "server",
+                "Keep the helper analyses and analysis results resident and "
+                "answer JSON-RPC requests, one per line, on stdin/stdout");
 PSR_OPTION_FLAG(FollowReturnPastSeedsOpt, "follow-return-past-seeds",
                 "Let the IFDS/IDE Solver process unbalanced returns",
                 cl::init(true));
@@ -348,7 +358,7 @@ int main(int Argc, const char **Argv) {
 #endif
 
   // Vanity header
-  if (!SilentOpt) {
+  if (!SilentOpt && !ServerOpt) {
     llvm::outs() << "PhASAR " << PhasarConfig::PhasarVersion()
                  << "\nA LLVM-based static analysis framework\n\n";
   }
@@ -477,6 +487,7 @@ int main(int Argc, const char **Argv) {
       SolverConfig,
       ProjectIdOpt.getValue(),
       OutDirOpt.getValue(),
+      ParallelAnalysesOpt,
   };
   if (!OutDirOpt.empty()) {
     // create directory for results
@@ -485,6 +496,16 @@ int main(int Argc, const char **Argv) {
     std::filesystem::create_directory(Controller.ResultDirectory);
   }
 
+  if (ServerOpt) {
+    // Pay for the helper analyses before the first request arrives
+    std::ignore = HA.getICFG();
+    std::ignore = HA.getAliasInfo();
+
+    AnalysisServer Server(Controller);
+    Server.serve(std::cin, llvm::outs());
+    return 0;
+  }
+
   Controller.emitRequestedHelperAnalysisResults();
   Controller.run();
   return 0;
@@ -0,0 +1,117 @@
+#include "phasar/AnalysisStrategy/Strategies.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "Controller/AnalysisController.h"
+#include "Controller/AnalysisControllerEmitterOptions.h"
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+const std::vector<std::string> EntryPoints = {"main"};
+
+const std::vector<DataFlowAnalysisType> DataFlowAnalyses = {
+    DataFlowAnalysisType::IFDSUninitializedVariables,
+    DataFlowAnalysisType::IFDSConstAnalysis,
+    DataFlowAnalysisType::IFDSTypeAnalysis,
+    DataFlowAnalysisType::IDELinearConstantAnalysis,
+};
+
+/// Runs the DataFlowAnalyses on HA and returns the raw results they print
+std::string runAnalyses(HelperAnalyses &HA,
+                        std::vector<DataFlowAnalysisType> Analyses,
+                        bool Parallel) {
+  std::string Output;
+  llvm::raw_string_ostream OS(Output);
+
+  AnalysisController Controller{};
+  Controller.HA = &HA;
+  Controller.DataFlowAnalyses = std::move(Analyses);
+  Controller.EntryPoints = EntryPoints;
+  Controller.Strategy = AnalysisStrategy::WholeProgram;
+  Controller.EmitterOptions = AnalysisControllerEmitterOptions::EmitRawResults;
+  Controller.ParallelAnalyses = Parallel;
+  Controller.ResultStream = &OS;
+  Controller.run();
+
+  OS.flush();
+  return Output;
+}
+
+/// The solvers print the facts at an instruction in no particular order, so
+/// only compare the sorted lines
+std::vector<std::string> sortedLines(llvm::StringRef Output) {
+  llvm::SmallVector<llvm::StringRef> Lines;
+  Output.split(Lines, '\n');
+  std::vector<std::string> Ret(Lines.begin(), Lines.end());
+  llvm::sort(Ret);
+  return Ret;
+}
+
+class ParallelAnalysesTest
+    : public ::testing::TestWithParam<std::string_view> {};
+
+TEST_P(ParallelAnalysesTest, SameResultsAsSequential) {
+  auto IRFile = PHASAR_BUILD_SUBFOLDER("").str() + std::string(GetParam());
+
+  // The parallel analyses share frozen helper analyses; the sequential ones
+  // compute them lazily
+  HelperAnalyses ParallelHA(IRFile, EntryPoints);
+  auto ParallelOutput =
+      runAnalyses(ParallelHA, DataFlowAnalyses, /*Parallel*/ true);
+  EXPECT_TRUE(ParallelHA.getAliasInfo().isFrozen());
+
+  llvm::StringRef Remaining = ParallelOutput;
+  for (size_t I = 0, End = DataFlowAnalyses.size(); I != End; ++I) {
+    auto Analysis = DataFlowAnalyses[I];
+    auto Header = "=== " + toString(Analysis) + " ===\n";
+    ASSERT_TRUE(Remaining.consume_front(Header))
+        << "Missing results of " << toString(Analysis);
+
+    auto Section = Remaining;
+    if (I + 1 != End) {
+      auto NextHeader = "=== " + toString(DataFlowAnalyses[I + 1]) + " ===\n";
+      auto Pos = Remaining.find(NextHeader);
+      ASSERT_NE(llvm::StringRef::npos, Pos);
+      Section = Remaining.take_front(Pos);
+    }
+    Remaining = Remaining.drop_front(Section.size());
+
+    HelperAnalyses SequentialHA(IRFile, EntryPoints);
+    auto SequentialOutput =
+        runAnalyses(SequentialHA, {Analysis}, /*Parallel*/ false);
+    EXPECT_FALSE(SequentialOutput.empty());
+    EXPECT_EQ(sortedLines(SequentialOutput), sortedLines(Section))
+        << "Different results of " << toString(Analysis);
+  }
+  EXPECT_TRUE(Remaining.empty());
+}
+
+static constexpr std::string_view IRFiles[] = {
+    "linear_constant/global_08_cpp_dbg.ll",
+    "pointers/call_01_cpp.ll",
+    "uninitialized_variables/growing_example_cpp_dbg.ll",
+};
+
+INSTANTIATE_TEST_SUITE_P(AnalysisControllerTest, ParallelAnalysesTest,
+                         ::testing::ValuesIn(IRFiles));
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,224 @@
+#include "phasar/AnalysisStrategy/Strategies.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "Controller/AnalysisController.h"
+#include "Controller/AnalysisServer.h"
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+// The error codes defined by JSON-RPC 2.0
+constexpr int ParseError = -32700;
+constexpr int InvalidRequest = -32600;
+constexpr int MethodNotFound = -32601;
+constexpr int InvalidParams = -32602;
+
+class AnalysisServerTest : public ::testing::Test {
+protected:
+  static constexpr auto PathToLlFiles =
+      PHASAR_BUILD_SUBFOLDER("uninitialized_variables/");
+  const std::vector<std::string> EntryPoints = {"main"};
+
+  std::unique_ptr<HelperAnalyses> HA;
+  AnalysisController Controller{};
+  std::unique_ptr<AnalysisServer> Server;
+
+  void SetUp() override {
+    HA = std::make_unique<HelperAnalyses>(
+        PathToLlFiles.str() + "binop_uninit_cpp_dbg.ll", EntryPoints);
+    Controller.HA = HA.get();
+    Controller.EntryPoints = EntryPoints;
+    Controller.Strategy = AnalysisStrategy::WholeProgram;
+    Controller.EmitterOptions =
+        AnalysisControllerEmitterOptions::EmitRawResults;
+    Server = std::make_unique<AnalysisServer>(Controller);
+  }
+
+  nlohmann::json request(const std::string &Method,
+                         const nlohmann::json &Params = nullptr) {
+    nlohmann::json Req = {{"jsonrpc", "2.0"}, {"id", ++LastId}};
+    Req["method"] = Method;
+    if (!Params.is_null()) {
+      Req["params"] = Params;
+    }
+    auto Response = Server->handleRequest(Req.dump());
+    EXPECT_EQ(LastId, Response.value("id", 0));
+    return Response;
+  }
+
+  static void expectError(const nlohmann::json &Response, int Code) {
+    ASSERT_TRUE(Response.contains("error")) << Response.dump();
+    EXPECT_FALSE(Response.contains("result"));
+    EXPECT_EQ(Code, Response["error"]["code"].get<int>()) << Response.dump();
+  }
+
+  static nlohmann::json expectResult(const nlohmann::json &Response) {
+    EXPECT_TRUE(Response.contains("result")) << Response.dump();
+    EXPECT_FALSE(Response.contains("error")) << Response.dump();
+    return Response.value("result", nlohmann::json::object());
+  }
+
+  int LastId = 0;
+};
+
+TEST_F(AnalysisServerTest, MalformedRequests) {
+  expectError(Server->handleRequest("{\"jsonrpc\": \"2.0\", \"id\": "),
+              ParseError);
+  expectError(Server->handleRequest("[1, 2, 3]"), InvalidRequest);
+  expectError(Server->handleRequest(R"({"jsonrpc": "2.0", "id": 1})"),
+              InvalidRequest);
+  expectError(
+      Server->handleRequest(R"({"jsonrpc": "2.0", "id": 1, "method": 42})"),
+      InvalidRequest);
+
+  auto Stats = expectResult(request("getStats"));
+  EXPECT_EQ(5U, Stats["requests"].get<size_t>());
+  EXPECT_EQ(4U, Stats["failedRequests"].get<size_t>());
+}
+
+TEST_F(AnalysisServerTest, UnknownMethod) {
+  expectError(request("solveEverything"), MethodNotFound);
+}
+
+TEST_F(AnalysisServerTest, InvalidParams) {
+  // Missing analysis
+  expectError(request("runAnalysis", nlohmann::json::object()), InvalidParams);
+  expectError(request("runAnalysis", {{"analysis", 42}}), InvalidParams);
+  expectError(request("runAnalysis", {{"analysis", "ifds-everything"}}),
+              InvalidParams);
+  expectError(request("runAnalysis", {{"analysis", "ifds-uninit"},
+                                      {"config", "/does/not/exist.json"}}),
+              InvalidParams);
+
+  // Missing or invalid instruction
+  expectError(request("getResults", {{"analysis", "ifds-uninit"}}),
+              InvalidParams);
+  expectError(request("getResults",
+                      {{"analysis", "ifds-uninit"}, {"instruction", "abc"}}),
+              InvalidParams);
+  expectError(request("getResults",
+                      {{"analysis", "ifds-uninit"}, {"instruction", 100000}}),
+              InvalidParams);
+
+  // Missing fact
+  expectError(request("hasFact",
+                      {{"analysis", "ifds-uninit"}, {"instruction", 6}}),
+              InvalidParams);
+}
+
+TEST_F(AnalysisServerTest, Notification) {
+  auto Response = Server->handleRequest(
+      R"({"jsonrpc": "2.0", "method": "getStats"})");
+  EXPECT_TRUE(Response.is_null());
+
+  // Errors are reported even for notifications
+  expectError(Server->handleRequest(R"({"jsonrpc": "2.0", "method": "foo"})"),
+              MethodNotFound);
+}
+
+TEST_F(AnalysisServerTest, QueryResults) {
+  // binop_uninit uses the uninitialized variable i, i.e., %2 with ID 1, in
+  // %4 = load i32, i32* %2 with ID 6
+  auto Holds = expectResult(request(
+      "hasFact",
+      {{"analysis", "ifds-uninit"}, {"instruction", 6}, {"fact", "1"}}));
+  EXPECT_TRUE(Holds["holds"].get<bool>());
+
+  auto NotHolds = expectResult(request(
+      "hasFact",
+      {{"analysis", "ifds-uninit"}, {"instruction", 6}, {"fact", "6"}}));
+  EXPECT_FALSE(NotHolds["holds"].get<bool>());
+
+  auto Results = expectResult(
+      request("getResults", {{"analysis", "ifds-uninit"}, {"instruction", 6}}));
+  EXPECT_EQ("6", Results["instruction"].get<std::string>());
+  bool Found = false;
+  for (const auto &Fact : Results["facts"]) {
+    Found |= Fact.value("id", "") == "1";
+  }
+  EXPECT_TRUE(Found) << Results.dump();
+}
+
+TEST_F(AnalysisServerTest, CacheHitAndInvalidation) {
+  const nlohmann::json Params = {{"analysis", "ifds-uninit"}};
+
+  auto First = expectResult(request("runAnalysis", Params));
+  EXPECT_FALSE(First["cached"].get<bool>());
+  EXPECT_TRUE(First["queryable"].get<bool>());
+  EXPECT_NE(0U, First["numResults"].get<size_t>());
+  EXPECT_FALSE(First["output"].get<std::string>().empty());
+
+  auto Second = expectResult(request("runAnalysis", Params));
+  EXPECT_TRUE(Second["cached"].get<bool>());
+  EXPECT_EQ(First["numResults"], Second["numResults"]);
+  // Only a run produces output
+  EXPECT_TRUE(Second["output"].get<std::string>().empty());
+
+  auto RerunParams = Params;
+  RerunParams["rerun"] = true;
+  auto Rerun = expectResult(request("runAnalysis", RerunParams));
+  EXPECT_FALSE(Rerun["cached"].get<bool>());
+  EXPECT_EQ(First["numResults"], Rerun["numResults"]);
+  EXPECT_EQ(First["output"], Rerun["output"]);
+
+  auto Stats = expectResult(request("getStats"));
+  ASSERT_EQ(1U, Stats["cachedAnalyses"].size());
+  EXPECT_EQ("ifds-uninit",
+            Stats["cachedAnalyses"][0]["analysis"].get<std::string>());
+}
+
+TEST_F(AnalysisServerTest, AnalysisDoesNotWriteToStdout) {
+  ::testing::internal::CaptureStdout();
+  auto Result = expectResult(
+      request("runAnalysis", {{"analysis", "ide-lca"}, {"rerun", true}}));
+  llvm::outs() << "response\n";
+  llvm::outs().flush();
+  auto Stdout = ::testing::internal::GetCapturedStdout();
+
+  EXPECT_FALSE(Result["output"].get<std::string>().empty());
+  EXPECT_EQ("response\n", Stdout);
+}
+
+TEST_F(AnalysisServerTest, Serve) {
+  std::istringstream IS(
+      R"({"jsonrpc": "2.0", "id": 1, "method": "getStats"})"
+      "\n\n"
+      R"({"jsonrpc": "2.0", "method": "getStats"})"
+      "\n"
+      R"({"jsonrpc": "2.0", "id": 2, "method": "shutdown"})"
+      "\n"
+      R"({"jsonrpc": "2.0", "id": 3, "method": "getStats"})"
+      "\n");
+  std::string Output;
+  llvm::raw_string_ostream OS(Output);
+  Server->serve(IS, OS);
+  EXPECT_TRUE(Server->isShutdown());
+
+  // One response per request, except for the notification; no requests are
+  // handled after the shutdown
+  llvm::SmallVector<llvm::StringRef> Lines;
+  llvm::StringRef(Output).trim().split(Lines, '\n');
+  ASSERT_EQ(2U, Lines.size());
+  EXPECT_EQ(1, nlohmann::json::parse(Lines[0].str())["id"].get<int>());
+  EXPECT_EQ(2, nlohmann::json::parse(Lines[1].str())["id"].get<int>());
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -6,6 +6,9 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
 
 using namespace psr;
 using namespace std;
@@ -268,6 +271,66 @@ TEST(HexastoreTest, StoreGraphWithEdgeLabels) {
   ASSERT_TRUE(boost::isomorphism(I, J));
 }
 
+TEST(HexastoreTest, BulkLoadEqualsSinglePuts) {
+  std::vector<std::array<std::string, 3>> Edges;
+  for (int I = 0; I < 100; ++I) {
+    Edges.push_back({{"s" + std::to_string(I % 7), "p" + std::to_string(I % 3),
+                      "o" + std::to_string(I)}});
+  }
+
+  Hexastore Single("");
+  for (const auto &Edge : Edges) {
+    Single.put(Edge);
+  }
+
+  Hexastore Bulk("");
+  Bulk.beginBulkLoad(16);
+  ASSERT_TRUE(Bulk.isInBulkLoad());
+  Bulk.putAll(llvm::makeArrayRef(Edges).take_front(50));
+  // Uncommitted entries are visible within the same connection
+  EXPECT_EQ(50U, Bulk.get({{"?", "?", "?"}}).size());
+  Bulk.endBulkLoad();
+  Bulk.putAll(llvm::makeArrayRef(Edges).drop_front(50));
+
+  for (const auto &Query : {std::array<std::string, 3>{{"?", "?", "?"}},
+                            std::array<std::string, 3>{{"s3", "?", "?"}},
+                            std::array<std::string, 3>{{"?", "p1", "?"}},
+                            std::array<std::string, 3>{{"?", "?", "o42"}},
+                            std::array<std::string, 3>{{"s0", "p0", "?"}}}) {
+    EXPECT_EQ(Single.get(Query), Bulk.get(Query));
+  }
+}
+
+TEST(HexastoreTest, StreamingCursor) {
+  Hexastore H("");
+  H.putAll({{{"mary", "likes", "hexastores"}},
+            {{"mary", "likes", "apples"}},
+            {{"peter", "likes", "apples"}}});
+
+  auto Cursor = H.query({{"mary", "likes", "?"}});
+  // A second cursor of the same kind while the first one is still active
+  auto Other = H.query({{"peter", "likes", "?"}});
+
+  ASSERT_TRUE(Cursor.next());
+  EXPECT_EQ(HSResult("mary", "likes", "hexastores"), Cursor.get());
+  ASSERT_TRUE(Other.next());
+  EXPECT_EQ(HSResult("peter", "likes", "apples"), Other.get());
+  ASSERT_TRUE(Cursor.next());
+  EXPECT_EQ(HSResult("mary", "likes", "apples"), Cursor.get());
+  EXPECT_FALSE(Cursor.next());
+  EXPECT_FALSE(Cursor.next());
+  EXPECT_FALSE(Other.next());
+}
+
+TEST(HexastoreTest, QuotesInEntries) {
+  Hexastore H("");
+  H.put({{"name", "\"quoted\"", "it's"}});
+
+  auto Result = H.get({{"name", "?", "?"}});
+  ASSERT_EQ(Result.size(), 1U);
+  EXPECT_EQ(Result[0], HSResult("name", "\"quoted\"", "it's"));
+}
+
 int main(int Argc, char **Argv) {
   ::testing::InitGoogleTest(&Argc, Argv);
   return RUN_ALL_TESTS();
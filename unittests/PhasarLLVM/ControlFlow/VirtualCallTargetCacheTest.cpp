@@ -0,0 +1,151 @@
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/VirtualCallTargetCache.h"
+
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+class VirtualCallTargetCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    auto *FunTy =
+        llvm::FunctionType::get(llvm::Type::getVoidTy(Ctx), /*isVarArg*/ false);
+    for (const auto *Name : {"f", "g", "h"}) {
+      Funs.push_back(llvm::Function::Create(
+          FunTy, llvm::GlobalValue::ExternalLinkage, Name, Mod));
+    }
+    A = llvm::StructType::create(Ctx, "struct.A");
+    B = llvm::StructType::create(Ctx, "struct.B");
+  }
+
+  llvm::LLVMContext Ctx;
+  llvm::Module Mod{"VirtualCallTargetCacheTest", Ctx};
+  std::vector<const llvm::Function *> Funs;
+  const llvm::StructType *A{};
+  const llvm::StructType *B{};
+};
+
+TEST_F(VirtualCallTargetCacheTest, MemoizesPerTypeAndIndex) {
+  VirtualCallTargetCache Cache;
+  unsigned NumComputed = 0;
+  auto Compute = [&] {
+    ++NumComputed;
+    // Sub-types may inherit the same implementation
+    return VirtualCallTargetCache::TargetListTy{Funs[1], Funs[0], Funs[1]};
+  };
+
+  auto Targets = Cache.getOrCompute(A, 0, Compute);
+  EXPECT_EQ(2, Targets->size());
+  EXPECT_EQ(1, llvm::count(*Targets, Funs[0]));
+  EXPECT_EQ(1, llvm::count(*Targets, Funs[1]));
+
+  auto Again = Cache.getOrCompute(A, 0, Compute);
+  EXPECT_EQ(Targets, Again);
+  EXPECT_EQ(1, NumComputed);
+
+  // Different index or type
+  std::ignore = Cache.getOrCompute(A, 1, Compute);
+  std::ignore = Cache.getOrCompute(B, 0, Compute);
+  EXPECT_EQ(3, NumComputed);
+  EXPECT_EQ(3, Cache.size());
+
+  auto Stats = Cache.getStats();
+  EXPECT_EQ(1, Stats.Hits);
+  EXPECT_EQ(3, Stats.Misses);
+  EXPECT_DOUBLE_EQ(0.25, Stats.getHitRate());
+}
+
+TEST_F(VirtualCallTargetCacheTest, ClearInvalidates) {
+  VirtualCallTargetCache Cache;
+  auto Old = Cache.getOrCompute(A, 0, [&] {
+    return VirtualCallTargetCache::TargetListTy{Funs[0]};
+  });
+  Cache.clear();
+  EXPECT_EQ(0, Cache.size());
+
+  auto Targets = Cache.getOrCompute(A, 0, [&] {
+    return VirtualCallTargetCache::TargetListTy{Funs[2]};
+  });
+  ASSERT_EQ(1, Targets->size());
+  EXPECT_EQ(Funs[2], Targets->front());
+  // Targets from before the clear() stay valid
+  ASSERT_EQ(1, Old->size());
+  EXPECT_EQ(Funs[0], Old->front());
+  // The counters survive clear()
+  EXPECT_EQ(2, Cache.getStats().Misses);
+}
+
+TEST_F(VirtualCallTargetCacheTest, ConcurrentAccess) {
+  VirtualCallTargetCache Cache;
+  std::atomic_size_t NumComputed{};
+  constexpr unsigned NumThreads = 8;
+  constexpr unsigned NumQueries = 1000;
+
+  std::vector<std::thread> Threads;
+  for (unsigned T = 0; T != NumThreads; ++T) {
+    Threads.emplace_back([&, T] {
+      for (unsigned I = 0; I != NumQueries; ++I) {
+        const auto *Ty = (I + T) % 2 ? A : B;
+        auto Targets = Cache.getOrCompute(Ty, I % 4, [&] {
+          NumComputed.fetch_add(1);
+          return VirtualCallTargetCache::TargetListTy{Funs[I % 3]};
+        });
+        EXPECT_EQ(1, Targets->size());
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  EXPECT_EQ(8, Cache.size());
+  auto Stats = Cache.getStats();
+  EXPECT_EQ(NumThreads * NumQueries, Stats.Hits + Stats.Misses);
+  EXPECT_EQ(NumComputed.load(), Stats.Misses);
+}
+
+TEST_F(VirtualCallTargetCacheTest, ConcurrentClear) {
+  VirtualCallTargetCache Cache;
+  constexpr unsigned NumThreads = 4;
+  constexpr unsigned NumQueries = 1000;
+
+  std::vector<std::thread> Threads;
+  for (unsigned T = 0; T != NumThreads; ++T) {
+    Threads.emplace_back([&, T] {
+      for (unsigned I = 0; I != NumQueries; ++I) {
+        if (T == 0 && I % 8 == 0) {
+          Cache.clear();
+          continue;
+        }
+        auto Targets = Cache.getOrCompute(I % 2 ? A : B, 0, [&] {
+          return VirtualCallTargetCache::TargetListTy{Funs[0], Funs[1]};
+        });
+        // Must not be freed by a concurrent clear()
+        EXPECT_EQ(2, Targets->size());
+        EXPECT_EQ(1, llvm::count(*Targets, Funs[1]));
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
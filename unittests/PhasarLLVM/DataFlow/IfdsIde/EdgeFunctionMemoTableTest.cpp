@@ -0,0 +1,174 @@
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionMemoTable.h"
+
+#include "phasar/DataFlow/IfdsIde/DefaultEdgeFunctionSingletonCache.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionUtils.h"
+
+#include "gtest/gtest.h"
+
+namespace psr::internal {
+struct AddEdgeFunction {
+  using l_t = int;
+
+  [[nodiscard]] int computeTarget(int Source) const { return Source + Val; }
+
+  static EdgeFunction<int> compose(EdgeFunctionRef<AddEdgeFunction> This,
+                                   const EdgeFunction<int> &SecondFunction) {
+    if (const auto *Add = SecondFunction.dyn_cast<AddEdgeFunction>()) {
+      return AddEdgeFunction{This->Val + Add->Val};
+    }
+    return AllBottom<int>{};
+  }
+
+  static EdgeFunction<int> join(EdgeFunctionRef<AddEdgeFunction> This,
+                                const EdgeFunction<int> &OtherFunction) {
+    if (const auto *Add = OtherFunction.dyn_cast<AddEdgeFunction>();
+        Add && Add->Val == This->Val) {
+      return This;
+    }
+    return AllBottom<int>{};
+  }
+
+  bool operator==(const AddEdgeFunction &Other) const noexcept {
+    return Val == Other.Val;
+  }
+
+  int Val;
+};
+
+struct HeapEdgeFunction {
+  using l_t = int;
+
+  HeapEdgeFunction(int Val) noexcept : Val(Val) {}
+  HeapEdgeFunction(const HeapEdgeFunction &Other) noexcept : Val(Other.Val) {
+    // Non-trivial copy ctor to prevent SOO
+  }
+
+  [[nodiscard]] int computeTarget(int Source) const { return Source + Val; }
+
+  static EdgeFunction<int> compose(EdgeFunctionRef<HeapEdgeFunction> This,
+                                   const EdgeFunction<int> & /*Second*/) {
+    return This;
+  }
+
+  static EdgeFunction<int> join(EdgeFunctionRef<HeapEdgeFunction> This,
+                                const EdgeFunction<int> & /*Other*/) {
+    return This;
+  }
+
+  bool operator==(const HeapEdgeFunction &Other) const noexcept {
+    return Val == Other.Val;
+  }
+
+  friend llvm::hash_code hash_value(const HeapEdgeFunction &EF) noexcept {
+    return llvm::hash_value(EF.Val);
+  }
+
+  int Val;
+};
+} // namespace psr::internal
+
+using namespace psr;
+using namespace psr::internal;
+
+namespace {
+auto makeCountingCompose(size_t &Counter) {
+  return [&Counter](const EdgeFunction<int> &F, const EdgeFunction<int> &G) {
+    ++Counter;
+    return F.composeWith(G);
+  };
+}
+} // namespace
+
+TEST(EdgeFunctionMemoTableTest, composeIsMemoized) {
+  EdgeFunctionMemoTable<int> Memo;
+  size_t NumComputed = 0;
+
+  EdgeFunction<int> F = AddEdgeFunction{1};
+  EdgeFunction<int> G = AddEdgeFunction{2};
+
+  auto R1 = Memo.compose(F, G, makeCountingCompose(NumComputed));
+  auto R2 = Memo.compose(F, G, makeCountingCompose(NumComputed));
+
+  EXPECT_EQ(1, NumComputed);
+  EXPECT_TRUE(R1.referenceEquals(R2));
+  EXPECT_EQ(4, R1.computeTarget(1));
+
+  auto Stats = Memo.getStats();
+  EXPECT_EQ(1, Stats.ComposeHits);
+  EXPECT_EQ(1, Stats.ComposeMisses);
+  EXPECT_EQ(0, Stats.JoinHits);
+  EXPECT_EQ(0, Stats.JoinMisses);
+}
+
+TEST(EdgeFunctionMemoTableTest, composeIsNotCommutative) {
+  EdgeFunctionMemoTable<int> Memo;
+  size_t NumComputed = 0;
+
+  EdgeFunction<int> F = AddEdgeFunction{1};
+  EdgeFunction<int> G = AddEdgeFunction{2};
+
+  std::ignore = Memo.compose(F, G, makeCountingCompose(NumComputed));
+  std::ignore = Memo.compose(G, F, makeCountingCompose(NumComputed));
+
+  EXPECT_EQ(2, NumComputed);
+}
+
+TEST(EdgeFunctionMemoTableTest, joinAndComposeAreSeparate) {
+  EdgeFunctionMemoTable<int> Memo;
+  size_t NumComputed = 0;
+
+  EdgeFunction<int> F = AddEdgeFunction{1};
+  EdgeFunction<int> G = AddEdgeFunction{2};
+
+  auto C = Memo.compose(F, G, makeCountingCompose(NumComputed));
+  auto J = Memo.join(F, G, [&](const auto &LHS, const auto &RHS) {
+    ++NumComputed;
+    return LHS.joinWith(RHS);
+  });
+
+  EXPECT_EQ(2, NumComputed);
+  EXPECT_TRUE(llvm::isa<AddEdgeFunction>(C));
+  EXPECT_TRUE(llvm::isa<AllBottom<int>>(J));
+}
+
+TEST(EdgeFunctionMemoTableTest, flushOnSizeLimit) {
+  EdgeFunctionMemoTable<int> Memo(2);
+  size_t NumComputed = 0;
+
+  EdgeFunction<int> F = AddEdgeFunction{0};
+  for (int I = 1; I <= 3; ++I) {
+    std::ignore = Memo.compose(F, AddEdgeFunction{I},
+                               makeCountingCompose(NumComputed));
+  }
+
+  EXPECT_EQ(3, NumComputed);
+  EXPECT_EQ(1, Memo.size());
+  EXPECT_EQ(1, Memo.getStats().NumFlushes);
+}
+
+TEST(EdgeFunctionMemoTableTest, singletonCachedEdgeFunctionsShareEntries) {
+  DefaultEdgeFunctionSingletonCache<HeapEdgeFunction> Cache;
+  EdgeFunctionMemoTable<int> Memo;
+  size_t NumComputed = 0;
+
+  EdgeFunction<int> G = AddEdgeFunction{2};
+
+  {
+    EdgeFunction<int> F = CachedEdgeFunction{HeapEdgeFunction{1}, &Cache};
+    std::ignore = Memo.compose(F, G, makeCountingCompose(NumComputed));
+  }
+  // The memo table keeps the cached edge function alive, so we get the very
+  // same object from the cache again
+  EdgeFunction<int> F = CachedEdgeFunction{HeapEdgeFunction{1}, &Cache};
+  std::ignore = Memo.compose(F, G, makeCountingCompose(NumComputed));
+
+  EXPECT_EQ(1, NumComputed);
+  EXPECT_EQ(1, Memo.getStats().ComposeHits);
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
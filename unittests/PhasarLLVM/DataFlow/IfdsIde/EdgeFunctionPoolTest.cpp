@@ -0,0 +1,169 @@
+#include "phasar/DataFlow/IfdsIde/EdgeFunctionPool.h"
+
+#include "phasar/DataFlow/IfdsIde/DefaultEdgeFunctionSingletonCache.h"
+#include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace psr::internal {
+struct PoolTestEdgeFunction {
+  using l_t = int;
+
+  PoolTestEdgeFunction(int Val) noexcept : Val(Val) {}
+  PoolTestEdgeFunction(const PoolTestEdgeFunction &Other) noexcept
+      : Val(Other.Val) {
+    // Non-trivial copy ctor to prevent SOO
+  }
+
+  [[nodiscard]] int computeTarget(int Source) const { return Source + Val; }
+
+  static EdgeFunction<int> compose(EdgeFunctionRef<PoolTestEdgeFunction> This,
+                                   const EdgeFunction<int> & /*Second*/) {
+    return This;
+  }
+
+  static EdgeFunction<int> join(EdgeFunctionRef<PoolTestEdgeFunction> This,
+                                const EdgeFunction<int> & /*Other*/) {
+    return This;
+  }
+
+  bool operator==(const PoolTestEdgeFunction &Other) const noexcept {
+    return Val == Other.Val;
+  }
+
+  friend llvm::hash_code hash_value(const PoolTestEdgeFunction &EF) noexcept {
+    return llvm::hash_value(EF.Val);
+  }
+
+  int Val;
+};
+} // namespace psr::internal
+
+using namespace psr;
+using namespace psr::internal;
+
+TEST(EdgeFunctionPoolTest, allocatesFromActivePool) {
+  EdgeFunctionPool Pool;
+
+  EdgeFunction<int> Outside = PoolTestEdgeFunction{1};
+  EXPECT_EQ(EdgeFunctionAllocationPolicy::DefaultHeapAllocated,
+            Outside.getAllocationPolicy());
+
+  EdgeFunctionPool::Scope PoolScope(&Pool);
+  EdgeFunction<int> Inside = PoolTestEdgeFunction{2};
+  EXPECT_EQ(EdgeFunctionAllocationPolicy::PoolAllocated,
+            Inside.getAllocationPolicy());
+  EXPECT_TRUE(Inside.isRefCounted());
+  EXPECT_FALSE(Inside.isCached());
+  EXPECT_EQ(44, Inside.computeTarget(42));
+
+  auto Stats = Pool.getStatistics();
+  EXPECT_EQ(1, Stats.NumAllocations);
+  EXPECT_EQ(1, Stats.NumLive);
+}
+
+TEST(EdgeFunctionPoolTest, reusesFreedBlocks) {
+  EdgeFunctionPool Pool;
+  EdgeFunctionPool::Scope PoolScope(&Pool);
+
+  const void *Addr = nullptr;
+  {
+    EdgeFunction<int> EF = PoolTestEdgeFunction{1};
+    Addr = EF.getOpaqueValue();
+  }
+  EXPECT_EQ(0, Pool.getStatistics().NumLive);
+
+  EdgeFunction<int> EF = PoolTestEdgeFunction{2};
+  EXPECT_EQ(Addr, EF.getOpaqueValue());
+  EXPECT_EQ(1, Pool.getStatistics().NumReused);
+}
+
+TEST(EdgeFunctionPoolTest, composePreservesPolicy) {
+  EdgeFunctionPool Pool;
+  EdgeFunctionPool::Scope PoolScope(&Pool);
+
+  EdgeFunction<int> EF = PoolTestEdgeFunction{1};
+  auto Composed = EF.composeWith(EF);
+
+  EXPECT_TRUE(Composed.referenceEquals(EF));
+  EXPECT_EQ(EdgeFunctionAllocationPolicy::PoolAllocated,
+            Composed.getAllocationPolicy());
+}
+
+TEST(EdgeFunctionPoolTest, cachedEdgeFunctionsBypassPool) {
+  DefaultEdgeFunctionSingletonCache<PoolTestEdgeFunction> Cache;
+  EdgeFunctionPool Pool;
+  EdgeFunctionPool::Scope PoolScope(&Pool);
+
+  EdgeFunction<int> EF = CachedEdgeFunction{PoolTestEdgeFunction{1}, &Cache};
+  EXPECT_TRUE(EF.isCached());
+  EXPECT_EQ(0, Pool.getStatistics().NumAllocations);
+}
+
+TEST(EdgeFunctionPoolTest, scopeEndsWithLifetime) {
+  EdgeFunctionPool Pool;
+  {
+    EdgeFunctionPool::Scope PoolScope(&Pool);
+    EXPECT_EQ(&Pool, EdgeFunctionPool::current());
+  }
+  EXPECT_EQ(nullptr, EdgeFunctionPool::current());
+
+  EdgeFunction<int> EF = PoolTestEdgeFunction{3};
+  EXPECT_EQ(EdgeFunctionAllocationPolicy::DefaultHeapAllocated,
+            EF.getAllocationPolicy());
+  EXPECT_EQ(0, Pool.getStatistics().NumAllocations);
+}
+
+TEST(EdgeFunctionPoolTest, destroyOnOtherThreads) {
+  constexpr int NumThreads = 4;
+  constexpr int NumEFsPerThread = 1000;
+
+  EdgeFunctionPool Pool;
+  EdgeFunctionPool::Scope PoolScope(&Pool);
+  std::vector<EdgeFunction<int>> EFs;
+  for (int I = 0; I < NumThreads * NumEFsPerThread; ++I) {
+    EFs.emplace_back(PoolTestEdgeFunction{I});
+  }
+
+  // Destroy the edge functions on other threads, while the owner allocates
+  // new edge functions from the same pool
+  std::vector<std::thread> Threads;
+  for (int T = 0; T < NumThreads; ++T) {
+    Threads.emplace_back([&EFs, T] {
+      for (int I = T * NumEFsPerThread; I < (T + 1) * NumEFsPerThread; ++I) {
+        auto Copy = EFs[I];
+        EFs[I] = nullptr;
+        EXPECT_EQ(2 * I, Copy.computeTarget(I));
+      }
+    });
+  }
+  std::vector<EdgeFunction<int>> OwnerEFs;
+  for (int I = 0; I < NumEFsPerThread; ++I) {
+    OwnerEFs.emplace_back(PoolTestEdgeFunction{-I});
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  auto Stats = Pool.getStatistics();
+  EXPECT_EQ(NumThreads * NumEFsPerThread, Stats.NumRemoteFrees);
+  EXPECT_EQ(NumEFsPerThread, Stats.NumLive);
+
+  // The owner reuses the blocks that the other threads have freed
+  for (int I = 0; I < NumEFsPerThread; ++I) {
+    OwnerEFs.emplace_back(PoolTestEdgeFunction{I});
+  }
+  EXPECT_LE(NumEFsPerThread, Pool.getStatistics().NumReused);
+
+  OwnerEFs.clear();
+  EXPECT_EQ(0, Pool.getStatistics().NumLive);
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include "phasar/DataFlow/IfdsIde/FlowFunctions.h"
+
+#include "llvm/ADT/SmallVector.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+using namespace psr;
+
+namespace {
+using FFTemplates = FlowFunctionTemplates<int, std::set<int>>;
+
+/// Checks that computeTargetsInto() emits the same set of facts as
+/// computeTargets() without duplicates, for all Sources
+template <typename FFTy>
+void checkComputeTargetsInto(const FFTy &FF,
+                             std::initializer_list<int> Sources) {
+  for (int Source : Sources) {
+    auto Expected = FF->computeTargets(Source);
+
+    llvm::SmallVector<int> Targets = {-1};
+    FF->computeTargetsInto(Source, Targets);
+    ASSERT_FALSE(Targets.empty());
+    EXPECT_EQ(-1, Targets.front()) << "Must append to the buffer";
+
+    std::multiset<int> Actual(std::next(Targets.begin()), Targets.end());
+    EXPECT_EQ(std::multiset<int>(Expected.begin(), Expected.end()), Actual)
+        << "For Source " << Source;
+  }
+}
+} // namespace
+
+TEST(FlowFunctionsTest, identityFlow) {
+  checkComputeTargetsInto(FFTemplates::identityFlow(), {0, 1, 2});
+}
+
+TEST(FlowFunctionsTest, generateFlow) {
+  checkComputeTargetsInto(FFTemplates::generateFlow(1, 2), {0, 1, 2});
+  checkComputeTargetsInto(FFTemplates::generateFlow(2, 2), {0, 1, 2});
+  checkComputeTargetsInto(
+      FFTemplates::generateFlowIf(3, [](int X) { return X > 1; }),
+      {0, 1, 2, 3});
+  checkComputeTargetsInto(FFTemplates::generateManyFlows({1, 3}, 2),
+                          {0, 1, 2, 3});
+  checkComputeTargetsInto(FFTemplates::generateManyFlows({2, 3}, 2),
+                          {0, 1, 2, 3});
+}
+
+TEST(FlowFunctionsTest, killFlow) {
+  checkComputeTargetsInto(FFTemplates::killFlow(1), {0, 1, 2});
+  checkComputeTargetsInto(
+      FFTemplates::killFlowIf([](int X) { return X > 1; }), {0, 1, 2});
+  checkComputeTargetsInto(FFTemplates::killManyFlows({1, 2}), {0, 1, 2, 3});
+  checkComputeTargetsInto(FFTemplates::killAllFlows(), {0, 1});
+}
+
+TEST(FlowFunctionsTest, generateAndKillFlow) {
+  checkComputeTargetsInto(FFTemplates::generateFlowAndKillAllOthers(1, 2),
+                          {0, 1, 2});
+  checkComputeTargetsInto(
+      FFTemplates::generateManyFlowsAndKillAllOthers({1, 2, 3}, 2),
+      {0, 1, 2, 3});
+  checkComputeTargetsInto(FFTemplates::transferFlow(1, 2), {0, 1, 2});
+}
+
+TEST(FlowFunctionsTest, lambdaFlow) {
+  checkComputeTargetsInto(FFTemplates::lambdaFlow([](int X) {
+                            return std::set<int>{X, X + 1};
+                          }),
+                          {0, 1});
+  checkComputeTargetsInto(
+      FFTemplates::lambdaFlow([](int X, llvm::SmallVectorImpl<int> &Targets) {
+        if (X != 0) {
+          Targets.append({X, X + 1});
+        }
+      }),
+      {0, 1, 2});
+}
+
+TEST(FlowFunctionsTest, zeroedFlow) {
+  auto Zeroed = std::make_shared<ZeroedFlowFunction<int>>(
+      FFTemplates::killAllFlows(), 0);
+  checkComputeTargetsInto(Zeroed, {0, 1});
+
+  auto ZeroedId = std::make_shared<ZeroedFlowFunction<int>>(
+      FFTemplates::identityFlow(), 0);
+  checkComputeTargetsInto(ZeroedId, {0, 1});
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
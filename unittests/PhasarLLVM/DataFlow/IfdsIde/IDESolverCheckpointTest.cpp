@@ -0,0 +1,100 @@
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMSolverCheckpointCodec.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/SimpleAnalysisConstructor.h"
+#include "phasar/Utils/Checkpoint.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include "IDESolverTestUtils.h"
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+using namespace psr;
+using namespace psr::unittest;
+
+/* ============== TEST FIXTURE ============== */
+class IDESolverCheckpoint : public UninitSolverTest {}; // Test Fixture
+
+TEST_P(IDESolverCheckpoint, RestoreAndContinue) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto &ICFG = HA.getICFG();
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  auto AtomicResults = IFDSSolver(Problem, &ICFG).solve();
+
+  LLVMSolverCheckpointCodec<BinaryDomain> Codec(HA.getProjectIRDB());
+
+  std::optional<std::string> Checkpoint;
+  {
+    IFDSSolver Solver(Problem, &ICFG);
+    ASSERT_TRUE(Solver.initialize());
+    ASSERT_TRUE(Solver.nextN(5));
+    Checkpoint = Solver.createCheckpoint(Codec);
+    ASSERT_TRUE(Checkpoint.has_value());
+  }
+
+  IFDSSolver Restored(Problem, &ICFG);
+  ASSERT_TRUE(Restored.restoreCheckpoint(*Checkpoint, Codec));
+  auto RestoredResults = std::move(Restored).continueSolving();
+  compareResults(AtomicResults, RestoredResults);
+
+  // A corrupted checkpoint must be rejected
+  IFDSSolver Corrupted(Problem, &ICFG);
+  EXPECT_FALSE(Corrupted.restoreCheckpoint(
+      llvm::StringRef(*Checkpoint).drop_back(), Codec));
+}
+
+TEST_P(IDESolverCheckpoint, PeriodicCheckpoints) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto &ICFG = HA.getICFG();
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  auto AtomicResults = IFDSSolver(Problem, &ICFG).solve();
+
+  llvm::SmallString<128> Path;
+  ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("phasar-checkpoint", "bin",
+                                                  Path));
+
+  LLVMSolverCheckpointCodec<BinaryDomain> Codec(HA.getProjectIRDB());
+  CheckpointConfig Config;
+  Config.Path = std::string(Path);
+  // Take a checkpoint at every check
+  Config.Interval = std::chrono::milliseconds{0};
+  Config.CheckInterval = std::chrono::milliseconds{1};
+
+  auto Results = IFDSSolver(Problem, &ICFG).solveWithCheckpoints(Codec, Config);
+  compareResults(AtomicResults, Results);
+
+  // The solver checks for a due checkpoint right after the initialization,
+  // so there is always at least one
+  auto Buffer = llvm::MemoryBuffer::getFile(Path);
+  llvm::sys::fs::remove(Path);
+  ASSERT_TRUE(bool(Buffer));
+  ASSERT_FALSE((*Buffer)->getBuffer().empty());
+
+  IFDSSolver Restored(Problem, &ICFG);
+  ASSERT_TRUE(Restored.restoreCheckpoint((*Buffer)->getBuffer(), Codec));
+  auto RestoredResults = std::move(Restored).continueSolving();
+  compareResults(AtomicResults, RestoredResults);
+}
+
+INSTANTIATE_TEST_SUITE_P(IDESolverCheckpointTest, IDESolverCheckpoint,
+                         ::testing::ValuesIn(UninitTestFiles));
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
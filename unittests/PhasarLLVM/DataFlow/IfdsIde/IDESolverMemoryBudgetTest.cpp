@@ -0,0 +1,130 @@
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMSolverCheckpointCodec.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/SimpleAnalysisConstructor.h"
+#include "phasar/Utils/SpillFile.h"
+
+#include "IDESolverTestUtils.h"
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <optional>
+#include <string>
+
+using namespace psr;
+using namespace psr::unittest;
+
+/* ============== TEST FIXTURE ============== */
+class IDESolverMemoryBudget : public UninitSolverTest {}; // Test Fixture
+
+TEST_P(IDESolverMemoryBudget, SpillAndFaultIn) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto &ICFG = HA.getICFG();
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  auto AtomicResults = IFDSSolver(Problem, &ICFG).solve();
+
+  LLVMSolverCheckpointCodec<BinaryDomain> Codec(HA.getProjectIRDB());
+  // A limit of 0 is always exceeded, so all cold functions get spilled
+  MemoryBudgetConfig Config;
+  Config.Limit = 0;
+
+  IFDSSolver Solver(Problem, &ICFG);
+  ASSERT_TRUE(Solver.enableMemoryBudget(Codec, Config));
+  size_t NumSpilled = 0;
+  if (Solver.initialize()) {
+    // Enforce the budget after every step, s.t. a callee gets cold as soon as
+    // its caller continues
+    while (Solver.next()) {
+      NumSpilled += Solver.enforceMemoryBudget();
+      // Each spilled function is either still spilled or has been faulted in
+      EXPECT_EQ(NumSpilled, Solver.getNumSpilledFunctions() +
+                                Solver.getNumFaultedInFunctions());
+    }
+  }
+  // Each test file calls at least one function from main
+  EXPECT_GT(NumSpilled, 0U);
+
+  auto Results = Solver.finalize();
+  compareResults(AtomicResults, Results);
+  EXPECT_EQ(0U, Solver.getNumSpilledFunctions());
+  EXPECT_EQ(NumSpilled, Solver.getNumFaultedInFunctions());
+}
+
+TEST_P(IDESolverMemoryBudget, CheckpointWhileSpilled) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto &ICFG = HA.getICFG();
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  auto AtomicResults = IFDSSolver(Problem, &ICFG).solve();
+
+  LLVMSolverCheckpointCodec<BinaryDomain> Codec(HA.getProjectIRDB());
+  MemoryBudgetConfig Config;
+  Config.Limit = 0;
+
+  std::optional<std::string> Checkpoint;
+  {
+    IFDSSolver Solver(Problem, &ICFG);
+    ASSERT_TRUE(Solver.enableMemoryBudget(Codec, Config));
+    ASSERT_TRUE(Solver.initialize());
+    while (!Checkpoint && Solver.next()) {
+      if (Solver.enforceMemoryBudget() != 0) {
+        auto NumSpilled = Solver.getNumSpilledFunctions();
+        auto NumFaultedIn = Solver.getNumFaultedInFunctions();
+        // The checkpoint must contain the entries of the spilled functions
+        // without faulting them back in
+        Checkpoint = Solver.createCheckpoint(Codec);
+        ASSERT_TRUE(Checkpoint.has_value());
+        EXPECT_EQ(NumSpilled, Solver.getNumSpilledFunctions());
+        EXPECT_EQ(NumFaultedIn, Solver.getNumFaultedInFunctions());
+      }
+    }
+  }
+  ASSERT_TRUE(Checkpoint.has_value()) << "No function has been spilled";
+
+  IFDSSolver Restored(Problem, &ICFG);
+  ASSERT_TRUE(Restored.restoreCheckpoint(*Checkpoint, Codec));
+  EXPECT_EQ(0U, Restored.getNumSpilledFunctions());
+  auto RestoredResults = std::move(Restored).continueSolving();
+  compareResults(AtomicResults, RestoredResults);
+
+  // With a memory budget, the spilled functions stay spilled
+  IFDSSolver RestoredSpilled(Problem, &ICFG);
+  ASSERT_TRUE(RestoredSpilled.enableMemoryBudget(Codec, Config));
+  ASSERT_TRUE(RestoredSpilled.restoreCheckpoint(*Checkpoint, Codec));
+  EXPECT_GT(RestoredSpilled.getNumSpilledFunctions(), 0U);
+  auto RestoredSpilledResults = std::move(RestoredSpilled).continueSolving();
+  compareResults(AtomicResults, RestoredSpilledResults);
+}
+
+TEST_P(IDESolverMemoryBudget, SolveWithMemoryBudget) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto &ICFG = HA.getICFG();
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  auto AtomicResults = IFDSSolver(Problem, &ICFG).solve();
+
+  LLVMSolverCheckpointCodec<BinaryDomain> Codec(HA.getProjectIRDB());
+  MemoryBudgetConfig Config;
+  Config.Limit = 0;
+  Config.CheckInterval = std::chrono::milliseconds{1};
+
+  auto Results =
+      IFDSSolver(Problem, &ICFG).solveWithMemoryBudget(Codec, Config);
+  compareResults(AtomicResults, Results);
+}
+
+INSTANTIATE_TEST_SUITE_P(IDESolverMemoryBudgetTest, IDESolverMemoryBudget,
+                         ::testing::ValuesIn(UninitTestFiles));
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,75 @@
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LibCSummary.h"
+
+#include "gtest/gtest.h"
+
+#include <optional>
+#include <variant>
+
+using namespace psr;
+using namespace psr::library_summary;
+
+namespace {
+std::optional<uint16_t> getParamIndex(const DataFlowFact &Fact) {
+  if (const auto *Param = std::get_if<Parameter>(&Fact.Fact)) {
+    return Param->Index;
+  }
+  return std::nullopt;
+}
+} // namespace
+
+TEST(LibrarySummaryTest, LibCTableLookup) {
+  auto Table = getLibCSummaryTable();
+  ASSERT_FALSE(Table.empty());
+
+  auto Strcpy = Table.getEntriesForFunction("strcpy");
+  ASSERT_EQ(2, Strcpy.size());
+  EXPECT_EQ(1, Strcpy[0].ParamIndex);
+  EXPECT_EQ(0, getParamIndex(Strcpy[0].Fact));
+  EXPECT_EQ(0, Strcpy[1].ParamIndex);
+  EXPECT_TRUE(std::holds_alternative<ReturnValue>(Strcpy[1].Fact.Fact));
+
+  EXPECT_FALSE(Table.contains("not_a_libc_function"));
+  EXPECT_TRUE(Table.getEntriesForFunction("").empty());
+}
+
+TEST(LibrarySummaryTest, LibCTableMatchesFacts) {
+  auto Table = getLibCSummaryTable();
+  const auto &Facts = getLibCSummary();
+
+  size_t NumFacts = 0;
+  for (const auto &Fun : Facts) {
+    EXPECT_TRUE(Table.contains(Fun.first())) << Fun.first().str();
+    for (const auto &[Idx, Outs] : Fun.second) {
+      NumFacts += Outs.size();
+    }
+  }
+  EXPECT_EQ(Table.size(), NumFacts);
+}
+
+TEST(LibrarySummaryTest, ParseJson) {
+  auto Facts = parseFunctionDataFlowFacts(R"({
+    "SSL_read": [
+      {"from": 0, "to": 1},
+      {"from": 0, "to": "ret"}
+    ],
+    "invalid": [
+      {"from": -1, "to": 1},
+      {"to": "ret"},
+      {"from": 0, "to": "nowhere"}
+    ]
+  })");
+
+  const auto &Read0 = Facts.getDataFlowFacts("SSL_read", 0);
+  ASSERT_EQ(2, Read0.size());
+  EXPECT_EQ(1, getParamIndex(Read0[0]));
+  EXPECT_TRUE(std::holds_alternative<ReturnValue>(Read0[1].Fact));
+
+  EXPECT_TRUE(Facts.getDataFlowFacts("invalid", 0).empty());
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
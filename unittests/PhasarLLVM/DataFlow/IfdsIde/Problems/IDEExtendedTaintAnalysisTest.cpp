@@ -10,6 +10,7 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEExtendedTaintAnalysis.h"
 
 #include "phasar/DataFlow/IfdsIde/Solver/IDESolver.h"
+#include "phasar/DataFlow/IfdsIde/Solver/PathAwareIDESolver.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
 #include "phasar/PhasarLLVM/HelperAnalyses.h"
@@ -50,6 +51,8 @@ class IDETaintAnalysisTest : public ::testing::Test {
 protected:
   static constexpr auto PathToLLFiles = PHASAR_BUILD_SUBFOLDER("xtaint/");
   const std::vector<std::string> EntryPoints = {"main"};
+  /// The number of solver steps between two garbage collections
+  static constexpr size_t GCInterval = 8;
 
   IDETaintAnalysisTest() = default;
   ~IDETaintAnalysisTest() override = default;
@@ -90,7 +93,43 @@ protected:
 
     TaintProblem.emitTextReport(Solver.getSolverResults());
 
+    auto FactStats = TaintProblem.getFactStatistics();
+    if (DumpResults) {
+      llvm::errs() << FactStats;
+    }
+    EXPECT_EQ(TaintProblem.getNumDataflowFacts(), FactStats.NumLocations);
+    EXPECT_LE(FactStats.NumUsedBytes, FactStats.NumAllocatedBytes);
+
     compareResults(TaintProblem, Solver, GroundTruth);
+
+    // Solve again, while periodically reclaiming the facts that are not used
+    // anymore
+    auto GCTaintProblem =
+        createAnalysisProblem<IDEExtendedTaintAnalysis<>>(HA, TC, EntryPoints);
+    IDESolver GCSolver(GCTaintProblem, &HA.getICFG());
+    if (GCSolver.initialize()) {
+      while (GCSolver.nextN(GCInterval)) {
+        GCTaintProblem.collectGarbage(GCSolver);
+      }
+    }
+    GCSolver.finalize();
+    GCTaintProblem.collectGarbage(GCSolver, /*Full*/ true);
+
+    auto GCFactStats = GCTaintProblem.getFactStatistics();
+    if (DumpResults) {
+      llvm::errs() << GCFactStats;
+    }
+    EXPECT_EQ(GCTaintProblem.getNumDataflowFacts(), GCFactStats.NumLocations);
+    EXPECT_EQ(GCFactStats.NumLocations + GCFactStats.NumReclaimedLocations,
+              GCFactStats.NumPoolMisses);
+    EXPECT_LE(GCFactStats.NumUsedBytes + GCFactStats.NumFreeBytes,
+              GCFactStats.NumAllocatedBytes);
+    // The flow functions create temporary facts, e.g., to check for aliases,
+    // that are never propagated and must have been reclaimed
+    EXPECT_GT(GCFactStats.NumReclaimedLocations, 0U);
+    EXPECT_LT(GCFactStats.NumLocations, FactStats.NumLocations);
+
+    compareResults(GCTaintProblem, GCSolver, GroundTruth);
   }
 
   void SetUp() override { ValueAnnotationPass::resetValueID(); }
@@ -145,6 +184,31 @@ TEST_F(IDETaintAnalysisTest, XTaint01) {
   doAnalysis({PathToLLFiles + "xtaint01_cpp.ll"}, Gt, std::monostate{});
 }
 
+TEST_F(IDETaintAnalysisTest, XTaint01_PathAwareGC) {
+  map<int, set<string>> Gt;
+
+  Gt[15] = {"14"};
+
+  HelperAnalyses HA(PathToLLFiles + "xtaint01_cpp.ll", EntryPoints);
+  LLVMTaintConfig TC(HA.getProjectIRDB());
+  auto TaintProblem =
+      createAnalysisProblem<IDEExtendedTaintAnalysis<>>(HA, TC, EntryPoints);
+
+  PathAwareIDESolver Solver(TaintProblem, &HA.getICFG());
+  Solver.solve();
+  TaintProblem.collectGarbage(Solver, /*Full*/ true);
+
+  // The facts within the ESG must survive the garbage collection
+  const auto &ESG = Solver.getExplicitESG();
+  EXPECT_GE(TaintProblem.getFactStatistics().NumLocations,
+            ESG.facts().size());
+  for (const auto &Fact : ESG.facts()) {
+    EXPECT_FALSE(DToString(Fact).empty());
+  }
+
+  compareResults(TaintProblem, Solver, Gt);
+}
+
 TEST_F(IDETaintAnalysisTest, XTaint02) {
   map<int, set<string>> Gt;
 
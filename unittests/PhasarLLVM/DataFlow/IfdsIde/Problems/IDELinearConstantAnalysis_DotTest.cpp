@@ -8,10 +8,14 @@
 #include "phasar/PhasarLLVM/SimpleAnalysisConstructor.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 
+#include "llvm/Support/raw_ostream.h"
+
 #include "TestConfig.h"
 #include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
 
 #include <memory>
+#include <string>
 #include <tuple>
 
 using namespace psr;
@@ -86,6 +90,34 @@ TEST_F(IDELinearConstantAnalysisTest, HandleBasicTest_01) {
   compareResults(Results, GroundTruth);
 }
 
+TEST_F(IDELinearConstantAnalysisTest, StreamESGAsJson) {
+  HelperAnalyses HA(PathToLlFiles + "basic_01_cpp_dbg.ll", EntryPoints);
+  auto LCAProblem =
+      createAnalysisProblem<IDELinearConstantAnalysis>(HA, EntryPoints);
+  LCAProblem.getIFDSIDESolverConfig().setRecordEdges(true);
+  IDESolver LCASolver(LCAProblem, &HA.getICFG());
+  LCASolver.solve();
+
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  LCASolver.emitESG(OS, ESGExportFormat::Json);
+
+  auto Json = nlohmann::json::parse(Buf);
+  size_t NumNodes = 0;
+  size_t NumEdges = 0;
+  for (const auto &Rec : Json["records"]) {
+    if (Rec["kind"] == "node") {
+      ++NumNodes;
+    } else if (Rec["kind"] == "edge") {
+      ++NumEdges;
+      EXPECT_LT(Rec["from"].get<size_t>(), NumNodes);
+      EXPECT_LT(Rec["to"].get<size_t>(), NumNodes);
+    }
+  }
+  EXPECT_NE(0, NumNodes);
+  EXPECT_NE(0, NumEdges);
+}
+
 TEST_F(IDELinearConstantAnalysisTest, HandleBasicTest_02) {
   auto Results = doAnalysis("basic_02_cpp_dbg.ll");
   std::set<LCACompactResult_t> GroundTruth;
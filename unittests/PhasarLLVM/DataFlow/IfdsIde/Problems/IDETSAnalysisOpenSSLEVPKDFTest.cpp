@@ -40,9 +40,9 @@ protected:
   OpenSSLEVPKDFDescription OpenSSLEVPKDFDesc{};
   std::optional<IDETypeStateAnalysis<OpenSSLEVPKDFCTXDescription>> TSProblem;
   std::optional<IDETypeStateAnalysis<OpenSSLEVPKDFDescription>> TSKDFProblem;
-  unique_ptr<IDESolver<IDETypeStateAnalysisDomain<OpenSSLEVPKDFCTXDescription>>>
+  unique_ptr<IDESolver_P<IDETypeStateAnalysis<OpenSSLEVPKDFCTXDescription>>>
       Llvmtssolver;
-  unique_ptr<IDESolver<IDETypeStateAnalysisDomain<OpenSSLEVPKDFDescription>>>
+  unique_ptr<IDESolver_P<IDETypeStateAnalysis<OpenSSLEVPKDFDescription>>>
       KdfSolver;
 
   // enum OpenSSLEVPKDFCTXState {
@@ -65,7 +65,7 @@ protected:
             *HA, &OpenSSLEVPKDFDesc, EntryPoints);
 
     KdfSolver = make_unique<
-        IDESolver<IDETypeStateAnalysisDomain<OpenSSLEVPKDFDescription>>>(
+        IDESolver_P<IDETypeStateAnalysis<OpenSSLEVPKDFDescription>>>(
         *TSKDFProblem, &HA->getICFG());
 
     OpenSSLEVPKeyDerivationDesc.emplace(*KdfSolver);
@@ -75,7 +75,7 @@ protected:
         *HA, &*OpenSSLEVPKeyDerivationDesc, EntryPoints);
 
     Llvmtssolver = make_unique<
-        IDESolver<IDETypeStateAnalysisDomain<OpenSSLEVPKDFCTXDescription>>>(
+        IDESolver_P<IDETypeStateAnalysis<OpenSSLEVPKDFCTXDescription>>>(
         *TSProblem, &HA->getICFG());
     KdfSolver->solve();
     Llvmtssolver->solve();
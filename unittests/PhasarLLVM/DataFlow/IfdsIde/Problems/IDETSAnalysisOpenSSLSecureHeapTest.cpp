@@ -44,7 +44,7 @@ protected:
   std::optional<IDETypeStateAnalysis<OpenSSLSecureHeapDescription>> TSProblem;
   std::optional<IDESecureHeapPropagation> SecureHeapPropagationProblem;
   unique_ptr<
-      IDESolver<IDETypeStateAnalysisDomain<OpenSSLSecureHeapDescription>>>
+      IDESolver_P<IDETypeStateAnalysis<OpenSSLSecureHeapDescription>>>
       Llvmtssolver;
   unique_ptr<IDESolver<IDESecureHeapPropagationAnalysisDomain>>
       SecureHeapPropagationResults;
@@ -74,7 +74,7 @@ protected:
         IDETypeStateAnalysis<OpenSSLSecureHeapDescription>>(*HA, &*Desc,
                                                             EntryPoints);
     Llvmtssolver = make_unique<
-        IDESolver<IDETypeStateAnalysisDomain<OpenSSLSecureHeapDescription>>>(
+        IDESolver_P<IDETypeStateAnalysis<OpenSSLSecureHeapDescription>>>(
         *TSProblem, &HA->getICFG());
 
     SecureHeapPropagationResults->solve();
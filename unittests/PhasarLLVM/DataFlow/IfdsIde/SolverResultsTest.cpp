@@ -0,0 +1,117 @@
+#include "phasar/DataFlow/IfdsIde/SolverResults.h"
+
+#include "phasar/Utils/ColumnarResults.h"
+#include "phasar/Utils/Table.h"
+
+#include "llvm/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+constexpr int ZV = 0;
+
+Table<int, int, int> makeResults() {
+  Table<int, int, int> Tab;
+  Tab.insert(1, ZV, 0);
+  Tab.insert(1, 10, 100);
+  Tab.insert(1, 11, 110);
+  Tab.insert(2, ZV, 0);
+  Tab.insert(2, 20, 200);
+  return Tab;
+}
+
+TEST(SolverResultsTest, ResultsAtView) {
+  auto Tab = makeResults();
+  SolverResults<int, int, int> Results(Tab, ZV);
+
+  std::map<int, int> WithZero;
+  for (const auto &[Fact, Value] : Results.resultsAtView(1)) {
+    WithZero.emplace(Fact, Value);
+  }
+  EXPECT_EQ((std::map<int, int>{{ZV, 0}, {10, 100}, {11, 110}}), WithZero);
+
+  std::map<int, int> WithoutZero;
+  for (const auto &[Fact, Value] : Results.resultsAtView(1, true)) {
+    WithoutZero.emplace(Fact, Value);
+  }
+  EXPECT_EQ((std::map<int, int>{{10, 100}, {11, 110}}), WithoutZero);
+
+  // The view points into the table; nothing is copied
+  for (const auto &Entry : Results.resultsAtView(2, true)) {
+    EXPECT_EQ(&Tab.row(2).at(20), &Entry.second);
+  }
+
+  EXPECT_TRUE(Results.resultsAtView(42).empty());
+
+  auto Facts = Results.factsAtView(1, true);
+  EXPECT_EQ((std::set<int>{10, 11}), std::set<int>(Facts.begin(), Facts.end()));
+}
+
+TEST(SolverResultsTest, ForeachResult) {
+  auto Tab = makeResults();
+  OwningSolverResults<int, int, int> Results(std::move(Tab), ZV);
+
+  std::set<std::tuple<int, int, int>> All;
+  Results.get().foreachResult([&All](int Stmt, int Fact, int Value) {
+    EXPECT_TRUE(All.emplace(Stmt, Fact, Value).second);
+  });
+  EXPECT_EQ(5, All.size());
+
+  std::set<std::tuple<int, int, int>> Stripped;
+  Results.get().foreachResult(
+      [&Stripped](int Stmt, int Fact, int Value) {
+        Stripped.emplace(Stmt, Fact, Value);
+      },
+      /*StripZero=*/true);
+  EXPECT_EQ((std::set<std::tuple<int, int, int>>{
+                {1, 10, 100}, {1, 11, 110}, {2, 20, 200}}),
+            Stripped);
+
+  // foreachResult() visits exactly the cells of getAllResultEntries()
+  std::set<std::tuple<int, int, int>> Cells;
+  for (const auto &Cell : Results.get().getAllResultEntries()) {
+    Cells.emplace(Cell.getRowKey(), Cell.getColumnKey(), Cell.getValue());
+  }
+  EXPECT_EQ(All, Cells);
+}
+
+TEST(SolverResultsTest, ExportColumnar) {
+  auto Tab = makeResults();
+  SolverResults<int, int, int> Results(Tab, ZV);
+
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  Results.exportColumnar(OS, /*StripZero=*/true);
+
+  auto Reader = ColumnarResultsReader::create(Buf);
+  ASSERT_TRUE(bool(Reader)) << Reader.getError().message();
+  EXPECT_EQ(2, Reader->getNumRows());
+  EXPECT_EQ(3, Reader->getNumResults());
+
+  std::set<std::tuple<std::string, std::string, std::string>> AtStmt1;
+  Reader->foreachResultAt("1", [&AtStmt1](llvm::StringRef Stmt,
+                                          llvm::StringRef Fact,
+                                          llvm::StringRef Value) {
+    AtStmt1.emplace(Stmt, Fact, Value);
+  });
+  EXPECT_EQ((std::set<std::tuple<std::string, std::string, std::string>>{
+                {"1", "10", "100"}, {"1", "11", "110"}}),
+            AtStmt1);
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
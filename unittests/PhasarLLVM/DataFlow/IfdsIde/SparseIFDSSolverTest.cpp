@@ -0,0 +1,198 @@
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/SimpleAnalysisConstructor.h"
+#include "phasar/PhasarLLVM/TaintConfig/LLVMTaintConfig.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/InstrTypes.h"
+#include "llvm/IR/Instruction.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace psr;
+
+/* ============== TEST FIXTURE ============== */
+class SparseIFDSSolverTest : public ::testing::Test {
+protected:
+  static inline const std::vector<std::string> EntryPoints = {"main"};
+
+  /// Checks whether the normal flow functions of Inst may change Fact. This
+  /// is independent of the problem's isRelevant() implementation and serves
+  /// as oracle for the facts the sparse solver must compute.
+  template <typename ProblemTy>
+  static bool isObservable(const LLVMBasedICFG &ICFG, ProblemTy &Problem,
+                           const llvm::Instruction *Inst,
+                           const llvm::Value *Fact) {
+    if (ICFG.isCallSite(Inst) || ICFG.isExitInst(Inst) ||
+        ICFG.isStartPoint(Inst)) {
+      return true;
+    }
+    for (const auto *Succ : ICFG.getSuccsOf(Inst)) {
+      auto Targets =
+          Problem.getNormalFlowFunction(Inst, Succ)->computeTargets(Fact);
+      if (Targets.size() != 1 || *Targets.begin() != Fact) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Solves Problem densely and SparseProblem in sparse mode. The sparse
+  /// results must contain all facts that are observable at an instruction
+  /// and must not contain facts that are absent in the dense results.
+  template <typename ProblemTy>
+  static void compareDenseAndSparse(HelperAnalyses &HA, ProblemTy &Problem,
+                                    ProblemTy &SparseProblem) {
+    auto &ICFG = HA.getICFG();
+    SparseProblem.getIFDSIDESolverConfig().setSparse();
+
+    IFDSSolver DenseSolver(Problem, &ICFG);
+    auto DenseResults = DenseSolver.solve();
+    IFDSSolver SparseSolver(SparseProblem, &ICFG);
+    auto SparseResults = SparseSolver.solve();
+
+    for (const auto &Cell : DenseResults.getAllResultEntries()) {
+      const auto *Inst = Cell.getRowKey();
+      const auto *Fact = Cell.getColumnKey();
+      if (isObservable(ICFG, Problem, Inst, Fact)) {
+        EXPECT_TRUE(SparseResults.resultsAt(Inst).count(Fact))
+            << "Missing fact " << llvmIRToString(Fact) << " at "
+            << llvmIRToString(Inst);
+      }
+    }
+    for (const auto &Cell : SparseResults.getAllResultEntries()) {
+      EXPECT_TRUE(DenseResults.resultsAt(Cell.getRowKey())
+                      .count(Cell.getColumnKey()))
+          << "Spurious fact " << llvmIRToString(Cell.getColumnKey()) << " at "
+          << llvmIRToString(Cell.getRowKey());
+    }
+
+    EXPECT_LE(SparseSolver.getNumPathEdges(), DenseSolver.getNumPathEdges());
+  }
+}; // Test Fixture
+
+class SparseUninitTest
+    : public SparseIFDSSolverTest,
+      public ::testing::WithParamInterface<std::string_view> {
+protected:
+  static constexpr auto PathToLlFiles =
+      PHASAR_BUILD_SUBFOLDER("uninitialized_variables/");
+};
+
+TEST_P(SparseUninitTest, ResultsEquivalent) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+  auto SparseProblem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+
+  compareDenseAndSparse(HA, Problem, SparseProblem);
+  EXPECT_EQ(Problem.getAllUndefUses(), SparseProblem.getAllUndefUses());
+}
+
+TEST_P(SparseUninitTest, BoundedSuccessorCache) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto Problem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+  auto TinyCacheProblem =
+      createAnalysisProblem<IFDSUninitializedVariables>(HA, EntryPoints);
+  Problem.getIFDSIDESolverConfig().setSparse();
+  TinyCacheProblem.getIFDSIDESolverConfig().setSparse();
+  // Flushes the cache of the next relevant statements on every insertion
+  TinyCacheProblem.getIFDSIDESolverConfig().setSparseSuccessorCacheSize(1);
+
+  IFDSSolver Solver(Problem, &HA.getICFG());
+  auto Results = Solver.solve();
+  IFDSSolver TinyCacheSolver(TinyCacheProblem, &HA.getICFG());
+  auto TinyCacheResults = TinyCacheSolver.solve();
+
+  EXPECT_EQ(Solver.getNumPathEdges(), TinyCacheSolver.getNumPathEdges());
+  EXPECT_EQ(Results.getAllResultEntries().size(),
+            TinyCacheResults.getAllResultEntries().size());
+  for (const auto &Cell : Results.getAllResultEntries()) {
+    EXPECT_TRUE(TinyCacheResults.resultsAt(Cell.getRowKey())
+                    .count(Cell.getColumnKey()))
+        << "Missing fact " << llvmIRToString(Cell.getColumnKey()) << " at "
+        << llvmIRToString(Cell.getRowKey());
+  }
+  EXPECT_EQ(Problem.getAllUndefUses(), TinyCacheProblem.getAllUndefUses());
+}
+
+static constexpr std::string_view UninitTestFiles[] = {
+    "binop_uninit_cpp_dbg.ll",     "callsite_cpp_dbg.ll",
+    "growing_example_cpp_dbg.ll",  "multiple_calls_cpp_dbg.ll",
+    "reassing_uninit_cpp_dbg.ll",  "recursion_cpp_dbg.ll",
+    "while_uninit_1_cpp_dbg.ll",
+};
+
+INSTANTIATE_TEST_SUITE_P(SparseIFDSSolverTest, SparseUninitTest,
+                         ::testing::ValuesIn(UninitTestFiles));
+
+class SparseTaintTest
+    : public SparseIFDSSolverTest,
+      public ::testing::WithParamInterface<std::string_view> {
+protected:
+  static constexpr auto PathToLlFiles =
+      PHASAR_BUILD_SUBFOLDER("taint_analysis/dummy_source_sink/");
+
+  static LLVMTaintConfig getConfig() {
+    auto SourceCB = [](const llvm::Instruction *Inst) {
+      std::set<const llvm::Value *> Ret;
+      if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+          Call && Call->getCalledFunction() &&
+          Call->getCalledFunction()->getName() == "_Z6sourcev") {
+        Ret.insert(Call);
+      }
+      return Ret;
+    };
+    auto SinkCB = [](const llvm::Instruction *Inst) {
+      std::set<const llvm::Value *> Ret;
+      if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+          Call && Call->getCalledFunction() &&
+          Call->getCalledFunction()->getName() == "_Z4sinki") {
+        Ret.insert(Call->getArgOperand(0));
+      }
+      return Ret;
+    };
+    return LLVMTaintConfig(std::move(SourceCB), std::move(SinkCB));
+  }
+};
+
+TEST_P(SparseTaintTest, ResultsEquivalent) {
+  HelperAnalyses HA(PathToLlFiles + GetParam(), EntryPoints);
+  auto Config = getConfig();
+  auto Problem =
+      createAnalysisProblem<IFDSTaintAnalysis>(HA, &Config, EntryPoints);
+  auto SparseProblem =
+      createAnalysisProblem<IFDSTaintAnalysis>(HA, &Config, EntryPoints);
+
+  compareDenseAndSparse(HA, Problem, SparseProblem);
+  EXPECT_FALSE(Problem.Leaks.empty());
+  EXPECT_EQ(Problem.Leaks, SparseProblem.Leaks);
+}
+
+static constexpr std::string_view TaintTestFiles[] = {
+    "taint_01_cpp_dbg.ll",           "taint_02_cpp_dbg.ll",
+    "taint_04_cpp_dbg.ll",           "taint_07_cpp_dbg.ll",
+    "taint_07_cpp_m2r_dbg.ll",       "taint_exception_01_cpp_dbg.ll",
+    "taint_exception_10_cpp_dbg.ll", "taint_lib_sum_01_cpp_dbg.ll",
+};
+
+INSTANTIATE_TEST_SUITE_P(SparseIFDSSolverTest, SparseTaintTest,
+                         ::testing::ValuesIn(TaintTestFiles));
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,108 @@
+#include "phasar/DataFlow/Mono/Contexts/CallStringInterner.h"
+
+#include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
+
+#include "gtest/gtest.h"
+
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+TEST(CallStringInternerTest, PushPop) {
+  CallStringInterner<int, 2> Interner;
+  using Interner_t = decltype(Interner);
+  EXPECT_EQ(1, Interner.size());
+
+  auto A = Interner.push(Interner_t::EmptyId, 1);
+  auto AB = Interner.push(A, 2);
+  EXPECT_NE(A, AB);
+  EXPECT_EQ(AB, Interner.push(A, 2));
+  EXPECT_EQ(2, Interner.length(AB));
+
+  // K-limiting drops the oldest call-site
+  auto BC = Interner.push(AB, 3);
+  EXPECT_EQ((CallStringCTX<int, 2>{2, 3}), Interner.get(BC));
+  EXPECT_EQ(BC, Interner.push(Interner.push(Interner_t::EmptyId, 2), 3));
+
+  auto [B, C] = Interner.pop(BC);
+  EXPECT_EQ(3, C);
+  EXPECT_EQ((CallStringCTX<int, 2>{2}), Interner.get(B));
+
+  auto [Empty, Last] = Interner.pop(Interner_t::EmptyId);
+  EXPECT_EQ(Interner_t::EmptyId, Empty);
+  EXPECT_EQ(0, Last);
+  EXPECT_TRUE(Interner.empty(Interner.pop(A).first));
+}
+
+TEST(CallStringInternerTest, InternRoundTrip) {
+  CallStringInterner<int, 3> Interner;
+  CallStringCTX<int, 3> CS{4, 5, 6};
+  auto Id = Interner.intern(CS);
+  EXPECT_EQ(CS, Interner.get(Id));
+  EXPECT_EQ(Id, Interner.intern(CS));
+  EXPECT_EQ(4, Interner.size());
+}
+
+// The interned call strings must behave exactly like CallStringCTX
+template <unsigned K> void checkAgainstCallStringCTX(unsigned Seed) {
+  CallStringInterner<int, K> Interner;
+  std::mt19937 Rng(Seed);
+  std::uniform_int_distribution<int> CallSiteDist(1, 5);
+  std::bernoulli_distribution PushDist(0.6);
+
+  CallStringCTX<int, K> CS;
+  auto Id = Interner.intern(CS);
+  for (unsigned I = 0; I < 1000; ++I) {
+    if (PushDist(Rng)) {
+      auto CallSite = CallSiteDist(Rng);
+      CS.push_back(CallSite);
+      Id = Interner.push(Id, CallSite);
+    } else {
+      auto Expected = CS.pop_back();
+      auto [Rest, CallSite] = Interner.pop(Id);
+      EXPECT_EQ(Expected, CallSite);
+      Id = Rest;
+    }
+
+    ASSERT_EQ(CS, Interner.get(Id));
+    ASSERT_EQ(Id, Interner.intern(CS));
+    EXPECT_EQ(CS.size(), Interner.length(Id));
+  }
+}
+
+TEST(CallStringInternerTest, BehavesLikeCallStringCTX) {
+  for (unsigned Seed = 0; Seed != 10; ++Seed) {
+    checkAgainstCallStringCTX<1>(Seed);
+    checkAgainstCallStringCTX<2>(Seed);
+    checkAgainstCallStringCTX<3>(Seed);
+  }
+}
+
+TEST(CallStringCTXTest, KLimitedValueSemantics) {
+  CallStringCTX<int, 2> CS;
+  CS.push_back(1);
+  CS.push_back(2);
+  auto Copy = CS;
+  CS.push_back(3);
+  EXPECT_EQ((CallStringCTX<int, 2>{1, 2}), Copy);
+  EXPECT_EQ((CallStringCTX<int, 2>{2, 3}), CS);
+  std::hash<CallStringCTX<int, 2>> Hasher;
+  EXPECT_NE(Hasher(Copy), Hasher(CS));
+  EXPECT_LT(Copy, CS);
+  EXPECT_EQ(3, CS.pop_back());
+  EXPECT_EQ(2, CS.pop_back());
+  EXPECT_TRUE(CS.empty());
+  EXPECT_EQ(0, CS.pop_back());
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
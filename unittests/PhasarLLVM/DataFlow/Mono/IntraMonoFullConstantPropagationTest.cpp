@@ -51,32 +51,39 @@ protected:
       HA.getProjectIRDB().dump();
     }
 
-    auto FCP = createAnalysisProblem<IntraMonoFullConstantPropagation>(
-        HA, EntryPoints);
-    IntraMonoSolver IMSolver(FCP);
-    IMSolver.solve();
-    if (PrintDump) {
-      IMSolver.dumpResults();
-    }
-    llvm::outs() << "Done analysis!\n";
-    // do the comparison
-    bool ResultNotEmpty = false;
-    for (const auto &Truth : GroundTruth) {
-      const auto *Fun =
-          HA.getProjectIRDB().getFunctionDefinition(std::get<0>(Truth));
-      const auto *Line = getNthInstruction(Fun, std::get<1>(Truth));
-      auto ResultSet = IMSolver.getResultsAt(Line);
-      for (const auto &[Fact, Value] : ResultSet) {
-        std::string FactStr = llvmIRToString(Fact);
-        llvm::StringRef FactRef(FactStr);
-        if (FactRef.startswith("%" + std::get<2>(Truth) + " ")) {
-          llvm::outs() << "Checking variable: " << FactStr << '\n';
-          ResultNotEmpty = true;
-          EXPECT_EQ(std::get<3>(Truth), Value);
+    // The results must not depend on the order in which the solver processes
+    // the CFG
+    for (auto Strategy :
+         {MonoWorklistStrategy::FIFO, MonoWorklistStrategy::ReversePostOrder,
+          MonoWorklistStrategy::SCC}) {
+      SCOPED_TRACE(toString(Strategy).str());
+      auto FCP = createAnalysisProblem<IntraMonoFullConstantPropagation>(
+          HA, EntryPoints);
+      IntraMonoSolver IMSolver(FCP, Strategy);
+      IMSolver.solve();
+      if (PrintDump) {
+        IMSolver.dumpResults();
+      }
+      llvm::outs() << "Done analysis!\n";
+      // do the comparison
+      bool ResultNotEmpty = false;
+      for (const auto &Truth : GroundTruth) {
+        const auto *Fun =
+            HA.getProjectIRDB().getFunctionDefinition(std::get<0>(Truth));
+        const auto *Line = getNthInstruction(Fun, std::get<1>(Truth));
+        auto ResultSet = IMSolver.getResultsAt(Line);
+        for (const auto &[Fact, Value] : ResultSet) {
+          std::string FactStr = llvmIRToString(Fact);
+          llvm::StringRef FactRef(FactStr);
+          if (FactRef.startswith("%" + std::get<2>(Truth) + " ")) {
+            llvm::outs() << "Checking variable: " << FactStr << '\n';
+            ResultNotEmpty = true;
+            EXPECT_EQ(std::get<3>(Truth), Value);
+          }
         }
       }
+      EXPECT_TRUE(ResultNotEmpty);
     }
-    EXPECT_TRUE(ResultNotEmpty);
   }
 
 }; // Test Fixture
@@ -0,0 +1,121 @@
+#include "phasar/DataFlow/Mono/MonoWorklist.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+using EdgeTy = std::pair<int, int>;
+
+// 0 -> 1 -> 2 -> 1
+//      1 -> 3
+// The DFS visits 2 before 3, so in reverse-postorder, the loop exit 3 comes
+// before the loop body 2.
+const std::map<int, std::vector<int>> LoopGraph = {
+    {0, {1}},
+    {1, {2, 3}},
+    {2, {1}},
+    {3, {}},
+};
+
+const std::vector<EdgeTy> LoopEdges = {{0, 1}, {1, 2}, {1, 3}, {2, 1}};
+
+std::vector<EdgeTy> drain(MonoWorklist<int> &WL) {
+  std::vector<EdgeTy> Ret;
+  while (!WL.empty()) {
+    Ret.push_back(WL.pop());
+  }
+  return Ret;
+}
+
+MonoWorklist<int> makeWorklist(MonoWorklistStrategy Strategy) {
+  MonoWorklist<int> WL(Strategy);
+  WL.addNodes(std::vector<int>{0},
+              [](int Node) { return LoopGraph.at(Node); });
+  return WL;
+}
+
+TEST(MonoWorklistTest, FIFOKeepsInsertionOrder) {
+  auto WL = makeWorklist(MonoWorklistStrategy::FIFO);
+  WL.push({2, 1});
+  WL.pushAll(LoopEdges);
+  WL.pushFront(std::vector<EdgeTy>{{1, 3}});
+
+  std::vector<EdgeTy> Expected = {{1, 3}, {2, 1}, {0, 1},
+                                  {1, 2}, {1, 3}, {2, 1}};
+  EXPECT_EQ(Expected, drain(WL));
+
+  auto Stats = WL.getStatistics();
+  EXPECT_EQ(6, Stats.NumPushes);
+  EXPECT_EQ(0, Stats.NumDuplicatePushes);
+  EXPECT_EQ(6, Stats.NumVisits);
+  EXPECT_EQ(6, Stats.MaxWorklistSize);
+  EXPECT_EQ(3, Stats.NumVisitedNodes);
+  EXPECT_EQ(3, WL.getNumVisits(1));
+  EXPECT_EQ(0, WL.getNumVisits(3));
+}
+
+TEST(MonoWorklistTest, ReversePostOrder) {
+  auto WL = makeWorklist(MonoWorklistStrategy::ReversePostOrder);
+  // In reverse order
+  WL.pushAll(std::vector<EdgeTy>(LoopEdges.rbegin(), LoopEdges.rend()));
+  WL.push({1, 2});
+
+  std::vector<EdgeTy> Expected = {{0, 1}, {1, 3}, {1, 2}, {2, 1}};
+  EXPECT_EQ(Expected, drain(WL));
+
+  auto Stats = WL.getStatistics();
+  EXPECT_EQ(5, Stats.NumPushes);
+  EXPECT_EQ(1, Stats.NumDuplicatePushes);
+  EXPECT_EQ(4, Stats.NumVisits);
+  EXPECT_EQ(4, Stats.MaxWorklistSize);
+}
+
+TEST(MonoWorklistTest, SCCIteratesLoopsFirst) {
+  auto WL = makeWorklist(MonoWorklistStrategy::SCC);
+  WL.pushAll(LoopEdges);
+
+  // The loop {1, 2} is processed before its exit
+  std::vector<EdgeTy> Expected = {{0, 1}, {1, 2}, {1, 3}, {2, 1}};
+  EXPECT_EQ(Expected, drain(WL));
+
+  // Re-entering the loop
+  WL.push({2, 1});
+  WL.push({1, 3});
+  WL.push({1, 2});
+  Expected = {{1, 2}, {1, 3}, {2, 1}};
+  EXPECT_EQ(Expected, drain(WL));
+  EXPECT_EQ(4, WL.getStatistics().MaxVisitsPerNode);
+}
+
+TEST(MonoWorklistTest, UnnumberedNodesComeLast) {
+  auto WL = makeWorklist(MonoWorklistStrategy::SCC);
+  WL.push({42, 0});
+  WL.push({3, 42});
+  WL.push({0, 1});
+
+  std::vector<EdgeTy> Expected = {{0, 1}, {3, 42}, {42, 0}};
+  EXPECT_EQ(Expected, drain(WL));
+
+  // A second graph is ordered after the first one
+  WL.addNodes(std::vector<int>{10}, [](int Node) {
+    return Node == 10 ? std::vector<int>{11} : std::vector<int>{};
+  });
+  WL.push({10, 11});
+  WL.push({2, 1});
+  Expected = {{2, 1}, {10, 11}};
+  EXPECT_EQ(Expected, drain(WL));
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
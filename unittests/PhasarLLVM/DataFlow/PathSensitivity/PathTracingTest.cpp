@@ -35,6 +35,7 @@
 #include <memory>
 #include <new>
 #include <string>
+#include <string_view>
 #include <system_error>
 
 namespace {
@@ -738,6 +739,66 @@ TEST_F(PathTracingTest, Handle_Other_01) {
   comparePaths(PathsVec, {{0, 1, 6, 7, 8, 9, 10, 12, 13}});
 }
 
+class PathTracingParallelTest
+    : public ::testing::TestWithParam<std::string_view> {
+protected:
+  void SetUp() override { psr::ValueAnnotationPass::resetValueID(); }
+};
+
+TEST_P(PathTracingParallelTest, SameAsSequential) {
+  psr::LLVMProjectIRDB IRDB(PathTracingTest::PathToLlFiles +
+                            std::string(GetParam()));
+  psr::LLVMTypeHierarchy TH(IRDB);
+  psr::LLVMAliasSet PT(&IRDB);
+  psr::LLVMBasedICFG ICFG(&IRDB, psr::CallGraphAnalysisType::OTF, {"main"},
+                          &TH, &PT, psr::Soundness::Soundy,
+                          /*IncludeGlobals*/ false);
+
+  psr::LLVMTaintConfig Config(IRDB);
+  psr::IDEExtendedTaintAnalysis<3, false> Analysis(&IRDB, &ICFG, &PT, Config,
+                                                   {"main"});
+  psr::PathAwareIDESolver Solver(Analysis, &ICFG);
+  Solver.solve();
+
+  auto *Main = IRDB.getFunctionDefinition("main");
+  ASSERT_NE(nullptr, Main);
+  auto *LastInst = &Main->back().back();
+
+  // Each run gets its own constraints and manager, s.t. the multithreaded run
+  // cannot reuse cached verdicts of the sequential one
+  psr::LLVMPathConstraints SeqLPC;
+  psr::Z3BasedPathSensitivityManager<psr::IDEExtendedTaintAnalysisDomain>
+      SeqPSM(&Solver.getExplicitESG(),
+             psr::Z3BasedPathSensitivityConfig().withNumSolverThreads(1),
+             &SeqLPC);
+  auto SeqPaths = SeqPSM.pathsTo(LastInst, Analysis.getZeroValue());
+
+  psr::LLVMPathConstraints ParLPC;
+  psr::Z3BasedPathSensitivityManager<psr::IDEExtendedTaintAnalysisDomain>
+      ParPSM(&Solver.getExplicitESG(),
+             psr::Z3BasedPathSensitivityConfig().withNumSolverThreads(4),
+             &ParLPC);
+  auto ParPaths = ParPSM.pathsTo(LastInst, Analysis.getZeroValue());
+
+  EXPECT_FALSE(SeqPaths.empty());
+  ASSERT_EQ(SeqPaths.size(), ParPaths.size());
+  for (size_t I = 0; I < SeqPaths.size(); ++I) {
+    EXPECT_TRUE(SeqPaths[I] == ParPaths[I]) << "Paths differ at index " << I;
+  }
+}
+
+/// Files with branches in several functions, s.t. the path DAG has levels with
+/// more than one edge to check
+constexpr std::string_view ParallelTestFiles[] = {
+    "inter_04_cpp.ll",
+    "inter_05_cpp.ll",
+    "inter_07_cpp.ll",
+    "inter_12_cpp.ll",
+};
+
+INSTANTIATE_TEST_SUITE_P(PathTracingParallel, PathTracingParallelTest,
+                         ::testing::ValuesIn(ParallelTestFiles));
+
 TEST(PathsDAGTest, ForwardMinimizeDAGTest) {
   psr::AdjacencyList<int> Graph;
   using traits_t = psr::GraphTraits<decltype(Graph)>;
@@ -852,6 +913,62 @@ TEST(PathsDAGTest, InLLVMSSA) {
   EXPECT_EQ(Gt, Paths[0]);
 }
 
+TEST(LLVMPathConstraintsTest, PrunesPathsContainingUnsatCore) {
+  psr::LLVMPathConstraints LPC;
+  auto &Ctx = LPC.getContext();
+  auto X = Ctx.int_const("x");
+  auto Y = Ctx.int_const("y");
+
+  auto Pos = LPC.internFragment(X > 0);
+  auto Neg = LPC.internFragment(X < 0);
+  auto Unrelated = LPC.internFragment(Y == 42);
+  EXPECT_EQ(Pos.id(), LPC.internFragment(X > 0).id());
+
+  auto PosLit = LPC.getTrackingLiteral(Pos);
+  EXPECT_EQ(PosLit.id(), LPC.getTrackingLiteral(Pos).id());
+
+  z3::solver Solver(Ctx);
+  z3::expr_vector Assumptions(Ctx);
+  for (const auto &Frag : {Unrelated, Pos, Neg}) {
+    auto Lit = LPC.getTrackingLiteral(Frag);
+    Solver.add(z3::implies(Lit, Frag));
+    Assumptions.push_back(Lit);
+  }
+  ASSERT_EQ(z3::check_result::unsat, Solver.check(Assumptions));
+  LPC.recordInfeasible(Solver.unsat_core());
+  EXPECT_EQ(1, LPC.getStatistics().NumInfeasibleCores);
+
+  // The core must not contain the unrelated fragment
+  auto OnPath = [&](std::initializer_list<z3::expr> Frags) {
+    return [Frags](unsigned Id) {
+      return llvm::any_of(Frags,
+                          [Id](const z3::expr &E) { return E.id() == Id; });
+    };
+  };
+  EXPECT_TRUE(LPC.isKnownInfeasible(Neg, OnPath({Pos, Neg})));
+  EXPECT_FALSE(LPC.isKnownInfeasible(Neg, OnPath({Unrelated, Neg})));
+  EXPECT_FALSE(LPC.isKnownInfeasible(Unrelated, OnPath({Unrelated, Pos})));
+  EXPECT_EQ(1, LPC.getStatistics().NumPrunedByCore);
+}
+
+TEST(LLVMPathConstraintsTest, BoundsTheVerdictCache) {
+  psr::LLVMPathConstraints LPC;
+  LPC.setMaxNumCachedVerdicts(2);
+  auto &Ctx = LPC.getContext();
+  auto X = Ctx.int_const("x");
+
+  LPC.cacheVerdict(X > 0, true);
+  LPC.cacheVerdict(X > 0 && X < 0, false);
+  EXPECT_EQ(std::optional(true), LPC.getCachedVerdict(X > 0));
+  EXPECT_EQ(std::optional(false), LPC.getCachedVerdict(X > 0 && X < 0));
+
+  // The cache is full, so the previous verdicts get dropped
+  LPC.cacheVerdict(X > 1, true);
+  EXPECT_EQ(std::nullopt, LPC.getCachedVerdict(X > 0));
+  EXPECT_EQ(std::optional(true), LPC.getCachedVerdict(X > 1));
+  EXPECT_EQ(3, LPC.getStatistics().NumVerdictCacheHits);
+}
+
 } // namespace
 
 // main function for the test case
@@ -6,10 +6,17 @@
 #include "phasar/PhasarLLVM/Passes/ValueAnnotationPass.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToUtils.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/InstIterator.h"
 
 #include "TestConfig.h"
 #include "gtest/gtest.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace psr;
 
 TEST(LLVMAliasSet, Intra_01) {
@@ -64,6 +71,59 @@ TEST(LLVMAliasSet, Global_01) {
   llvm::outs() << '\n';
 }
 
+static void checkFrozenAliasSets(const std::string &IRFile) {
+  ValueAnnotationPass::resetValueID();
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles + IRFile);
+  LLVMAliasSet Eager(&IRDB, false);
+  LLVMAliasSet Frozen(&IRDB, true);
+  Frozen.freeze(&IRDB);
+  ASSERT_TRUE(Frozen.isFrozen());
+
+  std::vector<const llvm::Value *> Values;
+  for (const auto &G : IRDB.getModule()->globals()) {
+    Values.push_back(&G);
+  }
+  for (const auto *F : IRDB.getAllFunctions()) {
+    for (const auto &Arg : F->args()) {
+      Values.push_back(&Arg);
+    }
+    for (const auto &I : llvm::instructions(F)) {
+      Values.push_back(&I);
+    }
+  }
+
+  // Frozen alias information may be queried concurrently
+  std::vector<std::thread> Threads;
+  for (unsigned T = 0; T != 4; ++T) {
+    Threads.emplace_back([&] {
+      for (const auto *V : Values) {
+        std::ignore = Frozen.getAliasSet(V);
+        std::ignore = Frozen.getReachableAllocationSites(V);
+        for (const auto *W : Values) {
+          std::ignore = Frozen.alias(V, W);
+        }
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  for (const auto *V : Values) {
+    EXPECT_EQ(*Eager.getAliasSet(V), *Frozen.getAliasSet(V))
+        << llvmIRToString(V);
+  }
+}
+
+TEST(LLVMAliasSet, Frozen_01) {
+  checkFrozenAliasSets("pointers/call_01_cpp.ll");
+}
+
+TEST(LLVMAliasSet, Frozen_02) {
+  // The alias sets of globals are extended lazily by their users
+  checkFrozenAliasSets("pointers/global_01_cpp.ll");
+}
+
 int main(int Argc, char **Argv) {
   ::testing::InitGoogleTest(&Argc, Argv);
   return RUN_ALL_TESTS();
@@ -78,6 +78,26 @@ TEST_P(TypeHierarchySerialization, OrigAndDeserEqual) {
   compareResults(DIBTH, DeserializedDIBTH);
 }
 
+TEST_P(TypeHierarchySerialization, ReserializationIsStable) {
+  psr::LLVMProjectIRDB IRDB(PathToLlFiles + GetParam());
+  psr::DIBasedTypeHierarchy DIBTH(IRDB);
+
+  std::string Ser;
+  llvm::raw_string_ostream StringStream(Ser);
+  DIBTH.printAsJson(StringStream);
+
+  psr::DIBasedTypeHierarchy DeserializedDIBTH(
+      &IRDB, psr::DIBasedTypeHierarchyData::loadJsonString(Ser));
+
+  // Only the direct sub-type edges are serialized, so the deserialized
+  // hierarchy must produce the very same data again
+  std::string Reser;
+  llvm::raw_string_ostream ReserStream(Reser);
+  DeserializedDIBTH.printAsJson(ReserStream);
+
+  EXPECT_EQ(Ser, Reser);
+}
+
 static constexpr std::string_view TypeHierarchyTestFiles[] = {
     "type_hierarchy_1_cpp_dbg.ll",    "type_hierarchy_2_cpp_dbg.ll",
     "type_hierarchy_3_cpp_dbg.ll",    "type_hierarchy_4_cpp_dbg.ll",
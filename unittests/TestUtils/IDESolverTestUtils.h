@@ -0,0 +1,46 @@
+#ifndef UNITTEST_TESTUTILS_IDESOLVERTESTUTILS_H_
+#define UNITTEST_TESTUTILS_IDESOLVERTESTUTILS_H_
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace psr::unittest {
+
+/// Expects that Results contain exactly the same cells as Expected, e.g., to
+/// compare the results of an interrupted solver with an uninterrupted run
+template <typename ExpectedT, typename ResultsT>
+void compareResults(const ExpectedT &Expected, const ResultsT &Results) {
+  size_t NumCells = 0;
+  for (auto &&Cell : Expected.getAllResultEntries()) {
+    ++NumCells;
+    EXPECT_EQ(Cell.getValue(),
+              Results.resultAt(Cell.getRowKey(), Cell.getColumnKey()));
+  }
+  EXPECT_EQ(NumCells, Results.getAllResultEntries().size());
+}
+
+/// Fixture for solver tests that run the IFDSUninitializedVariables analysis
+/// on each of the UninitTestFiles
+class UninitSolverTest : public ::testing::TestWithParam<std::string_view> {
+protected:
+  static constexpr auto PathToLlFiles =
+      PHASAR_BUILD_SUBFOLDER("uninitialized_variables/");
+  const std::vector<std::string> EntryPoints = {"main"};
+};
+
+/// The test files contain at least one function other than main
+inline constexpr std::string_view UninitTestFiles[] = {
+    "callsite_cpp_dbg.ll",
+    "growing_example_cpp_dbg.ll",
+    "multiple_calls_cpp_dbg.ll",
+    "recursion_cpp_dbg.ll",
+};
+
+} // namespace psr::unittest
+
+#endif // UNITTEST_TESTUTILS_IDESOLVERTESTUTILS_H_
@@ -0,0 +1,138 @@
+#include "phasar/Utils/Checkpoint.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <string>
+#include <tuple>
+
+using namespace psr;
+
+namespace {
+
+std::string encodeSample() {
+  CheckpointEncoder Enc("PSRTST", 3);
+  auto Foo = Enc.getStringId("foo");
+  auto Bar = Enc.getStringId("bar");
+  EXPECT_EQ(Foo, Enc.getStringId("foo"));
+  EXPECT_NE(Foo, Bar);
+
+  Enc.writeTag('A');
+  Enc.writeNumber(Foo);
+  Enc.writeNumber(1ULL << 40);
+  // Strings may be interned between records
+  auto Baz = Enc.getStringId("baz");
+  Enc.writeTag('B');
+  Enc.writeNumber(Bar);
+  Enc.writeNumber(Baz);
+  Enc.writeTag('Z');
+  return std::move(Enc).take();
+}
+
+TEST(CheckpointTest, RoundTrip) {
+  auto Buf = encodeSample();
+  EXPECT_TRUE(llvm::StringRef(Buf).startswith("PSRTST\x03"));
+
+  auto Dec = CheckpointDecoder::create(Buf, "PSRTST", 3);
+  ASSERT_TRUE(bool(Dec));
+  EXPECT_EQ('A', Dec->nextTag());
+  EXPECT_EQ("foo", Dec->readString());
+  EXPECT_EQ(1ULL << 40, Dec->readNumber());
+  EXPECT_EQ('B', Dec->nextTag());
+  EXPECT_EQ("bar", Dec->readString());
+  EXPECT_EQ("baz", Dec->readString());
+  EXPECT_EQ('Z', Dec->nextTag());
+  EXPECT_FALSE(Dec->hasError());
+  EXPECT_EQ('\0', Dec->nextTag());
+}
+
+TEST(CheckpointTest, NestedBytes) {
+  auto Nested = encodeSample();
+
+  CheckpointEncoder Enc("PSRTST", 3);
+  Enc.writeTag('N');
+  Enc.writeBytes(Nested);
+  Enc.writeNumber(42);
+  Enc.writeTag('Z');
+  auto Buf = std::move(Enc).take();
+
+  auto Dec = CheckpointDecoder::create(Buf, "PSRTST", 3);
+  ASSERT_TRUE(bool(Dec));
+  EXPECT_EQ('N', Dec->nextTag());
+  EXPECT_EQ(Nested, Dec->readBytes());
+  EXPECT_EQ(42U, Dec->readNumber());
+  EXPECT_EQ('Z', Dec->nextTag());
+  EXPECT_FALSE(Dec->hasError());
+}
+
+TEST(CheckpointTest, RejectsInvalidInput) {
+  auto Buf = encodeSample();
+  EXPECT_FALSE(bool(CheckpointDecoder::create("", "PSRTST", 3)));
+  EXPECT_FALSE(bool(CheckpointDecoder::create(Buf, "PSRTST", 4)));
+  EXPECT_FALSE(bool(CheckpointDecoder::create(Buf, "PSRCKP", 3)));
+
+  // Unknown string id
+  auto Dec = CheckpointDecoder::create(
+      llvm::StringRef("PSRTST\x03"
+                      "A\x05",
+                      9),
+      "PSRTST", 3);
+  ASSERT_TRUE(bool(Dec));
+  EXPECT_EQ('A', Dec->nextTag());
+  EXPECT_EQ("", Dec->readString());
+  EXPECT_TRUE(Dec->hasError());
+
+  // Truncated
+  auto Truncated =
+      CheckpointDecoder::create(llvm::StringRef(Buf).drop_back(3), "PSRTST", 3);
+  ASSERT_TRUE(bool(Truncated));
+  EXPECT_EQ('A', Truncated->nextTag());
+  std::ignore = Truncated->readString();
+  std::ignore = Truncated->readNumber();
+  EXPECT_EQ('B', Truncated->nextTag());
+  std::ignore = Truncated->readString();
+  std::ignore = Truncated->readString();
+  EXPECT_TRUE(Truncated->hasError());
+  EXPECT_EQ('\0', Truncated->nextTag());
+}
+
+TEST(CheckpointTest, PeriodicCheckpointer) {
+  llvm::SmallString<128> Path;
+  ASSERT_FALSE(
+      llvm::sys::fs::createTemporaryFile("phasar-checkpoint", "bin", Path));
+
+  CheckpointConfig Config;
+  Config.Path = std::string(Path);
+  Config.Interval = std::chrono::hours{1};
+  PeriodicCheckpointer Checkpointer(Config);
+
+  auto Now = std::chrono::steady_clock::now();
+  EXPECT_FALSE(Checkpointer.isDue(Now));
+  EXPECT_TRUE(Checkpointer.isDue(Now + std::chrono::hours{2}));
+
+  Checkpointer.write("first");
+  Checkpointer.write("second");
+  Checkpointer.wait();
+  EXPECT_EQ(2, Checkpointer.getNumCheckpoints());
+  EXPECT_FALSE(Checkpointer.getLastError());
+
+  // Each checkpoint replaces the previous one
+  auto Buffer = llvm::MemoryBuffer::getFile(Path);
+  ASSERT_TRUE(bool(Buffer));
+  EXPECT_EQ("second", (*Buffer)->getBuffer());
+
+  llvm::sys::fs::remove(Path);
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+#include "phasar/Utils/ColumnarResults.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+
+using TripleTy = std::tuple<std::string, std::string, std::string>;
+
+std::string writeSampleResults() {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  ColumnarResultsWriter Writer(OS);
+  auto S1 = Writer.getStringId("%1 = load i32, ptr %x");
+  auto S2 = Writer.getStringId("ret i32 %1");
+  auto X = Writer.getStringId("%x");
+  auto One = Writer.getStringId("%1");
+  auto Top = Writer.getStringId("Top");
+  auto Val = Writer.getStringId("42");
+
+  Writer.addRow(S1, {X}, {Top});
+  Writer.addRow(S2, {X, One}, {Top, Val});
+  // The same statement may be written more than once
+  Writer.addRow(S1, {One}, {Val});
+  Writer.finish();
+
+  EXPECT_EQ(3, Writer.getNumRows());
+  EXPECT_EQ(4, Writer.getNumResults());
+  EXPECT_EQ(6, Writer.getNumStrings());
+  return Buf;
+}
+
+TEST(ColumnarResultsTest, RoundTrip) {
+  auto Buf = writeSampleResults();
+  EXPECT_TRUE(llvm::StringRef(Buf).startswith("PSRRES"));
+
+  auto Reader = ColumnarResultsReader::create(Buf);
+  ASSERT_TRUE(bool(Reader)) << Reader.getError().message();
+  EXPECT_EQ(6, Reader->getNumStrings());
+  EXPECT_EQ(3, Reader->getNumRows());
+  EXPECT_EQ(4, Reader->getNumResults());
+
+  std::vector<TripleTy> All;
+  Reader->foreachResult(
+      [&All](llvm::StringRef Stmt, llvm::StringRef Fact, llvm::StringRef Val) {
+        All.emplace_back(Stmt, Fact, Val);
+      });
+  std::vector<TripleTy> Expected = {
+      {"%1 = load i32, ptr %x", "%x", "Top"},
+      {"ret i32 %1", "%x", "Top"},
+      {"ret i32 %1", "%1", "42"},
+      {"%1 = load i32, ptr %x", "%1", "42"},
+  };
+  EXPECT_EQ(Expected, All);
+
+  std::vector<TripleTy> AtLoad;
+  Reader->foreachResultAt(
+      "%1 = load i32, ptr %x",
+      [&AtLoad](llvm::StringRef Stmt, llvm::StringRef Fact,
+                llvm::StringRef Val) { AtLoad.emplace_back(Stmt, Fact, Val); });
+  Expected = {
+      {"%1 = load i32, ptr %x", "%x", "Top"},
+      {"%1 = load i32, ptr %x", "%1", "42"},
+  };
+  EXPECT_EQ(Expected, AtLoad);
+
+  EXPECT_TRUE(Reader->containsStmt("ret i32 %1"));
+  EXPECT_FALSE(Reader->containsStmt("%x"));
+}
+
+TEST(ColumnarResultsTest, RejectsInvalidInput) {
+  auto Buf = writeSampleResults();
+
+  EXPECT_FALSE(bool(ColumnarResultsReader::create("")));
+  EXPECT_FALSE(bool(ColumnarResultsReader::create("PSRESG\x01Z")));
+  // Truncated: missing trailer
+  EXPECT_FALSE(
+      bool(ColumnarResultsReader::create(llvm::StringRef(Buf).drop_back())));
+  // Truncated within a row
+  EXPECT_FALSE(bool(
+      ColumnarResultsReader::create(llvm::StringRef(Buf).drop_back(3))));
+  // Reference to a string that has not been written before
+  EXPECT_FALSE(
+      bool(ColumnarResultsReader::create(llvm::StringRef("PSRRES\x01R\x05\x00Z",
+                                                         11))));
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+#include "phasar/Utils/CompressedTransitiveClosure.h"
+
+#include "llvm/ADT/BitVector.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace psr;
+
+namespace {
+using EdgeList = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/// Computes the reflexive transitive closure with a plain fixpoint iteration
+std::vector<llvm::BitVector> naiveClosure(size_t NumNodes,
+                                          const EdgeList &Edges) {
+  std::vector<llvm::BitVector> Ret(NumNodes, llvm::BitVector(NumNodes));
+  for (size_t I = 0; I != NumNodes; ++I) {
+    Ret[I].set(I);
+  }
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (auto [From, To] : Edges) {
+      auto Old = Ret[From].count();
+      Ret[From] |= Ret[To];
+      Changed |= Old != Ret[From].count();
+    }
+  }
+  return Ret;
+}
+
+void checkAgainstNaive(size_t NumNodes, const EdgeList &Edges) {
+  CompressedTransitiveClosure TC(NumNodes, Edges);
+  auto Expected = naiveClosure(NumNodes, Edges);
+  ASSERT_EQ(NumNodes, TC.size());
+
+  for (uint32_t From = 0; From != NumNodes; ++From) {
+    std::set<uint32_t> Reachable;
+    for (auto Node : TC.reachableFrom(From)) {
+      EXPECT_TRUE(Reachable.insert(Node).second)
+          << Node << " is reached twice from " << From;
+    }
+    EXPECT_EQ(Expected[From].count(), Reachable.size());
+    EXPECT_EQ(Expected[From].count(), TC.numReachable(From));
+
+    for (uint32_t To = 0; To != NumNodes; ++To) {
+      EXPECT_EQ(Expected[From].test(To), TC.reaches(From, To))
+          << From << " -> " << To;
+      EXPECT_EQ(Expected[From].test(To), Reachable.count(To));
+    }
+  }
+}
+
+} // namespace
+
+TEST(CompressedTransitiveClosureTest, Empty) {
+  CompressedTransitiveClosure TC(0, {});
+  EXPECT_TRUE(TC.empty());
+  EXPECT_EQ(0, TC.getNumIntervals());
+}
+
+TEST(CompressedTransitiveClosureTest, Tree) {
+  // 0 -> {1, 2}, 1 -> {3, 4}, 2 -> {5}
+  EdgeList Edges = {{0, 1}, {0, 2}, {1, 3}, {1, 4}, {2, 5}};
+  checkAgainstNaive(6, Edges);
+
+  // A forest needs exactly one interval per node
+  CompressedTransitiveClosure TC(6, Edges);
+  EXPECT_EQ(6, TC.getNumIntervals());
+}
+
+TEST(CompressedTransitiveClosureTest, Diamond) {
+  // 0 -> 2, 1 -> 2, 2 -> 3
+  EdgeList Edges = {{0, 2}, {1, 2}, {2, 3}};
+  checkAgainstNaive(4, Edges);
+}
+
+TEST(CompressedTransitiveClosureTest, SelfLoopsAndDuplicates) {
+  EdgeList Edges = {{0, 0}, {0, 1}, {0, 1}, {1, 2}, {0, 2}, {2, 2}};
+  checkAgainstNaive(3, Edges);
+}
+
+TEST(CompressedTransitiveClosureTest, MappedValues) {
+  EdgeList Edges = {{0, 1}, {1, 2}};
+  CompressedTransitiveClosure TC(4, Edges);
+  std::vector<std::string> Names = {"A", "B", "C", "D"};
+
+  std::set<std::string> Reachable;
+  for (const auto &Name :
+       TC.reachableFrom(1, llvm::ArrayRef<std::string>(Names))) {
+    Reachable.insert(Name);
+  }
+  EXPECT_EQ((std::set<std::string>{"B", "C"}), Reachable);
+}
+
+TEST(CompressedTransitiveClosureTest, RandomDags) {
+  for (unsigned Seed = 0; Seed != 20; ++Seed) {
+    std::mt19937 Gen(Seed);
+    std::uniform_int_distribution<uint32_t> NumNodesDist(1, 60);
+    std::uniform_int_distribution<unsigned> DegDist(0, 3);
+
+    auto NumNodes = NumNodesDist(Gen);
+    EdgeList Edges;
+    // Edges only point to nodes with a higher id to keep the graph acyclic
+    for (uint32_t I = 0; I + 1 < NumNodes; ++I) {
+      std::uniform_int_distribution<uint32_t> TargetDist(I + 1, NumNodes - 1);
+      for (unsigned E = 0, Deg = DegDist(Gen); E != Deg; ++E) {
+        Edges.emplace_back(I, TargetDist(Gen));
+      }
+    }
+    // Permute the node-ids, s.t. the graph is not topologically sorted
+    std::vector<uint32_t> Perm(NumNodes);
+    std::iota(Perm.begin(), Perm.end(), 0);
+    std::shuffle(Perm.begin(), Perm.end(), Gen);
+    for (auto &[From, To] : Edges) {
+      From = Perm[From];
+      To = Perm[To];
+    }
+
+    SCOPED_TRACE("Seed " + std::to_string(Seed));
+    checkAgainstNaive(NumNodes, Edges);
+  }
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
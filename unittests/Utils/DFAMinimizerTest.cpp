@@ -0,0 +1,115 @@
+#include "phasar/Utils/DFAMinimizer.h"
+
+#include "phasar/Utils/AdjacencyList.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace psr;
+
+namespace {
+using GraphTy = AdjacencyList<int>;
+using traits_t = GraphTraits<GraphTy>;
+
+/// Creates a random DAG with few distinct node values, such that many
+/// vertices are equivalent. Edges only point to vertices with a higher id.
+GraphTy createRandomDag(unsigned NumVertices, unsigned Seed) {
+  std::mt19937 Gen(Seed);
+  std::uniform_int_distribution<int> ValDist(0, 2);
+  std::uniform_int_distribution<unsigned> DegDist(0, 3);
+
+  GraphTy G;
+  for (unsigned I = 0; I != NumVertices; ++I) {
+    traits_t::addNode(G, ValDist(Gen));
+  }
+  traits_t::addRoot(G, 0);
+  for (unsigned I = 0; I + 1 < NumVertices; ++I) {
+    auto Degree = DegDist(Gen);
+    // Prefer the last few vertices as targets to create common suffixes
+    std::uniform_int_distribution<unsigned> TargetDist(
+        std::max(I + 1, NumVertices - 8), NumVertices - 1);
+    for (unsigned E = 0; E != Degree; ++E) {
+      traits_t::addEdge(G, I, TargetDist(Gen));
+    }
+  }
+  return G;
+}
+
+void expectSameClasses(const llvm::IntEqClasses &Expected,
+                       const llvm::IntEqClasses &Actual, unsigned Size) {
+  ASSERT_EQ(Expected.getNumClasses(), Actual.getNumClasses());
+  for (unsigned I = 0; I != Size; ++I) {
+    EXPECT_EQ(Expected[I], Actual[I]) << "At vertex " << I;
+  }
+}
+} // namespace
+
+TEST(DFAMinimizerTest, mergesEquivalentSuffixes) {
+  GraphTy G;
+  auto Rt = traits_t::addNode(G, 0);
+  auto A = traits_t::addNode(G, 1);
+  auto B = traits_t::addNode(G, 1);
+  auto LeafA = traits_t::addNode(G, 2);
+  auto LeafB = traits_t::addNode(G, 2);
+  traits_t::addRoot(G, Rt);
+  traits_t::addEdge(G, Rt, A);
+  traits_t::addEdge(G, Rt, B);
+  traits_t::addEdge(G, A, LeafA);
+  traits_t::addEdge(G, B, LeafB);
+
+  auto Eq = minimizeGraph(G);
+  EXPECT_EQ(3, Eq.getNumClasses());
+  EXPECT_EQ(Eq[A], Eq[B]);
+  EXPECT_EQ(Eq[LeafA], Eq[LeafB]);
+  EXPECT_NE(Eq[Rt], Eq[A]);
+}
+
+TEST(DFAMinimizerTest, swappedBinaryEdgesAreEquivalent) {
+  GraphTy G;
+  auto Rt = traits_t::addNode(G, 0);
+  auto A = traits_t::addNode(G, 1);
+  auto B = traits_t::addNode(G, 1);
+  auto X = traits_t::addNode(G, 2);
+  auto Y = traits_t::addNode(G, 3);
+  traits_t::addRoot(G, Rt);
+  traits_t::addEdge(G, Rt, A);
+  traits_t::addEdge(G, Rt, B);
+  traits_t::addEdge(G, A, X);
+  traits_t::addEdge(G, A, Y);
+  traits_t::addEdge(G, B, Y);
+  traits_t::addEdge(G, B, X);
+
+  auto Eq = minimizeGraph(G);
+  EXPECT_EQ(Eq[A], Eq[B]);
+  EXPECT_NE(Eq[X], Eq[Y]);
+}
+
+TEST(DFAMinimizerTest, sameClassesAsIterativeMinimization) {
+  for (unsigned Seed = 0; Seed != 20; ++Seed) {
+    auto G = createRandomDag(200, Seed);
+    expectSameClasses(detail::minimizeGraphIteratively(G), minimizeGraph(G),
+                      traits_t::size(G));
+  }
+}
+
+TEST(DFAMinimizerTest, cyclicGraphFallsBack) {
+  GraphTy G;
+  auto Rt = traits_t::addNode(G, 0);
+  auto A = traits_t::addNode(G, 1);
+  auto B = traits_t::addNode(G, 1);
+  traits_t::addRoot(G, Rt);
+  traits_t::addEdge(G, Rt, A);
+  traits_t::addEdge(G, Rt, B);
+  traits_t::addEdge(G, A, Rt);
+  traits_t::addEdge(G, B, Rt);
+
+  expectSameClasses(detail::minimizeGraphIteratively(G), minimizeGraph(G),
+                    traits_t::size(G));
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+#include "phasar/Utils/DeltaListArena.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+using namespace psr;
+
+static std::vector<uint32_t> toVector(const DeltaListArena &Arena,
+                                      const DeltaListArena::List &L) {
+  auto Entries = Arena.entries(L);
+  return {Entries.begin(), Entries.end()};
+}
+
+TEST(DeltaListArenaTest, emptyList) {
+  DeltaListArena Arena;
+  DeltaListArena::List L(42);
+  EXPECT_TRUE(L.empty());
+  EXPECT_EQ(Arena.begin(L), Arena.end(L));
+  EXPECT_EQ(0, Arena.getNumChunks());
+}
+
+TEST(DeltaListArenaTest, appendIncreasingAndDecreasing) {
+  DeltaListArena Arena;
+  DeltaListArena::List L(1000);
+  std::vector<uint32_t> Expected = {1001, 1005, 3, 0,     ~uint32_t(0),
+                                    1000, 1000, 7, 70000, 42};
+  for (auto Val : Expected) {
+    Arena.append(L, Val);
+  }
+  EXPECT_EQ(Expected.size(), L.size());
+  EXPECT_EQ(Expected, toVector(Arena, L));
+}
+
+TEST(DeltaListArenaTest, nearbyIdsAreCompact) {
+  DeltaListArena Arena;
+  DeltaListArena::List L(100);
+  for (uint32_t I = 101; I != 101 + DeltaListArena::ChunkSize; ++I) {
+    Arena.append(L, I);
+  }
+  // One byte per entry, so this fits into two chunks
+  EXPECT_EQ(2, Arena.getNumChunks());
+}
+
+TEST(DeltaListArenaTest, interleavedLists) {
+  DeltaListArena Arena;
+  std::mt19937 Gen(0x5eed);
+  std::uniform_int_distribution<uint32_t> Dist(0, 1 << 20);
+
+  std::vector<DeltaListArena::List> Lists;
+  std::vector<std::vector<uint32_t>> Expected(64);
+  for (uint32_t I = 0; I != Expected.size(); ++I) {
+    Lists.emplace_back(I);
+  }
+
+  for (size_t Round = 0; Round != 2000; ++Round) {
+    auto Idx = Dist(Gen) % Lists.size();
+    auto Val = Dist(Gen);
+    Arena.append(Lists[Idx], Val);
+    Expected[Idx].push_back(Val);
+  }
+
+  for (size_t I = 0; I != Lists.size(); ++I) {
+    EXPECT_EQ(Expected[I], toVector(Arena, Lists[I]));
+  }
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
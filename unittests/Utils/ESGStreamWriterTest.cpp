@@ -0,0 +1,146 @@
+#include "phasar/Utils/ESGStreamWriter.h"
+
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+
+#include <string>
+
+using namespace psr;
+
+namespace {
+
+void writeSampleGraph(llvm::raw_ostream &OS, ESGExportFormat Format) {
+  ESGStreamWriter Writer(OS, Format, "sample");
+  auto Main = Writer.getStringId("main");
+  auto S1 = Writer.getStringId("%1 = load i32, ptr %x");
+  auto S2 = Writer.getStringId("ret i32 %1");
+  auto Zero = Writer.getStringId("Λ");
+  auto X = Writer.getStringId("%x");
+  EXPECT_EQ(Main, Writer.getStringId("main"));
+
+  auto N0 = Writer.addNode(Main, S1, Zero);
+  auto N1 = Writer.addNode(Main, S2, Zero);
+  auto N2 = Writer.addNode(Main, S1, X);
+  auto N3 = Writer.addNode(Main, S2, X);
+  Writer.addEdge(N0, N1, false);
+  Writer.addEdge(N0, N3, false, Writer.getStringId("\"gen\""));
+  Writer.addEdge(N2, N3, true, Writer.getStringId("EdgeIdentity"));
+
+  EXPECT_EQ(4, Writer.getNumNodes());
+  EXPECT_EQ(3, Writer.getNumEdges());
+  EXPECT_EQ(7, Writer.getNumStrings());
+}
+
+} // namespace
+
+TEST(ESGStreamWriterTest, WritesDot) {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  writeSampleGraph(OS, ESGExportFormat::Dot);
+
+  llvm::StringRef Dot = Buf;
+  EXPECT_TRUE(Dot.startswith("digraph ESG {\n"));
+  EXPECT_TRUE(Dot.endswith("}\n"));
+  EXPECT_TRUE(Dot.contains("  n3 [label=\"%x\\n@ ret i32 %1\\n(main)\"]\n"));
+  EXPECT_TRUE(Dot.contains("  n0 -> n1\n"));
+  EXPECT_TRUE(Dot.contains("  n0 -> n3 [label=\"\\\"gen\\\"\"]\n"));
+  EXPECT_TRUE(Dot.contains(
+      "  n2 -> n3 [style=dashed, weight=0.1, label=\"EdgeIdentity\"]\n"));
+}
+
+TEST(ESGStreamWriterTest, WritesJson) {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  writeSampleGraph(OS, ESGExportFormat::Json);
+
+  auto Json = nlohmann::json::parse(Buf);
+  EXPECT_EQ("sample", Json["label"]);
+
+  std::vector<std::string> Strings;
+  size_t NumNodes = 0;
+  size_t NumEdges = 0;
+  for (const auto &Rec : Json["records"]) {
+    if (Rec["kind"] == "string") {
+      EXPECT_EQ(Strings.size(), Rec["id"]);
+      Strings.push_back(Rec["value"]);
+    } else if (Rec["kind"] == "node") {
+      EXPECT_EQ(NumNodes++, Rec["id"]);
+      EXPECT_LT(Rec["fact"].get<size_t>(), Strings.size());
+    } else {
+      ASSERT_EQ("edge", Rec["kind"]);
+      ++NumEdges;
+      EXPECT_LT(Rec["from"].get<size_t>(), NumNodes);
+      EXPECT_LT(Rec["to"].get<size_t>(), NumNodes);
+      if (NumEdges == 2) {
+        EXPECT_EQ("\"gen\"", Strings.at(Rec["ef"].get<size_t>()));
+      }
+      EXPECT_EQ(NumEdges == 3, Rec["interproc"].get<bool>());
+    }
+  }
+  EXPECT_EQ(7, Strings.size());
+  EXPECT_EQ("Λ", Strings[3]);
+  EXPECT_EQ(4, NumNodes);
+  EXPECT_EQ(3, NumEdges);
+}
+
+TEST(ESGStreamWriterTest, WritesBinary) {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  writeSampleGraph(OS, ESGExportFormat::Binary);
+  OS.flush();
+
+  llvm::DataExtractor Data(Buf, /*IsLittleEndian=*/true, /*AddressSize=*/8);
+  llvm::DataExtractor::Cursor Cur(0);
+
+  EXPECT_EQ("PSRESG", Data.getBytes(Cur, 6));
+  EXPECT_EQ(1, Data.getU8(Cur));
+  EXPECT_EQ("sample", StringTableReader::readString(Data, Cur));
+
+  StringTableReader Strings;
+  size_t NumNodes = 0;
+  std::vector<uint64_t> EdgeFns;
+  for (char Tag = char(Data.getU8(Cur)); Cur && Tag != 'Z';
+       Tag = char(Data.getU8(Cur))) {
+    switch (Tag) {
+    case StringTableWriter::RecordTag:
+      Strings.readRecord(Data, Cur);
+      break;
+    case 'N':
+      for (int I = 0; I < 3; ++I) {
+        EXPECT_LT(Data.getULEB128(Cur), Strings.size());
+      }
+      ++NumNodes;
+      break;
+    case 'E':
+      EXPECT_LT(Data.getULEB128(Cur), NumNodes);
+      EXPECT_LT(Data.getULEB128(Cur), NumNodes);
+      Data.getULEB128(Cur);
+      EdgeFns.push_back(Data.getULEB128(Cur));
+      break;
+    default:
+      FAIL() << "Unexpected record tag " << Tag;
+    }
+  }
+  ASSERT_TRUE(bool(Cur)) << llvm::toString(Cur.takeError());
+  EXPECT_EQ(Buf.size(), Cur.tell());
+
+  EXPECT_EQ(4, NumNodes);
+  ASSERT_EQ(3, EdgeFns.size());
+  EXPECT_EQ(0, EdgeFns[0]);
+  ASSERT_TRUE(Strings.contains(EdgeFns[1] - 1));
+  EXPECT_EQ("\"gen\"", Strings.getString(EdgeFns[1] - 1));
+  ASSERT_TRUE(Strings.contains(EdgeFns[2] - 1));
+  EXPECT_EQ("EdgeIdentity", Strings.getString(EdgeFns[2] - 1));
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
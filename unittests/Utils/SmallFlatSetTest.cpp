@@ -0,0 +1,121 @@
+#include "phasar/Utils/SmallFlatSet.h"
+
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace psr;
+
+template <typename T, unsigned N>
+static void expectSameAs(const SmallFlatSet<T, N> &Set,
+                         const std::set<T> &Expected) {
+  EXPECT_EQ(Expected.size(), Set.size());
+  EXPECT_TRUE(std::equal(Set.begin(), Set.end(), Expected.begin(),
+                         Expected.end()));
+}
+
+TEST(SmallFlatSetTest, Empty) {
+  SmallFlatSet<int> Set;
+  EXPECT_TRUE(Set.empty());
+  EXPECT_EQ(0, Set.size());
+  EXPECT_EQ(Set.end(), Set.begin());
+  EXPECT_EQ(Set.end(), Set.find(42));
+  EXPECT_EQ(0, Set.count(42));
+  EXPECT_EQ(0, Set.erase(42));
+}
+
+TEST(SmallFlatSetTest, InsertKeepsSortedAndUnique) {
+  SmallFlatSet<int> Set;
+  EXPECT_TRUE(Set.insert(3).second);
+  EXPECT_TRUE(Set.insert(1).second);
+  EXPECT_TRUE(Set.insert(2).second);
+
+  auto [It, Inserted] = Set.insert(1);
+  EXPECT_FALSE(Inserted);
+  EXPECT_EQ(1, *It);
+
+  expectSameAs(Set, {1, 2, 3});
+  EXPECT_TRUE(Set.isSmall());
+}
+
+TEST(SmallFlatSetTest, InitializerListAndRange) {
+  SmallFlatSet<int> Set = {5, 1, 5, 3, 1};
+  expectSameAs(Set, {1, 3, 5});
+
+  std::vector<int> Vec = {4, 3, 2, 6};
+  Set.insert(Vec.begin(), Vec.end());
+  expectSameAs(Set, {1, 2, 3, 4, 5, 6});
+
+  SmallFlatSet<int> Other;
+  std::copy(Vec.begin(), Vec.end(), std::inserter(Other, Other.end()));
+  expectSameAs(Other, {2, 3, 4, 6});
+}
+
+TEST(SmallFlatSetTest, Erase) {
+  SmallFlatSet<int> Set = {1, 2, 3, 4};
+  EXPECT_EQ(1, Set.erase(2));
+  EXPECT_EQ(0, Set.erase(2));
+
+  auto It = Set.erase(Set.find(3));
+  ASSERT_NE(Set.end(), It);
+  EXPECT_EQ(4, *It);
+
+  expectSameAs(Set, {1, 4});
+}
+
+TEST(SmallFlatSetTest, Equality) {
+  SmallFlatSet<int> Set1 = {3, 2, 1};
+  SmallFlatSet<int> Set2;
+  Set2.insert(1);
+  Set2.insert(2);
+  Set2.insert(3);
+  EXPECT_EQ(Set1, Set2);
+
+  Set2.erase(3);
+  EXPECT_NE(Set1, Set2);
+  EXPECT_TRUE(Set2 < Set1);
+}
+
+TEST(SmallFlatSetTest, NonTrivialElements) {
+  SmallFlatSet<std::string, 2> Set;
+  Set.emplace("foo");
+  Set.insert(std::string("bar"));
+  Set.insert({"baz", "foo"});
+  expectSameAs(Set, {"bar", "baz", "foo"});
+  EXPECT_FALSE(Set.isSmall());
+  EXPECT_TRUE(Set.contains("baz"));
+  EXPECT_FALSE(Set.contains("qux"));
+}
+
+TEST(SmallFlatSetTest, MatchesStdSet) {
+  // Exceed the linear-search threshold to also cover binary search
+  std::mt19937 Rand(42);
+  std::uniform_int_distribution<int> Dist(0, 200);
+
+  SmallFlatSet<int> Set;
+  std::set<int> Expected;
+  for (int I = 0; I < 1000; ++I) {
+    auto Val = Dist(Rand);
+    switch (I % 3) {
+    case 0:
+    case 1:
+      EXPECT_EQ(Expected.insert(Val).second, Set.insert(Val).second);
+      break;
+    case 2:
+      EXPECT_EQ(Expected.erase(Val), Set.erase(Val));
+      break;
+    }
+    EXPECT_EQ(Expected.count(Val), Set.count(Val));
+  }
+  expectSameAs(Set, Expected);
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
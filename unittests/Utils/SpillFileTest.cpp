@@ -0,0 +1,62 @@
+#include "phasar/Utils/SpillFile.h"
+
+#include "llvm/Support/FileSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace psr;
+
+namespace {
+
+TEST(SpillFileTest, WriteAndRead) {
+  auto File = SpillFile::create("");
+  ASSERT_TRUE(bool(File)) << File.getError().message();
+  EXPECT_TRUE(llvm::sys::fs::exists(File->getPath()));
+
+  auto Seg1 = File->write("Hello");
+  ASSERT_TRUE(bool(Seg1));
+  // Large enough to be mapped into memory
+  std::string Large(3 * 4096 + 17, 'x');
+  Large.back() = 'y';
+  auto Seg2 = File->write(Large);
+  ASSERT_TRUE(bool(Seg2));
+  auto Seg3 = File->write(", World");
+  ASSERT_TRUE(bool(Seg3));
+  EXPECT_EQ(5 + Large.size() + 7, File->size());
+
+  auto Buf3 = File->read(*Seg3);
+  ASSERT_TRUE(bool(Buf3));
+  EXPECT_EQ(", World", (*Buf3)->getBuffer());
+  auto Buf2 = File->read(*Seg2);
+  ASSERT_TRUE(bool(Buf2));
+  EXPECT_EQ(Large, (*Buf2)->getBuffer());
+  auto Buf1 = File->read(*Seg1);
+  ASSERT_TRUE(bool(Buf1));
+  EXPECT_EQ("Hello", (*Buf1)->getBuffer());
+}
+
+TEST(SpillFileTest, RemovedOnDestruction) {
+  std::string Path;
+  {
+    auto File = SpillFile::create("");
+    ASSERT_TRUE(bool(File));
+    Path = File->getPath().str();
+    // Moving must not remove the file
+    SpillFile Moved = std::move(*File);
+    EXPECT_TRUE(llvm::sys::fs::exists(Path));
+    EXPECT_TRUE(bool(Moved.write("data")));
+  }
+  EXPECT_FALSE(llvm::sys::fs::exists(Path));
+
+  EXPECT_FALSE(bool(SpillFile::create("/nonexistent/phasar/dir")));
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
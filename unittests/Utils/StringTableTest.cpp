@@ -0,0 +1,82 @@
+#include "phasar/Utils/StringTable.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/DataExtractor.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <string_view>
+
+using namespace psr;
+using namespace std::string_view_literals;
+
+namespace {
+
+TEST(StringTableTest, RoundTrip) {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+
+  StringTableWriter Writer;
+  auto Foo = Writer.getStringId("foo", OS);
+  auto Empty = Writer.getStringId("", OS);
+  // Already interned strings are not written again
+  EXPECT_EQ(Foo, Writer.getStringId("foo", OS));
+  auto [Bar, Inserted] = Writer.insert("bar");
+  EXPECT_TRUE(Inserted);
+  EXPECT_FALSE(Writer.insert("bar").second);
+  StringTableWriter::writeRecord("bar", OS);
+  OS.flush();
+
+  EXPECT_EQ(0U, Foo);
+  EXPECT_EQ(1U, Empty);
+  EXPECT_EQ(2U, Bar);
+  EXPECT_EQ(3U, Writer.size());
+  EXPECT_EQ("bar", Writer.getString(Bar));
+  // Each record is the tag, the ULEB128 encoded length and the bytes
+  EXPECT_EQ("S\x03"
+            "foo"
+            "S\x00"
+            "S\x03"
+            "bar"sv,
+            Buf);
+
+  llvm::DataExtractor Data(Buf, /*IsLittleEndian=*/true, /*AddressSize=*/8);
+  llvm::DataExtractor::Cursor Cur(0);
+  StringTableReader Reader;
+  while (Cur && !Data.eof(Cur)) {
+    ASSERT_EQ(StringTableWriter::RecordTag, char(Data.getU8(Cur)));
+    Reader.readRecord(Data, Cur);
+  }
+  ASSERT_TRUE(bool(Cur)) << llvm::toString(Cur.takeError());
+
+  ASSERT_EQ(3U, Reader.size());
+  EXPECT_FALSE(Reader.contains(3));
+  EXPECT_EQ("foo", Reader.getString(Foo));
+  EXPECT_EQ("", Reader.getString(Empty));
+  EXPECT_EQ("bar", Reader.getString(Bar));
+}
+
+TEST(StringTableTest, TruncatedString) {
+  std::string Buf;
+  llvm::raw_string_ostream OS(Buf);
+  StringTableWriter::writeString("truncated", OS);
+  OS.flush();
+  Buf.pop_back();
+
+  llvm::DataExtractor Data(Buf, /*IsLittleEndian=*/true, /*AddressSize=*/8);
+  llvm::DataExtractor::Cursor Cur(0);
+  EXPECT_EQ("", StringTableReader::readString(Data, Cur));
+  EXPECT_FALSE(bool(Cur));
+  llvm::consumeError(Cur.takeError());
+}
+
+} // namespace
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+# Compares two JSON outputs of phasar-benchmarks (e.g., produced by the
+# run-phasar-benchmarks target) and reports benchmarks that got slower by
+# more than the given threshold. Exits with 1 if there are any regressions,
+# such that it can be used in CI.
+#
+# usage: phasar-compare-benchmarks.py [--threshold PERCENT] BASELINE CONTENDER
+
+import argparse
+import json
+import sys
+
+
+def loadBenchmarks(path):
+    with open(path) as f:
+        data = json.load(f)
+    result = {}
+    for bench in data.get("benchmarks", []):
+        # Only compare the actual measurements, not the aggregates
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        if "error_occurred" in bench and bench["error_occurred"]:
+            continue
+        result[bench["name"]] = bench
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two phasar-benchmarks JSON results")
+    parser.add_argument("baseline", help="JSON result of the baseline")
+    parser.add_argument("contender", help="JSON result to check")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Max. allowed slowdown in percent (default: 10)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"],
+                        default="cpu_time",
+                        help="Which time to compare (default: cpu_time)")
+    args = parser.parse_args()
+
+    baseline = loadBenchmarks(args.baseline)
+    contender = loadBenchmarks(args.contender)
+
+    regressions = 0
+    print("{:<60} {:>14} {:>14} {:>9}".format(
+        "Benchmark", "Baseline", "Contender", "Change"))
+    for name in sorted(baseline.keys() & contender.keys()):
+        old = baseline[name]
+        new = contender[name]
+        if old["time_unit"] != new["time_unit"]:
+            print("{:<60} time units differ, skipped".format(name))
+            continue
+
+        oldTime = old[args.metric]
+        newTime = new[args.metric]
+        change = (newTime - oldTime) / oldTime * 100 if oldTime else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions += 1
+        print("{:<60} {:>11.2f} {:<2} {:>11.2f} {:<2} {:>+8.1f}%{}".format(
+            name, oldTime, old["time_unit"], newTime, new["time_unit"], change,
+            marker))
+
+    for name in sorted(baseline.keys() - contender.keys()):
+        print("{:<60} missing in contender".format(name))
+    for name in sorted(contender.keys() - baseline.keys()):
+        print("{:<60} new".format(name))
+
+    if regressions:
+        print("\n{} benchmark(s) regressed by more than {}%".format(
+            regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())